@@ -0,0 +1,33 @@
+option(SKL_ENABLE_HDF5 "Enable HDF5 checkpoint/restart support" OFF)
+
+if( SKL_ENABLE_HDF5 )
+    if(NOT HDF5_ROOT)
+        set(HDF5_ROOT "")
+        set(HDF5_ROOT "$ENV{HDF5_ROOT}")
+    endif()
+
+    message(STATUS "Searching path ${HDF5_ROOT}")
+
+    set(HDF5_PREFER_PARALLEL ON)
+    find_package(HDF5 REQUIRED COMPONENTS C)
+
+    message(STATUS "HDF5 libraries: ${HDF5_C_LIBRARIES}")
+    message(STATUS "HDF5 includes: ${HDF5_C_INCLUDE_DIRS}")
+
+    if( HDF5_IS_PARALLEL )
+        message(STATUS "HDF5 has parallel (MPI-IO) support.")
+        set(SKL_HDF5_PARALLEL ON)
+    else()
+        message(WARNING "HDF5 was built without parallel support, checkpoints can only be written from a single rank.")
+    endif()
+
+    if(NOT TARGET hdf5::hdf5)
+        add_library(hdf5::hdf5 IMPORTED INTERFACE)
+        set_property(TARGET hdf5::hdf5 APPEND PROPERTY
+                     INTERFACE_INCLUDE_DIRECTORIES "${HDF5_C_INCLUDE_DIRS}")
+        set_property(TARGET hdf5::hdf5 APPEND PROPERTY
+                     INTERFACE_LINK_LIBRARIES "${HDF5_C_LIBRARIES}")
+        set_property(TARGET hdf5::hdf5 APPEND PROPERTY
+                     INTERFACE_COMPILE_DEFINITIONS "${HDF5_C_DEFINITIONS}")
+    endif()
+endif()
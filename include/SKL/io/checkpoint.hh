@@ -0,0 +1,457 @@
+/**
+ * @file checkpoint.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief HDF5 checkpoint/restart of Kokkos Views and solver state.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_IO_CHECKPOINT_HH
+#define SKL_IO_CHECKPOINT_HH
+
+#include <SKL_config.h>
+
+#ifdef SKL_ENABLE_HDF5
+
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Sacado.hpp>
+
+#include <mpi.h>
+#include <hdf5.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+namespace skl { namespace io {
+
+namespace detail {
+
+/**
+ * @brief Map a C++ scalar type to the corresponding native HDF5 type.
+ */
+template< typename T >
+hid_t SKL_ALWAYS_INLINE
+h5_native_type()
+{
+    using type = std::remove_cv_t<T> ;
+    if constexpr ( std::is_same_v<type, double> ) {
+        return H5T_NATIVE_DOUBLE ;
+    } else if constexpr ( std::is_same_v<type, float> ) {
+        return H5T_NATIVE_FLOAT ;
+    } else if constexpr ( std::is_same_v<type, int> ) {
+        return H5T_NATIVE_INT ;
+    } else if constexpr ( std::is_same_v<type, unsigned int> ) {
+        return H5T_NATIVE_UINT ;
+    } else if constexpr ( std::is_same_v<type, long> ) {
+        return H5T_NATIVE_LONG ;
+    } else if constexpr ( std::is_same_v<type, unsigned long> ) {
+        return H5T_NATIVE_ULONG ;
+    } else if constexpr ( std::is_same_v<type, long long> ) {
+        return H5T_NATIVE_LLONG ;
+    } else if constexpr ( std::is_same_v<type, unsigned long long> ) {
+        return H5T_NATIVE_ULLONG ;
+    } else {
+        static_assert( sizeof(type) == 0, "Type not supported by checkpoint I/O.") ;
+    }
+}
+
+/**
+ * @brief Abort with msg if an HDF5 call returned a negative 
+ *        status or identifier, otherwise pass the value on.
+ */
+template< typename T >
+T SKL_ALWAYS_INLINE
+h5_check(T const status, const char msg[])
+{
+    if( status < 0 ) {
+        Kokkos::abort(msg) ;
+    }
+    return status ;
+}
+
+}
+
+/**
+ * @brief HDF5 checkpoint file.
+ * \ingroup io
+ *
+ * A checkpoint is a single HDF5 file shared by all ranks of
+ * the communicator. Views are written from their host mirror
+ * (which, on host backends, is the View itself) directly through
+ * an HDF5 hyperslab selection, no packing buffer is allocated.
+ * Views of Fad types are written through their <code>array_type</code>,
+ * the hidden derivative dimension appears as an additional dataset
+ * dimension. Under MPI, the local Views are understood to be slices
+ * of a global array along their first extent, each rank writes
+ * its own slice collectively into the shared dataset.
+ *
+ * Dataset names may contain '/', intermediate groups are created
+ * on the fly. Every HDF5 call is checked, a failure aborts with 
+ * a message naming the operation.
+ */
+class checkpoint
+{
+ public:
+    /**
+     * @brief Open a checkpoint file.
+     *
+     * @param fname Name of the file.
+     * @param write If true the file is created (and truncated),
+     *              otherwise it is opened read-only.
+     * @param comm  Communicator sharing the file. Ignored if MPI
+     *              has not been initialized.
+     * @param chunk_bytes Target size of a dataset chunk in bytes.
+     */
+    checkpoint( std::string const& fname
+              , bool write
+              , MPI_Comm comm = MPI_COMM_WORLD
+              , size_t chunk_bytes = (1UL<<20) )
+     : _comm(comm), _rank(0), _size(1), _write(write), _chunk_bytes(chunk_bytes)
+    {
+        int mpi_initialized ;
+        MPI_Initialized(&mpi_initialized) ;
+        if ( mpi_initialized ) {
+            MPI_Comm_rank(_comm, &_rank) ;
+            MPI_Comm_size(_comm, &_size) ;
+        }
+
+        hid_t fapl = detail::h5_check(H5Pcreate(H5P_FILE_ACCESS), "checkpoint: could not create the file access list.") ;
+        #ifdef SKL_HDF5_PARALLEL
+        if ( mpi_initialized ) {
+            detail::h5_check(H5Pset_fapl_mpio(fapl, _comm, MPI_INFO_NULL), "checkpoint: could not set the MPI-IO driver.") ;
+        }
+        #else
+        if ( _size > 1 ) {
+            Kokkos::abort("checkpoint: HDF5 without parallel support cannot be shared among MPI ranks.") ;
+        }
+        #endif
+
+        if( _write ) {
+            _file = H5Fcreate(fname.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl) ;
+        } else {
+            _file = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, fapl) ;
+        }
+        detail::h5_check(H5Pclose(fapl), "checkpoint: could not close the file access list.") ;
+        if( _file < 0 ) {
+            Kokkos::abort("checkpoint: could not open HDF5 file.") ;
+        }
+    }
+
+    ~checkpoint() {
+        if ( _file >= 0 ) {
+            detail::h5_check(H5Fflush(_file, H5F_SCOPE_GLOBAL), "checkpoint: could not flush the file.") ;
+            detail::h5_check(H5Fclose(_file), "checkpoint: could not close the file.") ;
+        }
+    }
+
+    checkpoint(checkpoint const&) = delete ;
+    checkpoint& operator=(checkpoint const&) = delete ;
+
+    /**
+     * @brief Check whether an object exists in the file.
+     *
+     * @param name Path of the object.
+     * @return true If every component of the path exists.
+     */
+    bool exists(std::string const& name) const {
+        size_t pos = 0 ;
+        while( pos != std::string::npos ) {
+            pos = name.find('/', pos+1) ;
+            auto const path = name.substr(0,pos) ;
+            if( detail::h5_check(H5Lexists(_file, path.c_str(), H5P_DEFAULT), "checkpoint: could not look up a link.") == 0 ) {
+                return false ;
+            }
+        }
+        return true ;
+    }
+
+    /**
+     * @brief Write a View to the checkpoint.
+     *
+     * @tparam view_t Type of the View.
+     * @param name    Name of the dataset.
+     * @param view    View to be written, can reside in any memory space.
+     */
+    template< typename view_t >
+    void write_view(std::string const& name, view_t const& view)
+    {
+        static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
+
+        auto h_view = Kokkos::create_mirror_view(view) ;
+        Kokkos::deep_copy(h_view, view) ;
+        typename decltype(h_view)::array_type h_arr = h_view ;
+        using array_t  = decltype(h_arr) ;
+        using scalar_t = typename array_t::non_const_value_type ;
+        static_assert(   std::is_same_v<typename array_t::array_layout, Kokkos::LayoutRight>
+                      or std::is_same_v<typename array_t::array_layout, Kokkos::LayoutLeft>
+                      , "checkpoint only supports contiguous Views (LayoutLeft or LayoutRight)." ) ;
+
+        int const rank = array_t::rank() ;
+        std::vector<hsize_t> gdims(rank), ldims(rank), offset(rank,0), chunk(rank) ;
+        int const dist = get_file_dims(h_arr, ldims) ;
+        gdims = ldims ;
+        distribute(ldims[dist], gdims[dist], offset[dist]) ;
+
+        // Chunks span the full extent of all dimensions
+        // but the distributed one
+        hsize_t slab = sizeof(scalar_t) ;
+        for( int i=0; i<rank; ++i) {
+            if( i != dist ) slab *= std::max(gdims[i],hsize_t{1}) ;
+        }
+        chunk = gdims ;
+        chunk[dist] = std::clamp( static_cast<hsize_t>(_chunk_bytes / slab), hsize_t{1}, std::max(gdims[dist],hsize_t{1}) ) ;
+        for( auto& c: chunk ) c = std::max(c, hsize_t{1}) ;
+
+        remove(name) ;
+
+        hid_t fspace = detail::h5_check(H5Screate_simple(rank, gdims.data(), nullptr), "checkpoint: could not create the file space.") ;
+        hid_t dcpl   = detail::h5_check(H5Pcreate(H5P_DATASET_CREATE), "checkpoint: could not create the dataset creation list.") ;
+        detail::h5_check(H5Pset_chunk(dcpl, rank, chunk.data()), "checkpoint: could not set the chunk size.") ;
+        hid_t lcpl   = link_plist() ;
+        hid_t dset   = detail::h5_check( H5Dcreate2( _file, name.c_str(), detail::h5_native_type<scalar_t>()
+                                                   , fspace, lcpl, dcpl, H5P_DEFAULT )
+                                       , "checkpoint: could not create dataset." ) ;
+
+        hid_t mspace = detail::h5_check(H5Screate_simple(rank, ldims.data(), nullptr), "checkpoint: could not create the memory space.") ;
+        detail::h5_check( H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset.data(), nullptr, ldims.data(), nullptr)
+                        , "checkpoint: could not select the local slice." ) ;
+        hid_t dxpl = transfer_plist() ;
+        detail::h5_check( H5Dwrite(dset, detail::h5_native_type<scalar_t>(), mspace, fspace, dxpl, h_arr.data())
+                        , "checkpoint: could not write dataset." ) ;
+
+        write_int_attribute(dset, "layout_left", layout_left<array_t>()) ;
+        write_int_attribute(dset, "fad_dim", Kokkos::dimension_scalar(h_view)) ;
+
+        close(H5Pclose(dxpl)) ; close(H5Sclose(mspace)) ; close(H5Dclose(dset)) ;
+        close(H5Pclose(lcpl)) ; close(H5Pclose(dcpl))   ; close(H5Sclose(fspace)) ;
+    }
+
+    /**
+     * @brief Read a View from the checkpoint.
+     *
+     * The View must already be allocated with the local
+     * extents it had when it was written.
+     *
+     * @tparam view_t Type of the View.
+     * @param name    Name of the dataset.
+     * @param view    View to be filled, can reside in any memory space.
+     */
+    template< typename view_t >
+    void read_view(std::string const& name, view_t const& view)
+    {
+        static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
+
+        auto h_view = Kokkos::create_mirror_view(view) ;
+        typename decltype(h_view)::array_type h_arr = h_view ;
+        using array_t  = decltype(h_arr) ;
+        using scalar_t = typename array_t::non_const_value_type ;
+
+        int const rank = array_t::rank() ;
+        std::vector<hsize_t> gdims(rank), ldims(rank), offset(rank,0) ;
+        int const dist = get_file_dims(h_arr, ldims) ;
+        gdims = ldims ;
+        distribute(ldims[dist], gdims[dist], offset[dist]) ;
+
+        hid_t dset = detail::h5_check(H5Dopen2(_file, name.c_str(), H5P_DEFAULT), "checkpoint: dataset not found.") ;
+        if( read_int_attribute(dset, "layout_left") != layout_left<array_t>() ) {
+            Kokkos::abort("checkpoint: dataset was written with a different memory layout.") ;
+        }
+        hid_t fspace = detail::h5_check(H5Dget_space(dset), "checkpoint: could not get the file space.") ;
+        std::vector<hsize_t> fdims(rank) ;
+        if(    H5Sget_simple_extent_ndims(fspace) != rank
+            or H5Sget_simple_extent_dims(fspace, fdims.data(), nullptr) < 0
+            or fdims != gdims ) {
+            Kokkos::abort("checkpoint: dataset extents do not match the View.") ;
+        }
+
+        hid_t mspace = detail::h5_check(H5Screate_simple(rank, ldims.data(), nullptr), "checkpoint: could not create the memory space.") ;
+        detail::h5_check( H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset.data(), nullptr, ldims.data(), nullptr)
+                        , "checkpoint: could not select the local slice." ) ;
+        hid_t dxpl = transfer_plist() ;
+        detail::h5_check( H5Dread(dset, detail::h5_native_type<scalar_t>(), mspace, fspace, dxpl, h_arr.data())
+                        , "checkpoint: could not read dataset." ) ;
+
+        close(H5Pclose(dxpl)) ; close(H5Sclose(mspace)) ; close(H5Sclose(fspace)) ; close(H5Dclose(dset)) ;
+
+        Kokkos::deep_copy(view, h_view) ;
+    }
+
+    /**
+     * @brief Write a scalar (e.g. an iteration counter) to the checkpoint.
+     *
+     * The value is expected to be the same on all ranks,
+     * only rank 0 writes it.
+     *
+     * @tparam T Type of the scalar.
+     * @param name Name of the dataset.
+     * @param val  Value to be written.
+     */
+    template< typename T >
+    void write_scalar(std::string const& name, T const& val)
+    {
+        remove(name) ;
+        hid_t space = detail::h5_check(H5Screate(H5S_SCALAR), "checkpoint: could not create the file space.") ;
+        hid_t lcpl  = link_plist() ;
+        hid_t dset  = detail::h5_check( H5Dcreate2( _file, name.c_str(), detail::h5_native_type<T>()
+                                                  , space, lcpl, H5P_DEFAULT, H5P_DEFAULT )
+                                      , "checkpoint: could not create dataset." ) ;
+        hid_t mspace = detail::h5_check(H5Screate(H5S_SCALAR), "checkpoint: could not create the memory space.") ;
+        if ( _rank != 0 ) {
+            detail::h5_check(H5Sselect_none(space), "checkpoint: could not clear the selection.")  ;
+            detail::h5_check(H5Sselect_none(mspace), "checkpoint: could not clear the selection.") ;
+        }
+        hid_t dxpl = transfer_plist() ;
+        detail::h5_check( H5Dwrite(dset, detail::h5_native_type<T>(), mspace, space, dxpl, &val)
+                        , "checkpoint: could not write dataset." ) ;
+        close(H5Pclose(dxpl)) ; close(H5Sclose(mspace)) ; close(H5Dclose(dset)) ; close(H5Pclose(lcpl)) ; close(H5Sclose(space)) ;
+    }
+
+    /**
+     * @brief Read a scalar from the checkpoint.
+     *
+     * @tparam T Type of the scalar.
+     * @param name Name of the dataset.
+     * @return T The stored value.
+     */
+    template< typename T >
+    T read_scalar(std::string const& name)
+    {
+        T val{} ;
+        hid_t dset = detail::h5_check(H5Dopen2(_file, name.c_str(), H5P_DEFAULT), "checkpoint: dataset not found.") ;
+        detail::h5_check( H5Dread(dset, detail::h5_native_type<T>(), H5S_ALL, H5S_ALL, H5P_DEFAULT, &val)
+                        , "checkpoint: could not read dataset." ) ;
+        close(H5Dclose(dset)) ;
+        return val ;
+    }
+
+ private:
+
+    /**
+     * @brief Get the local dimensions of the dataset in file order.
+     *
+     * HDF5 datasets are row-major, a LayoutLeft array is therefore
+     * stored with reversed dimensions so that it can be written
+     * without transposition.
+     *
+     * @return int The index of the distributed (first View) dimension.
+     */
+    template< typename array_t >
+    int get_file_dims(array_t const& arr, std::vector<hsize_t>& dims) const
+    {
+        int const rank = array_t::rank() ;
+        for( int i=0; i<rank; ++i) {
+            if constexpr ( layout_left<array_t>() ) {
+                dims[rank-1-i] = arr.extent(i) ;
+            } else {
+                dims[i] = arr.extent(i) ;
+            }
+        }
+        return layout_left<array_t>() ? rank-1 : 0 ;
+    }
+
+    template< typename array_t >
+    static constexpr int layout_left() {
+        return std::is_same_v<typename array_t::array_layout, Kokkos::LayoutLeft> ;
+    }
+
+    /**
+     * @brief Compute global extent and local offset of the distributed dimension.
+     */
+    void distribute(hsize_t local, hsize_t& global, hsize_t& offset) const
+    {
+        global = local ; offset = 0 ;
+        if( _size > 1 ) {
+            unsigned long long l{local}, g{0}, o{0} ;
+            MPI_Exscan(&l, &o, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, _comm) ;
+            MPI_Allreduce(&l, &g, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, _comm) ;
+            global = g ;
+            offset = (_rank == 0) ? 0 : o ;
+        }
+    }
+
+    hid_t transfer_plist() const
+    {
+        hid_t dxpl = detail::h5_check(H5Pcreate(H5P_DATASET_XFER), "checkpoint: could not create the transfer list.") ;
+        #ifdef SKL_HDF5_PARALLEL
+        if( _size > 1 ) {
+            detail::h5_check(H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE), "checkpoint: could not request collective I/O.") ;
+        }
+        #endif
+        return dxpl ;
+    }
+
+    //! Link creation list which creates intermediate groups
+    hid_t link_plist() const
+    {
+        hid_t lcpl = detail::h5_check(H5Pcreate(H5P_LINK_CREATE), "checkpoint: could not create the link creation list.") ;
+        detail::h5_check(H5Pset_create_intermediate_group(lcpl, 1), "checkpoint: could not enable intermediate groups.") ;
+        return lcpl ;
+    }
+
+    //! Delete the dataset name if present, so that it can be rewritten
+    void remove(std::string const& name) const
+    {
+        if ( exists(name) ) {
+            detail::h5_check(H5Ldelete(_file, name.c_str(), H5P_DEFAULT), "checkpoint: could not delete dataset.") ;
+        }
+    }
+
+    static void close(herr_t const status)
+    {
+        detail::h5_check(status, "checkpoint: could not release an HDF5 handle.") ;
+    }
+
+    void write_int_attribute(hid_t obj, const char name[], int val) const
+    {
+        hid_t space = detail::h5_check(H5Screate(H5S_SCALAR), "checkpoint: could not create the attribute space.") ;
+        hid_t attr  = detail::h5_check( H5Acreate2(obj, name, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT)
+                                      , "checkpoint: could not create attribute." ) ;
+        detail::h5_check(H5Awrite(attr, H5T_NATIVE_INT, &val), "checkpoint: could not write attribute.") ;
+        close(H5Aclose(attr)) ; close(H5Sclose(space)) ;
+    }
+
+    int read_int_attribute(hid_t obj, const char name[]) const
+    {
+        int val{-1} ;
+        hid_t attr = detail::h5_check(H5Aopen(obj, name, H5P_DEFAULT), "checkpoint: attribute not found.") ;
+        detail::h5_check(H5Aread(attr, H5T_NATIVE_INT, &val), "checkpoint: could not read attribute.") ;
+        close(H5Aclose(attr)) ;
+        return val ;
+    }
+
+    hid_t    _file        ; //!< HDF5 file handle
+    MPI_Comm _comm        ; //!< Communicator sharing the file
+    int      _rank, _size ; //!< Rank and size of the communicator
+    bool     _write       ; //!< Whether the file was opened for writing
+    size_t   _chunk_bytes ; //!< Target chunk size in bytes
+} ;
+
+}} /* namespace skl::io */
+
+#endif /* SKL_ENABLE_HDF5 */
+
+#endif /* SKL_IO_CHECKPOINT_HH */
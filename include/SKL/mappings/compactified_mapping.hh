@@ -0,0 +1,74 @@
+/**
+ * @file compactified_mapping.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Algebraic compactification of a semi-infinite domain.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_MAPPINGS_COMPACTIFIED_MAPPING_HH
+#define SKL_MAPPINGS_COMPACTIFIED_MAPPING_HH
+
+#include <SKL_config.h>
+
+#include <SKL/mappings/coordinate_mapping.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Algebraic compactification of [x0, inf) onto [-1,1].
+ * \ingroup mappings
+ * 
+ * x(xi) = x0 + L (1+xi)/(1-xi). Half of the points lie in 
+ * [x0, x0+L], xi = 1 is mapped to infinity where the metric 
+ * factors vanish. The inverse is written as 1 - 2L/(x-x0+L) 
+ * so that it can be evaluated at x = inf.
+ */
+class compactified_coordinate_mapping 
+ : public coordinate_mapping<compactified_coordinate_mapping> 
+{
+ public:
+    compactified_coordinate_mapping( SKL_REAL const _x0, SKL_REAL const _L )
+     : x0(_x0), L(_L)
+    {} 
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    log_to_phys(T const& xl ) const {
+        return x0 + L * (1. + xl) / (1. - xl) ; 
+    }
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    phys_to_log(T const& xp ) const {
+        return 1. - 2. * L / (xp - x0 + L) ; 
+    }   
+
+ private: 
+    SKL_REAL x0, L ; 
+} ; 
+
+}
+
+#endif
@@ -33,6 +33,9 @@
 #include <SKL/utils/device.h>
 #include <SKL/utils/inline.h>
 
+#include <Kokkos_Core.hpp>
+#include <Sacado.hpp>
+
 namespace skl {
 
 
@@ -54,6 +57,99 @@ class coordinate_mapping
         return static_cast<deriv_t const *> ( this ) ->template log_to_phys<T>(xp) ; 
     }
 
+    /**
+     * @brief Derivatives of the logical coordinate with respect to 
+     *        the physical one.
+     * 
+     * The derivatives are obtained by evaluating the mapping in 
+     * nested forward mode AD, they are therefore exact for any
+     * derived mapping.
+     * 
+     * @tparam T Scalar type.
+     * @param xp Physical coordinate.
+     * @param dxi_dx   First derivative of the logical coordinate.
+     * @param d2xi_dx2 Second derivative of the logical coordinate.
+     */
+    template< typename T >
+    void SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    metric (T const& xp, T& dxi_dx, T& d2xi_dx2) const {
+        using fad1_t = Sacado::Fad::SFad<T,1>      ; 
+        using fad2_t = Sacado::Fad::SFad<fad1_t,1> ; 
+        fad2_t const x(1, 0, fad1_t(1, 0, xp)) ; 
+        fad2_t const xi = static_cast<deriv_t const *> ( this ) ->template phys_to_log<fad2_t>(x) ; 
+        dxi_dx   = xi.val().dx(0) ; 
+        d2xi_dx2 = xi.dx(0).dx(0) ;
+    }
+
+    /**
+     * @brief Derivatives of the logical coordinate with respect to
+     *        the physical one, evaluated at a logical coordinate.
+     * 
+     * The derivatives x'(xi) and x''(xi) of the inverse mapping are 
+     * obtained with nested forward mode AD and inverted, 
+     * dxi/dx = 1/x' and d2xi/dx2 = -x''/x'^3. This form stays 
+     * well defined at logical points which are mapped to infinity
+     * by compactifying mappings, where both factors vanish.
+     * 
+     * @tparam T Scalar type.
+     * @param xi Logical coordinate.
+     * @param dxi_dx   First derivative of the logical coordinate.
+     * @param d2xi_dx2 Second derivative of the logical coordinate.
+     */
+    template< typename T >
+    void SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    metric_logical (T const& xi, T& dxi_dx, T& d2xi_dx2) const {
+        using fad1_t = Sacado::Fad::SFad<T,1>      ; 
+        using fad2_t = Sacado::Fad::SFad<fad1_t,1> ; 
+        fad2_t const l(1, 0, fad1_t(1, 0, xi)) ; 
+        fad2_t const x = static_cast<deriv_t const *> ( this ) ->template log_to_phys<fad2_t>(l) ; 
+        T const x1 = x.val().dx(0) ; 
+        T const x2 = x.dx(0).dx(0) ; 
+        if( Kokkos::isfinite(x1) and Kokkos::isfinite(x2) and x1 != 0 ) {
+            dxi_dx   = 1. / x1 ; 
+            d2xi_dx2 = - x2 / (x1*x1*x1) ; 
+        } else {
+            dxi_dx   = 0. ; 
+            d2xi_dx2 = 0. ; 
+        }
+    }
+
+    /**
+     * @brief Map a View of physical coordinates to logical coordinates
+     *        in a single kernel.
+     * 
+     * @param xp Physical coordinates.
+     * @param xl Logical coordinates (output).
+     */
+    template< typename in_view_t, typename out_view_t >
+    void apply(in_view_t const& xp, out_view_t const& xl) const {
+        using T = typename out_view_t::non_const_value_type ; 
+        deriv_t const map = *static_cast<deriv_t const *> ( this ) ; 
+        Kokkos::parallel_for("coordinate_mapping::apply", xp.extent(0)
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                xl(i) = map.template phys_to_log<T>(xp(i)) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Map a View of logical coordinates to physical coordinates
+     *        in a single kernel.
+     * 
+     * @param xl Logical coordinates.
+     * @param xp Physical coordinates (output).
+     */
+    template< typename in_view_t, typename out_view_t >
+    void apply_inverse(in_view_t const& xl, out_view_t const& xp) const {
+        using T = typename out_view_t::non_const_value_type ; 
+        deriv_t const map = *static_cast<deriv_t const *> ( this ) ; 
+        Kokkos::parallel_for("coordinate_mapping::apply_inverse", xl.extent(0)
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                xp(i) = map.template log_to_phys<T>(xl(i)) ; 
+            }) ; 
+    }
+
 } ; 
 
 }
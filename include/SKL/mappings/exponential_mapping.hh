@@ -0,0 +1,78 @@
+/**
+ * @file exponential_mapping.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Exponential mapping clustering points close to one boundary.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_MAPPINGS_EXPONENTIAL_MAPPING_HH
+#define SKL_MAPPINGS_EXPONENTIAL_MAPPING_HH
+
+#include <SKL_config.h>
+
+#include <SKL/mappings/coordinate_mapping.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Exponential stretching of [a,b].
+ * \ingroup mappings
+ * 
+ * x(xi) = a + (b-a) (exp(alpha (xi+1)/2) - 1) / (exp(alpha) - 1).
+ * For alpha > 0 points cluster towards a, for alpha < 0 towards b.
+ */
+class exponential_coordinate_mapping 
+ : public coordinate_mapping<exponential_coordinate_mapping> 
+{
+ public:
+    exponential_coordinate_mapping( SKL_REAL const _a, SKL_REAL const _b, SKL_REAL const _alpha )
+     : a(_a), alpha(_alpha), alphai(1./_alpha)
+    {
+        SKL_REAL const e = Kokkos::expm1(_alpha) ; 
+        c  = (_b - _a) / e ; 
+        ci = 1. / c ; 
+    } 
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    log_to_phys(T const& xl ) const {
+        using Kokkos::exp ; 
+        return a + c * ( exp(0.5 * alpha * (xl + 1.)) - 1. ) ; 
+    }
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    phys_to_log(T const& xp ) const {
+        using Kokkos::log ; 
+        return 2. * alphai * log( 1. + (xp - a) * ci ) - 1. ; 
+    }   
+
+ private: 
+    SKL_REAL a, alpha, alphai, c, ci ; 
+} ; 
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @file kosloff_tal_ezer_mapping.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Kosloff-Tal-Ezer mapping of the Chebyshev nodes.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_MAPPINGS_KOSLOFF_TAL_EZER_MAPPING_HH
+#define SKL_MAPPINGS_KOSLOFF_TAL_EZER_MAPPING_HH
+
+#include <SKL_config.h>
+
+#include <SKL/mappings/coordinate_mapping.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Kosloff-Tal-Ezer mapping onto [a,b].
+ * \ingroup mappings
+ * 
+ * y(xi) = asin(alpha xi) / asin(alpha), x = a + (b-a)(y+1)/2.
+ * For alpha -> 0 this is the identity, for alpha -> 1 the 
+ * Chebyshev nodes are mapped to nearly equispaced points. 
+ * This removes the O(1/N^2) clustering at the boundaries and
+ * gives a more uniform resolution in the interior.
+ */
+class kosloff_tal_ezer_coordinate_mapping 
+ : public coordinate_mapping<kosloff_tal_ezer_coordinate_mapping> 
+{
+ public:
+    kosloff_tal_ezer_coordinate_mapping( SKL_REAL const _a, SKL_REAL const _b, SKL_REAL const _alpha )
+     : a(_a), h(0.5*(_b-_a)), hi(1./h), alpha(_alpha), alphai(1./_alpha)
+     , s(Kokkos::asin(_alpha)), si(1./s)
+    {} 
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    log_to_phys(T const& xl ) const {
+        using Kokkos::asin ; 
+        return a + h * ( asin(alpha * xl) * si + 1. ) ; 
+    }
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    phys_to_log(T const& xp ) const {
+        using Kokkos::sin ; 
+        return sin( ((xp - a) * hi - 1.) * s ) * alphai ; 
+    }   
+
+ private: 
+    SKL_REAL a, h, hi, alpha, alphai, s, si ; 
+} ; 
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file mapped_grid.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Collocation grid with cached metric terms of a coordinate mapping.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_MAPPINGS_MAPPED_GRID_HH
+#define SKL_MAPPINGS_MAPPED_GRID_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/mappings/coordinate_mapping.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Collocation grid in physical space.
+ * \ingroup mappings
+ * 
+ * Holds the logical collocation points, their physical image 
+ * under a coordinate mapping and the metric factors 
+ * dxi/dx and d2xi/dx2, all computed on device in a single 
+ * kernel when the grid is constructed. Spectral derivative
+ * kernels read the metric factors from here, so that the
+ * chain rule costs one fused multiply per point.
+ * 
+ * @tparam mapping_t Type of the coordinate mapping.
+ */
+template< typename mapping_t >
+class mapped_grid 
+{
+ public:
+    using view_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ; 
+
+    /**
+     * @brief Construct the grid.
+     * 
+     * @param map Coordinate mapping.
+     * @param xi  Logical collocation points.
+     */
+    mapped_grid( mapping_t const& map, view_t const& xi ) 
+     : _map(map), _xi(xi)
+     , _x("mapped_grid_x", xi.extent(0))
+     , _dxi_dx("mapped_grid_dxi_dx", xi.extent(0))
+     , _d2xi_dx2("mapped_grid_d2xi_dx2", xi.extent(0))
+    {
+        auto x = _x ; auto d1 = _dxi_dx ; auto d2 = _d2xi_dx2 ; auto const m = _map ; 
+        Kokkos::parallel_for("mapped_grid::compute_metric", xi.extent(0)
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                x(i) = m.template log_to_phys<SKL_REAL>(xi(i)) ; 
+                m.metric_logical(xi(i), d1(i), d2(i)) ; 
+            }) ; 
+    }
+
+    size_t size() const { return _xi.extent(0) ; }
+
+    mapping_t const& mapping() const { return _map ; }
+    view_t logical()  const { return _xi ; }
+    view_t physical() const { return _x  ; }
+    view_t dxi_dx()   const { return _dxi_dx ; }
+    view_t d2xi_dx2() const { return _d2xi_dx2 ; }
+
+ private:
+    mapping_t _map ; //!< Coordinate mapping
+    view_t _xi     ; //!< Logical collocation points
+    view_t _x      ; //!< Physical collocation points
+    view_t _dxi_dx, _d2xi_dx2 ; //!< Metric factors at the collocation points
+} ; 
+
+}
+
+#endif /* SKL_MAPPINGS_MAPPED_GRID_HH */
@@ -0,0 +1,83 @@
+/**
+ * @file sinh_mapping.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Sinh stretching mapping clustering points around an interior location.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_MAPPINGS_SINH_MAPPING_HH
+#define SKL_MAPPINGS_SINH_MAPPING_HH
+
+#include <SKL_config.h>
+
+#include <SKL/mappings/coordinate_mapping.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Sinh stretching of [a,b] around xc.
+ * \ingroup mappings
+ * 
+ * x(xi) = xc + sinh( (A-B)/2 (xi-1) + A ) / beta, with
+ * A = asinh(beta (b-xc)) and B = asinh(beta (a-xc)). 
+ * Larger values of beta concentrate more points close to xc, 
+ * which is suited to resolve interior and boundary layers 
+ * (xc = a or xc = b).
+ */
+class sinh_coordinate_mapping 
+ : public coordinate_mapping<sinh_coordinate_mapping> 
+{
+ public:
+    sinh_coordinate_mapping( SKL_REAL const _a, SKL_REAL const _b, SKL_REAL const _xc, SKL_REAL const _beta )
+     : xc(_xc), beta(_beta), betai(1./_beta)
+    {
+        A = Kokkos::asinh(beta * (_b - xc)) ; 
+        B = Kokkos::asinh(beta * (_a - xc)) ; 
+        h  = 0.5 * (A - B) ; 
+        hi = 1. / h ; 
+    } 
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    log_to_phys(T const& xl ) const {
+        using Kokkos::sinh ; 
+        return xc + sinh( h * (xl - 1.) + A ) * betai ; 
+    }
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    phys_to_log(T const& xp ) const {
+        using Kokkos::log ; using Kokkos::sqrt ; 
+        T const y = beta * (xp - xc) ; 
+        return 1. + ( log(y + sqrt(y*y + 1.)) - A ) * hi ; 
+    }   
+
+ private: 
+    SKL_REAL xc, beta, betai, A, B, h, hi ; 
+} ; 
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @file tan_mapping.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Tangent compactification of the real line.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_MAPPINGS_TAN_MAPPING_HH
+#define SKL_MAPPINGS_TAN_MAPPING_HH
+
+#include <SKL_config.h>
+
+#include <SKL/mappings/coordinate_mapping.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Compactification of (-inf, inf) onto [-1,1].
+ * \ingroup mappings
+ * 
+ * x(xi) = x0 + L tan(pi xi / 2). Half of the points lie 
+ * within a distance L of x0, the endpoints xi = -1,1 are mapped
+ * to -inf and inf where the metric factors vanish. The cosine
+ * is evaluated as sin(pi (1-|xi|) / 2), which is exactly zero at
+ * the endpoints: tan(pi/2) in floating point would instead place
+ * them at a finite x0 +- 1.6e16 L.
+ */
+class tan_coordinate_mapping 
+ : public coordinate_mapping<tan_coordinate_mapping> 
+{
+ public:
+    tan_coordinate_mapping( SKL_REAL const _x0, SKL_REAL const _L )
+     : x0(_x0), L(_L), Li(1./_L)
+    {} 
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    log_to_phys(T const& xl ) const {
+        using Kokkos::sin ; using Kokkos::abs ; 
+        return x0 + L * sin( 0.5 * M_PI * xl ) / sin( 0.5 * M_PI * (1. - abs(xl)) ) ; 
+    }
+
+    template < typename T>
+    T SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    phys_to_log(T const& xp ) const {
+        using Kokkos::atan ; 
+        return M_2_PI * atan( (xp - x0) * Li ) ; 
+    }   
+
+ private: 
+    SKL_REAL x0, L, Li ; 
+} ; 
+
+}
+
+#endif
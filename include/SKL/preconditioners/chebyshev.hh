@@ -0,0 +1,326 @@
+/**
+ * @file chebyshev.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Chebyshev polynomial preconditioner and smoother.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_PRECONDITIONERS_CHEBYSHEV_HH
+#define SKL_PRECONDITIONERS_CHEBYSHEV_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include <Sacado.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Chebyshev polynomial preconditioner and smoother.
+ * \ingroup preconditioners
+ *
+ * Approximates J(x)^{-1} r by <code>degree</code> steps of the 
+ * Chebyshev iteration on the interval [lambda_min, lambda_max]. 
+ * Applying it costs degree-1 Jacobian-vector products and a few 
+ * vector updates, but no inner products, so no global reductions 
+ * or host synchronizations are needed.
+ *
+ * The interval is estimated in update() from the Ritz values of a 
+ * short Arnoldi process ( the eigenvalues of its Hessenberg matrix ),
+ * using the real parts: lambda_max is enlarged by a safety factor 
+ * since eigenvalues above the interval are amplified, while 
+ * eigenvalues below lambda_min are only damped less. With 
+ * set_eigenvalue_ratio() the interval becomes 
+ * [lambda_max / ratio, lambda_max], which targets the upper part of
+ * the spectrum as needed by a multigrid smoother. The spectrum of 
+ * J(x) is assumed to lie in the right half plane. If an inverse 
+ * diagonal is set, the polynomial is built for D^{-1} J instead
+ * ( Jacobi scaled Chebyshev ), which moves the spectrum of operators
+ * such as collocated second derivatives, whose boundary rows have 
+ * the opposite sign of the interior ones, to the right half plane.
+ *
+ * The polynomial depends on the interval only, so the operator is 
+ * fixed between two calls to update() and the preconditioner can be
+ * used with skl::gmres ( which is flexible ), skl::bicgstab and, for 
+ * symmetric positive definite Jacobians, skl::cg. The residual and 
+ * the state passed to update() are referenced, not copied, and must
+ * outlive the preconditioner's use.
+ *
+ * @tparam res_t Type of the residual providing <code>jvp(x, v, Jv)</code>.
+ */
+template< typename res_t >
+class chebyshev_preconditioner
+{
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    /**
+     * @brief Construct the preconditioner.
+     *
+     * @param problem_size  Number of unknowns.
+     * @param degree        Number of Chebyshev steps per application.
+     * @param arnoldi_steps Arnoldi steps used to estimate the spectrum.
+     */
+    chebyshev_preconditioner( size_t problem_size, size_t degree, size_t arnoldi_steps = 10 )
+     : _N(problem_size), _degree(degree), _arnoldi_steps(arnoldi_steps)
+     , w("chebyshev_w", _N), d("chebyshev_d", _N), Ad("chebyshev_Ad", _N)
+     , s("chebyshev_s", _N), e("chebyshev_e", _N)
+    {
+        if constexpr ( not detail::plain_directions<res_t> ) {
+            Kokkos::realloc(v_seed,  _N, 2) ;
+            Kokkos::realloc(jv_seed, _N, 2) ;
+        }
+    }
+
+    /**
+     * @brief Set the operator to J(x) and estimate its spectrum.
+     */
+    void update(res_t& res, vector_t const& x) {
+        update(exec_space(), res, x) ;
+    }
+
+    void update(exec_space const& space, res_t& res, vector_t const& x) {
+        _res = &res ;
+        _x   = x ;
+        if( _dinv_pending ) {
+            _dinv = _dinv_next ;
+            _dinv_next = plain_t() ;
+            _dinv_pending = false ;
+        }
+        bool const fence = not (space == exec_space()) ;
+        detail::linearize_if_supported(space, fence, res, x) ;
+        estimate_spectrum(space, fence) ;
+        _updates++ ;
+    }
+
+    /**
+     * @brief Override the interval, e.g. with known bounds.
+     */
+    void set_bounds(SKL_REAL lambda_min, SKL_REAL lambda_max) {
+        _lmin = lambda_min ;
+        _lmax = lambda_max ;
+    }
+
+    /**
+     * @brief Restrict the interval to [lambda_max / ratio, lambda_max]
+     *        on the next update(); ratio <= 0 restores the estimate 
+     *        of lambda_min.
+     */
+    void set_eigenvalue_ratio(SKL_REAL ratio) { _ratio = ratio ; }
+
+    //! Safety factor applied to the estimate of lambda_max
+    void set_boost_factor(SKL_REAL boost) { _boost = boost ; }
+
+    /**
+     * @brief Use D^{-1} J as operator, taking effect on the next 
+     *        update(). An empty View disables the scaling.
+     * 
+     * Until then apply() keeps the scaling the current interval was 
+     * estimated for.
+     */
+    void set_inverse_diagonal(plain_t const& dinv) { 
+        _dinv_next = dinv ; 
+        _dinv_pending = true ; 
+    }
+
+    template< typename r_t, typename z_t >
+    void apply(r_t const& r, z_t const& z) const {
+        apply(exec_space(), r, z) ;
+    }
+
+    /**
+     * @brief z = p(J) r with the Chebyshev polynomial p, starting 
+     *        from a zero initial guess.
+     */
+    template< typename r_t, typename z_t >
+    void apply(exec_space const& space, r_t const& r, z_t const& z) const {
+        using namespace Kokkos ;
+        if( _res == nullptr ) {
+            Kokkos::abort("chebyshev_preconditioner: update() must be called before apply().") ;
+        }
+        bool const fence = not (space == exec_space()) ;
+        SKL_REAL const theta = 0.5 * (_lmax + _lmin) ;
+        SKL_REAL const delta = 0.5 * (_lmax - _lmin) ;
+        SKL_REAL const sigma = theta / delta ;
+        SKL_REAL rho = 1. / sigma ;
+
+        auto _w = w ; auto _d = d ; auto _Ad = Ad ; auto dinv = _dinv ;
+        bool const scaled = _dinv.extent(0) > 0 ;
+        RangePolicy<exec_space> policy(space, 0, _N) ;
+        parallel_for("chebyshev::init", policy, KOKKOS_LAMBDA (int i)
+            {
+                _w(i) = scaled ? dinv(i) * r(i) : r(i) ;
+                _d(i) = _w(i) / theta ;
+                z(i)  = _d(i) ;
+            }) ;
+        for( size_t k=1; k<_degree; ++k) {
+            detail::plain_jvp(space, fence, *_res, _x, d, Ad, v_seed, jv_seed) ;
+            SKL_REAL const rho_new = 1. / (2. * sigma - rho) ;
+            SKL_REAL const c1 = rho_new * rho ;
+            SKL_REAL const c2 = 2. * rho_new / delta ;
+            parallel_for("chebyshev::step", policy, KOKKOS_LAMBDA (int i)
+                {
+                    _w(i) -= scaled ? dinv(i) * _Ad(i) : _Ad(i) ;
+                    _d(i)  = c1 * _d(i) + c2 * _w(i) ;
+                    z(i)  += _d(i) ;
+                }) ;
+            rho = rho_new ;
+        }
+    }
+
+    /**
+     * @brief Smoothing step z <- z + p(J) ( b - J z ) for a non zero 
+     *        initial guess z.
+     */
+    template< typename b_t, typename z_t >
+    void smooth(exec_space const& space, b_t const& b, z_t const& z) const {
+        using namespace Kokkos ;
+        bool const fence = not (space == exec_space()) ;
+        auto _s = s ; auto _e = e ; auto _Ad = Ad ;
+        RangePolicy<exec_space> policy(space, 0, _N) ;
+        parallel_for("chebyshev::copy_guess", policy, KOKKOS_LAMBDA (int i) { _s(i) = z(i) ; }) ;
+        detail::plain_jvp(space, fence, *_res, _x, s, Ad, v_seed, jv_seed) ;
+        parallel_for("chebyshev::smoother_residual", policy, KOKKOS_LAMBDA (int i) { _s(i) = b(i) - _Ad(i) ; }) ;
+        apply(space, s, e) ;
+        parallel_for("chebyshev::correct", policy, KOKKOS_LAMBDA (int i) { z(i) += _e(i) ; }) ;
+    }
+
+    template< typename b_t, typename z_t >
+    void smooth(b_t const& b, z_t const& z) const {
+        smooth(exec_space(), b, z) ;
+    }
+
+    SKL_REAL lambda_min() const { return _lmin ; }
+    SKL_REAL lambda_max() const { return _lmax ; }
+    size_t degree()       const { return _degree ; }
+    size_t updates()      const { return _updates ; }
+
+ private:
+    using host_matrix_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::HostSpace> ;
+
+    /**
+     * @brief Run a few Arnoldi steps and set the interval from the 
+     *        real parts of the Ritz values.
+     */
+    void estimate_spectrum(exec_space const& space, bool fence) {
+        using namespace Kokkos ;
+        static constexpr SKL_REAL eps = 1e-12 ;
+        size_t const m = std::min(_arnoldi_steps, _N) ;
+        Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> Q("chebyshev_Q", _N, m+1) ;
+        host_matrix_t H("chebyshev_H", m+1, m) ;
+
+        // Deterministic start vector with components along all modes
+        auto q0 = subview(Q, ALL(), 0) ;
+        parallel_for("chebyshev::start_vector", RangePolicy<exec_space>(space, 0, _N)
+                    , KOKKOS_LAMBDA (int i) { q0(i) = 1. + 0.5 * Kokkos::sin(1.3 * i) ; }) ;
+        utils::linalg::scal(space, q0, 1./utils::linalg::nrm2(space, q0), q0) ;
+
+        size_t n { 0 } ;
+        for( ; n<m; ++n) {
+            auto q = subview(Q, ALL(), n) ;
+            auto v = subview(Q, ALL(), n+1) ;
+            detail::plain_jvp(space, fence, *_res, _x, q, v, v_seed, jv_seed) ;
+            if( _dinv.extent(0) > 0 ) {
+                auto dinv = _dinv ;
+                parallel_for("chebyshev::scale", RangePolicy<exec_space>(space, 0, _N)
+                            , KOKKOS_LAMBDA (int i) { v(i) *= dinv(i) ; }) ;
+            }
+            for( size_t j=0; j<=n; ++j) {
+                auto qj = subview(Q, ALL(), j) ;
+                H(j,n) = utils::linalg::dot(space, qj, v) ;
+                utils::linalg::axpy(space, -H(j,n), qj, v) ;
+            }
+            H(n+1,n) = utils::linalg::nrm2(space, v) ;
+            if( H(n+1,n) < eps ) {
+                ++n ;
+                break ; // invariant subspace
+            }
+            utils::linalg::scal(space, v, 1./H(n+1,n), v) ;
+        }
+
+        // Ritz values: eigenvalues of the leading n x n block
+        int const nn = n ;
+        host_matrix_t A("chebyshev_A", nn, nn) ;
+        for( int j=0; j<nn; ++j) for( int i=0; i<nn; ++i) A(i,j) = H(i,j) ;
+        std::vector<SKL_REAL> wr(nn), wi(nn), work(4*nn + 16) ;
+        SKL_REAL vdummy ;
+        int info ;
+        Teuchos::LAPACK<int, SKL_REAL> lapack ;
+        lapack.GEEV( 'N', 'N', nn, A.data(), nn, wr.data(), wi.data()
+                   , &vdummy, 1, &vdummy, 1, work.data(), work.size(), &info ) ;
+        if( info != 0 ) {
+            Kokkos::abort("chebyshev_preconditioner: eigenvalue estimate failed.") ;
+        }
+        SKL_REAL re_min = std::numeric_limits<SKL_REAL>::max(), re_max = 0. ;
+        for( int i=0; i<nn; ++i) {
+            re_min = std::min(re_min, wr[i]) ;
+            re_max = std::max(re_max, wr[i]) ;
+        }
+        if( not (re_max > 0) ) {
+            Kokkos::abort("chebyshev_preconditioner: the spectrum is not in the right half plane.") ;
+        }
+        _lmax = _boost * re_max ;
+        if( _ratio > 0 ) {
+            _lmin = _lmax / _ratio ;
+        } else {
+            // Ritz values converge to the extremal eigenvalues from 
+            // inside, keep the estimate away from zero and below lambda_max
+            _lmin = std::clamp(re_min, _lmax * min_ratio, _lmax * 0.9) ;
+        }
+    }
+
+    static constexpr SKL_REAL min_ratio = 1e-6 ; //!< Smallest admissible lambda_min / lambda_max
+
+    size_t _N             ; //!< Number of unknowns
+    size_t _degree        ; //!< Chebyshev steps per application
+    size_t _arnoldi_steps ; //!< Arnoldi steps of the spectrum estimate
+    size_t _updates { 0 } ; //!< Number of calls to update()
+    SKL_REAL _lmin { 1. }, _lmax { 2. } ; //!< Interval of the polynomial
+    SKL_REAL _ratio { 0. }  ; //!< Fixed lambda_max / lambda_min, if positive
+    SKL_REAL _boost { 1.1 } ; //!< Safety factor on lambda_max
+    res_t* _res { nullptr } ; //!< Residual defining the operator
+    vector_t _x             ; //!< State the operator is linearized at
+    plain_t w, d, Ad        ; //!< Chebyshev residual, step and J step
+    plain_t s, e            ; //!< Smoother residual and correction
+    plain_t _dinv           ; //!< Optional inverse diagonal ( Jacobi scaling )
+    plain_t _dinv_next      ; //!< Inverse diagonal set for the next update()
+    bool _dinv_pending { false } ; //!< Whether _dinv_next replaces _dinv on update()
+    vector_t v_seed, jv_seed ; //!< Fad directions for residuals without plain_directions
+} ;
+
+}
+
+#endif /* SKL_PRECONDITIONERS_CHEBYSHEV_HH */
@@ -0,0 +1,94 @@
+/**
+ * @file frozen_jacobian.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Preconditioner applying the LU of a previously assembled Jacobian.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_PRECONDITIONERS_FROZEN_JACOBIAN_HH
+#define SKL_PRECONDITIONERS_FROZEN_JACOBIAN_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/solvers/jacobian.hh>
+#include <SKL/solvers/direct.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Frozen Jacobian preconditioner.
+ * \ingroup preconditioners
+ * 
+ * Holds the LU factorization of J(x0) for some earlier state x0 
+ * and applies it as M^{-1} = J(x0)^{-1}. As long as the state does
+ * not move far from x0 this keeps Krylov iteration counts small 
+ * while the Jacobian is only assembled on update().
+ * 
+ * @tparam k Number of tangent directions per residual evaluation.
+ */
+template< size_t k = 8 >
+class frozen_jacobian_preconditioner 
+{
+ public:
+    frozen_jacobian_preconditioner( jacobian_pattern const& pattern ) 
+     : _direct(pattern), _updates(0)
+    {}
+
+    /**
+     * @brief Assemble and factor the Jacobian at x.
+     */
+    template< typename res_t, typename x_t >
+    void update(res_t& res, x_t const& x) {
+        _direct.factor(res, x) ; 
+        _updates++ ; 
+    }
+
+    template< typename r_t, typename z_t >
+    void apply(r_t const& r, z_t const& z) const {
+        if( not _direct.factored() ) {
+            Kokkos::abort("frozen_jacobian_preconditioner: update() must be called before apply().") ; 
+        }
+        _direct.apply(r, z) ; 
+    }
+
+    template< typename exec_t, typename r_t, typename z_t >
+    void apply(exec_t const& space, r_t const& r, z_t const& z) const {
+        if( not _direct.factored() ) {
+            Kokkos::abort("frozen_jacobian_preconditioner: update() must be called before apply().") ; 
+        }
+        _direct.apply(space, r, z) ; 
+    }
+
+    size_t updates() const { return _updates ; }
+
+ private:
+    direct_solver<k> _direct ; //!< Stored factorization
+    size_t _updates          ; //!< Number of Jacobian assemblies
+} ; 
+
+}
+
+#endif /* SKL_PRECONDITIONERS_FROZEN_JACOBIAN_HH */
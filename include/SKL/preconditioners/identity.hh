@@ -0,0 +1,63 @@
+/**
+ * @file identity.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Trivial preconditioner.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_PRECONDITIONERS_IDENTITY_HH
+#define SKL_PRECONDITIONERS_IDENTITY_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Identity preconditioner.
+ * \ingroup preconditioners
+ * 
+ * Preconditioners passed to the Krylov solvers provide 
+ * <code>prec.apply(r, z)</code>, storing an approximation of 
+ * J^{-1} r in z. Solvers detect this type and skip the 
+ * preconditioner application altogether.
+ */
+struct identity_preconditioner 
+{
+    template< typename r_t, typename z_t >
+    void apply(r_t const& r, z_t const& z) const {
+        Kokkos::deep_copy(z, r) ; 
+    }
+
+    template< typename exec_t, typename r_t, typename z_t >
+    void apply(exec_t const& space, r_t const& r, z_t const& z) const {
+        Kokkos::deep_copy(space, z, r) ; 
+    }
+} ; 
+
+}
+
+#endif /* SKL_PRECONDITIONERS_IDENTITY_HH */
@@ -0,0 +1,234 @@
+/**
+ * @file p_multigrid.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Spectral p-multigrid preconditioner.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_PRECONDITIONERS_P_MULTIGRID_HH
+#define SKL_PRECONDITIONERS_P_MULTIGRID_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/chebyshev_transfer.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/solvers/linearized_operator.hh>
+#include <SKL/solvers/jacobian.hh>
+#include <SKL/solvers/direct.hh>
+#include <SKL/preconditioners/chebyshev.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief p-multigrid V-cycle for Chebyshev collocation problems.
+ * \ingroup preconditioners
+ *
+ * The hierarchy halves the polynomial degree from level to level,
+ * N-1 -> (N-1)/2 -> ..., until fewer than <code>coarse_size</code> 
+ * points would remain. Every level rediscretizes the problem: it 
+ * holds a chebyshev_collocation, a mapped_grid and a 
+ * linearized_residual built from <code>make_pde(N_l)</code>, linearized
+ * at the state restricted from the finer level. Grid functions are 
+ * moved between levels with chebyshev_transfer ( coefficient 
+ * truncation and zero-padding ).
+ *
+ * Each level but the coarsest is smoothed with a Jacobi scaled 
+ * chebyshev_preconditioner restricted to the upper part of the 
+ * spectrum, the coarsest level is solved with the LU of its 
+ * Jacobian ( direct_solver ). apply() performs one V-cycle from a 
+ * zero initial guess, so the preconditioner is a fixed linear 
+ * operator between two calls to update() and can be passed to 
+ * skl::gmres.
+ *
+ * The residual solved by the Krylov method must describe the same 
+ * problem as <code>make_pde(N)</code> on the finest level.
+ *
+ * @tparam pde_t     Point-wise residual, see linearized_residual.
+ * @tparam mapping_t Coordinate mapping shared by all levels.
+ */
+template< typename pde_t, typename mapping_t >
+class p_multigrid_preconditioner
+{
+ public:
+    using vector_t = sfad_view_t<1> ;
+    using plain_t  = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+    using grid_t   = mapped_grid<mapping_t> ;
+    using res_t    = linearized_residual<pde_t, chebyshev_collocation, grid_t> ;
+
+    /**
+     * @brief Build the hierarchy.
+     *
+     * @tparam factory_t Callable returning the pde_t of a level given its size.
+     * @param N               Number of collocation points on the finest level.
+     * @param map             Coordinate mapping.
+     * @param make_pde        Point-wise residual factory.
+     * @param coarse_size     Minimum number of points on the coarsest level.
+     * @param smoother_degree Chebyshev steps per smoother application.
+     */
+    template< typename factory_t >
+    p_multigrid_preconditioner( size_t N, mapping_t const& map, factory_t const& make_pde
+                              , size_t coarse_size = 9, size_t smoother_degree = 4 )
+    {
+        size_t n = N ;
+        while( true ) {
+            _levels.push_back(std::make_unique<level_t>(n, map, make_pde(n), smoother_degree)) ;
+            size_t const n_coarse = (n-1) / 2 + 1 ;
+            if( n_coarse < coarse_size or n_coarse == n ) {
+                break ;
+            }
+            n = n_coarse ;
+        }
+        for( size_t l=0; l+1<_levels.size(); ++l) {
+            _transfers.emplace_back(_levels[l]->cheb, _levels[l+1]->cheb) ;
+            _levels[l]->smoother.set_eigenvalue_ratio(smoothing_ratio) ;
+        }
+        _coarse = std::make_unique<direct_solver<>>(jacobian_pattern::dense(_levels.back()->N)) ;
+    }
+
+    /**
+     * @brief Linearize all levels at x, rebuild the smoothers and 
+     *        factor the coarsest Jacobian.
+     */
+    template< typename x_t >
+    void update(x_t const& x) {
+        using namespace Kokkos ;
+        using x_value_t = typename x_t::non_const_value_type ;
+        auto xv = _levels[0]->xv ;
+        parallel_for("p_multigrid::state", _levels[0]->N
+                    , KOKKOS_LAMBDA (int i) { xv(i) = Sacado::ScalarValue<x_value_t>::eval(x(i)) ; }) ;
+        for( size_t l=0; l<_levels.size(); ++l) {
+            auto& L = *_levels[l] ;
+            if( l > 0 ) {
+                _transfers[l-1].to_coarse(_levels[l-1]->xv, L.xv) ;
+            }
+            auto _xv = L.xv ; auto _x = L.x ;
+            parallel_for("p_multigrid::seed_state", L.N
+                        , KOKKOS_LAMBDA (int i) { _x(i) = _xv(i) ; }) ;
+            L.res.linearize(L.xv) ;
+            if( l+1 < _levels.size() ) {
+                auto dinv = L.dinv ;
+                L.res.diagonal(dinv) ;
+                parallel_for("p_multigrid::invert_diagonal", L.N
+                            , KOKKOS_LAMBDA (int i) { dinv(i) = 1. / dinv(i) ; }) ;
+                L.smoother.set_inverse_diagonal(dinv) ;
+                L.smoother.update(L.res, L.x) ;
+            } else {
+                _coarse->factor(L.res, L.xv) ;
+            }
+        }
+        _updated = true ;
+    }
+
+    /**
+     * @brief One V-cycle for J z = r, starting from z = 0.
+     */
+    template< typename r_t, typename z_t >
+    void apply(r_t const& r, z_t const& z) const {
+        using namespace Kokkos ;
+        using r_value_t = typename r_t::non_const_value_type ;
+        if( not _updated ) {
+            Kokkos::abort("p_multigrid_preconditioner: update() must be called before apply().") ;
+        }
+        auto b = _levels[0]->b ;
+        parallel_for("p_multigrid::rhs", _levels[0]->N
+                    , KOKKOS_LAMBDA (int i) { b(i) = Sacado::ScalarValue<r_value_t>::eval(r(i)) ; }) ;
+        v_cycle(0) ;
+        auto z0 = _levels[0]->z ;
+        parallel_for("p_multigrid::solution", _levels[0]->N
+                    , KOKKOS_LAMBDA (int i) { z(i) = z0(i) ; }) ;
+    }
+
+    //! Number of smoothing steps before and after the coarse grid correction
+    void set_sweeps(size_t pre, size_t post) { _pre = pre ; _post = post ; }
+
+    size_t levels() const { return _levels.size() ; }
+    size_t size(size_t l) const { return _levels[l]->N ; }
+
+ private:
+    struct level_t {
+        size_t N ;
+        chebyshev_collocation cheb ;
+        grid_t grid ;
+        res_t res ;
+        chebyshev_preconditioner<res_t> smoother ;
+        vector_t x ;                 //!< Restricted state, for the smoother
+        plain_t xv ;                 //!< Values of the restricted state
+        plain_t b, z, r, e, dinv ;   //!< Rhs, solution, residual, correction and inverse diagonal
+
+        level_t( size_t n, mapping_t const& map, pde_t const& pde, size_t degree )
+         : N(n), cheb(n), grid(map, cheb.points()), res(pde, cheb, grid), smoother(n, degree)
+         , x("p_multigrid_x", n, 2), xv("p_multigrid_xv", n), b("p_multigrid_b", n)
+         , z("p_multigrid_z", n), r("p_multigrid_r", n), e("p_multigrid_e", n)
+         , dinv("p_multigrid_dinv", n)
+        {}
+    } ;
+
+    void v_cycle(size_t l) const {
+        using namespace Kokkos ;
+        auto& L = *_levels[l] ;
+        if( l+1 == _levels.size() ) {
+            _coarse->apply(L.b, L.z) ;
+            return ;
+        }
+        auto& C = *_levels[l+1] ;
+        // Pre-smoothing, the first sweep starts from zero
+        L.smoother.apply(L.b, L.z) ;
+        for( size_t s=1; s<_pre; ++s) {
+            L.smoother.smooth(L.b, L.z) ;
+        }
+        // Coarse grid correction
+        L.res.jvp(L.x, L.z, L.r) ;
+        utils::linalg::axpy(SKL_REAL{-1.}, L.b, L.r) ;
+        utils::linalg::scal(L.r, SKL_REAL{-1.}, L.r) ; // r = b - J z
+        _transfers[l].to_coarse(L.r, C.b) ;
+        v_cycle(l+1) ;
+        _transfers[l].to_fine(C.z, L.e) ;
+        utils::linalg::axpy(SKL_REAL{1.}, L.e, L.z) ;
+        for( size_t s=0; s<_post; ++s) {
+            L.smoother.smooth(L.b, L.z) ;
+        }
+    }
+
+    static constexpr SKL_REAL smoothing_ratio = 8. ; //!< Interval of the smoothers, [lambda_max/8, lambda_max]
+
+    std::vector<std::unique_ptr<level_t>> _levels ; //!< Levels, finest first
+    std::vector<chebyshev_transfer> _transfers     ; //!< Transfer between levels l and l+1
+    std::unique_ptr<direct_solver<>> _coarse       ; //!< LU of the coarsest Jacobian
+    size_t _pre { 1 }, _post { 1 } ; //!< Smoothing sweeps
+    bool _updated { false }        ; //!< Whether update() was called
+} ;
+
+}
+
+#endif /* SKL_PRECONDITIONERS_P_MULTIGRID_HH */
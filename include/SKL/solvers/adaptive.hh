@@ -0,0 +1,259 @@
+/**
+ * @file adaptive.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Newton-Krylov driver with adaptive selection of the polynomial order.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SOLVERS_ADAPTIVE_HH
+#define SKL_SOLVERS_ADAPTIVE_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/chebyshev_transfer.hh>
+#include <SKL/spectral/chop.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/linearized_operator.hh>
+#include <SKL/preconditioners/p_multigrid.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Newton-Krylov solver for Chebyshev collocation problems which
+ *        selects the number of collocation points.
+ * \ingroup solvers
+ * 
+ * Each solve() runs Newton iterations ( p-multigrid preconditioned 
+ * skl::gmres on a linearized_residual ) at the current size N, then 
+ * checks the Chebyshev coefficients of the solution with skl::chop. 
+ * If no plateau is found the solution is not resolved and N grows to
+ * 2N-1, up to a maximum. If it is resolved with a cutoff well below N,
+ * the problem is solved once more at the smallest size at which the
+ * plateau can still be detected, provided this saves at least a 
+ * quarter of the points. If that smaller solve turns out to be
+ * unresolved, the previous solution is kept. Every change of size 
+ * starts Newton from the previous solution, interpolated through its 
+ * Chebyshev coefficients ( chebyshev_transfer ), so that the re-solves
+ * typically converge in one or two Newton steps. Consecutive calls to
+ * solve(), e.g. along a parameter continuation, start from the size 
+ * and the solution of the last call.
+ * 
+ * As in p_multigrid_preconditioner the point-wise residual is built 
+ * for a given size by <code>make_pde(N)</code>.
+ * 
+ * @tparam pde_t     Point-wise residual, see linearized_residual.
+ * @tparam mapping_t Coordinate mapping.
+ */
+template< typename pde_t, typename mapping_t >
+class adaptive_solver 
+{
+ public:
+    using vector_t = sfad_view_t<1> ; 
+    using plain_t  = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ; 
+    using grid_t   = mapped_grid<mapping_t> ; 
+    using res_t    = linearized_residual<pde_t, chebyshev_collocation, grid_t> ; 
+    using prec_t   = p_multigrid_preconditioner<pde_t, mapping_t> ; 
+
+    /**
+     * @brief Construct the solver, with a zero initial guess.
+     * 
+     * @tparam factory_t Callable returning the pde_t for a given size.
+     * @param map      Coordinate mapping.
+     * @param make_pde Point-wise residual factory.
+     * @param N        Initial number of collocation points.
+     * @param tol      Relative accuracy of the Chebyshev series, see chop().
+     */
+    template< typename factory_t >
+    adaptive_solver( mapping_t const& map, factory_t const& make_pde, size_t N = 17, SKL_REAL tol = 1e-12 ) 
+     : _map(map), _make_pde(make_pde), _tol(tol)
+    {
+        _level = std::make_unique<level_t>(N, *this) ; 
+    }
+
+    //! Range of sizes the solver may select
+    void set_limits(size_t N_min, size_t N_max) { _N_min = N_min ; _N_max = N_max ; }
+
+    //! Maximum number of Newton steps per size and absolute tolerance on the residual norm
+    void set_newton(size_t max_iter, SKL_REAL tol) { _max_newton = max_iter ; _newton_tol = tol ; }
+
+    /**
+     * @brief Set the state from values at the collocation points of 
+     *        any size, which becomes the current size.
+     */
+    template< typename u_t >
+    void set_state(u_t const& u) {
+        _level = std::make_unique<level_t>(u.extent(0), *this) ; 
+        Kokkos::deep_copy(_level->uv, u) ; 
+        seed(*_level) ; 
+    }
+
+    /**
+     * @brief Solve, adapting the number of collocation points.
+     * 
+     * @return size_t Number of collocation points of the solution.
+     */
+    size_t solve() {
+        _history.clear() ; 
+        std::unique_ptr<level_t> fallback ; 
+        size_t fallback_cutoff { 0 } ; 
+        while( true ) {
+            newton(*_level) ; 
+            size_t const N = _level->N ; 
+            _history.push_back(N) ; 
+            _cutoff   = chop(coefficients(), _tol) ; 
+            _resolved = _cutoff < N ; 
+            if( _resolved ) {
+                // Smallest size at which chop still sees the plateau after the
+                // cutoff, and can see one at all, only worth a re-solve if it
+                // saves a quarter of the points
+                size_t const target = std::max({_N_min, chop_min_size, _cutoff + _cutoff / 4 + 8}) ; 
+                if( fallback or 4 * target > 3 * N ) {
+                    break ; 
+                }
+                fallback = std::move(_level) ; 
+                fallback_cutoff = _cutoff ; 
+                resize(*fallback, target) ; 
+            } else {
+                if( fallback ) {
+                    _level    = std::move(fallback) ; 
+                    _cutoff   = fallback_cutoff ; 
+                    _resolved = true ; 
+                    break ; 
+                }
+                if( N >= _N_max ) {
+                    break ; 
+                }
+                auto previous = std::move(_level) ; 
+                resize(*previous, std::min(2 * N - 1, _N_max)) ; 
+            }
+        }
+        return _level->N ; 
+    }
+
+    /**
+     * @brief Chebyshev coefficients of the current solution, on host.
+     */
+    std::vector<SKL_REAL> coefficients() const {
+        _level->cheb.to_coefficients(_level->uv, _level->c) ; 
+        auto h_c = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), _level->c) ; 
+        return std::vector<SKL_REAL>(h_c.data(), h_c.data() + h_c.extent(0)) ; 
+    }
+
+    size_t size() const { return _level->N ; }
+    //! Whether the last solve() met the accuracy target
+    bool resolved() const { return _resolved ; }
+    //! Number of coefficients needed by the current solution
+    size_t cutoff() const { return _cutoff ; }
+    //! Sizes visited by the last solve(), in order
+    std::vector<size_t> const& history() const { return _history ; }
+    //! Total number of Newton steps
+    size_t newton_steps() const { return _newton_steps ; }
+    //! Values of the solution at the collocation points
+    plain_t solution() const { return _level->uv ; }
+    plain_t points()   const { return _level->grid.physical() ; }
+
+ private:
+    struct level_t {
+        size_t N ; 
+        chebyshev_collocation cheb ; 
+        grid_t grid ; 
+        res_t res ; 
+        prec_t mg ; 
+        gmres solver ; 
+        vector_t u, r ; //!< State and residual
+        plain_t uv, c ; //!< Values and coefficients of the state
+
+        level_t( size_t n, adaptive_solver const& s ) 
+         : N(n), cheb(n), grid(s._map, cheb.points()), res(s._make_pde(n), cheb, grid)
+         , mg(n, s._map, s._make_pde), solver(n, krylov_iterations, krylov_tol, krylov_restarts)
+         , u("adaptive_u", n, 2), r("adaptive_r", n, 2), uv("adaptive_uv", n), c("adaptive_c", n)
+        {}
+    } ; 
+
+    void newton(level_t& L) {
+        for( size_t it=0; it<_max_newton; ++it) {
+            L.res.compute_residual(L.u, L.r) ; 
+            if( utils::linalg::nrm2(L.r) < _newton_tol ) {
+                break ; 
+            }
+            L.mg.update(L.u) ; 
+            L.solver.solve(L.res, L.u, L.mg) ; 
+            ++_newton_steps ; 
+        }
+        auto u = L.u ; auto uv = L.uv ; 
+        Kokkos::parallel_for("adaptive_solver::values", L.N
+                            , KOKKOS_LAMBDA (int i) { uv(i) = u(i).val() ; }) ; 
+    }
+
+    //! Make a level of size n the current one, interpolating the state of from
+    void resize(level_t const& from, size_t n) {
+        _level = std::make_unique<level_t>(n, *this) ; 
+        if( n > from.N ) {
+            chebyshev_transfer(_level->cheb, from.cheb).to_fine(from.uv, _level->uv) ; 
+        } else {
+            chebyshev_transfer(from.cheb, _level->cheb).to_coarse(from.uv, _level->uv) ; 
+        }
+        seed(*_level) ; 
+    }
+
+    //! Copy the values into the state
+    void seed(level_t& L) {
+        auto u = L.u ; auto uv = L.uv ; 
+        Kokkos::parallel_for("adaptive_solver::seed", L.N
+                            , KOKKOS_LAMBDA (int i) { u(i) = uv(i) ; }) ; 
+    }
+
+    static constexpr size_t   krylov_iterations = 40    ; //!< Krylov subspace size
+    static constexpr size_t   krylov_restarts   = 20    ; //!< Maximum number of restarts
+    static constexpr SKL_REAL krylov_tol        = 1e-10 ; //!< Relative tolerance of each linear solve
+
+    mapping_t _map ; //!< Coordinate mapping
+    std::function<pde_t(size_t)> _make_pde ; //!< Point-wise residual factory
+    SKL_REAL _tol  ; //!< Relative accuracy of the Chebyshev series
+    std::unique_ptr<level_t> _level ; //!< Current discretization and state
+    size_t _N_min { 9 }, _N_max { 513 } ; //!< Range of sizes
+    size_t _max_newton { 20 }           ; //!< Newton steps per size
+    SKL_REAL _newton_tol { 1e-10 }      ; //!< Absolute tolerance on the residual norm
+    size_t _cutoff { 0 }                ; //!< Cutoff of the current solution
+    bool _resolved { false }            ; //!< Whether the last solve() met the accuracy target
+    size_t _newton_steps { 0 }          ; //!< Total number of Newton steps
+    std::vector<size_t> _history        ; //!< Sizes visited by the last solve()
+} ; 
+
+}
+
+#endif /* SKL_SOLVERS_ADAPTIVE_HH */
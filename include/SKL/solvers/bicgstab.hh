@@ -0,0 +1,227 @@
+/**
+ * @file bicgstab.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Right preconditioned BiCGStab solver.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SOLVERS_BICGSTAB_HH
+#define SKL_SOLVERS_BICGSTAB_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+#include <SKL/preconditioners/identity.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <type_traits>
+
+namespace skl {
+
+/**
+ * @brief BiCGStab solver for the linearized residual.
+ * \ingroup solvers
+ *
+ * Same interface as skl::gmres: computes the Newton update solving
+ * J(x) dx = -F(x) for a general ( non symmetric ) Jacobian and 
+ * applies it to x, with an optional right preconditioner 
+ * <code>prec.apply(r, z)</code>. Unlike GMRES the memory footprint 
+ * does not depend on the number of iterations, at the price of two
+ * Jacobian-vector products per iteration and a less regular 
+ * convergence.
+ *
+ * The inner products are grouped so that an iteration needs three
+ * synchronizations: (r0, v), then (t, s), (t, t) and |s| fused in 
+ * one reduction, then |r| and the next (r0, r) fused in another 
+ * ( see utils::linalg::dots ). Convergence is declared when 
+ * |r| / |F(x)| < tol.
+ */
+class bicgstab {
+
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    bicgstab( size_t problem_size, size_t max_iter, SKL_REAL tol )
+     : _N(problem_size), _max_iter(max_iter), _tol(tol), _iter(0), _err(0)
+     , b("bicgstab_b", _N, 2), r("bicgstab_r", _N), r0("bicgstab_r0", _N), p("bicgstab_p", _N)
+     , v("bicgstab_v", _N), s("bicgstab_s", _N), t("bicgstab_t", _N), dx("bicgstab_dx", _N)
+    {}
+
+    /**
+     * @brief Solve the linearized system and update the state.
+     *
+     * @tparam res_t  Type of the residual.
+     * @tparam prec_t Type of the preconditioner.
+     * @param res  Residual object.
+     * @param x    State, overwritten by x + dx on exit.
+     * @param prec Right preconditioner.
+     * @return size_t Number of iterations performed.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = exec_space() ;
+        _fence = false ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space instance.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = space ;
+        _fence = true ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    size_t iterations() const { return _iter ; }
+    //! Relative residual |r| / |F(x)| at the end of the last solve
+    SKL_REAL residual() const { return _err ; }
+
+ private:
+
+    template< typename res_t, typename prec_t >
+    size_t solve_impl(res_t& res, vector_t& x, prec_t const& prec)
+    {
+        using namespace Kokkos ;
+        constexpr bool preconditioned = not std::is_same_v<prec_t, identity_preconditioner> ;
+        if constexpr ( preconditioned ) {
+            if( phat_buf.extent(0) != _N ) {
+                Kokkos::realloc(phat_buf, _N) ;
+                Kokkos::realloc(shat_buf, _N) ;
+            }
+        }
+        if constexpr ( not detail::plain_directions<res_t> ) {
+            if( v_seed.extent(0) != _N ) {
+                Kokkos::realloc(v_seed,  _N, 2) ;
+                Kokkos::realloc(jv_seed, _N, 2) ;
+            }
+        }
+        // Without preconditioner the preconditioned vectors alias p and s
+        plain_t const phat = preconditioned ? phat_buf : p ;
+        plain_t const shat = preconditioned ? shat_buf : s ;
+
+        _iter = 0 ;
+        _err  = 0 ;
+        detail::linearize_if_supported(_space, _fence, res, x) ;
+        detail::compute_residual(_space, _fence, res, x, b) ; // b = F(x)
+        utils::linalg::scal(_space, r, SKL_REAL{-1.}, b) ;     // r = -F(x), dx = 0
+        deep_copy(_space, r0, r) ;
+        auto [rho, rr] = utils::linalg::dots(_space, {r0, r, r, r}) ;
+        SKL_REAL const b_norm = Kokkos::sqrt(rr) ;
+        if( b_norm == 0 ) {
+            return 0 ;
+        }
+        deep_copy(_space, dx, 0.) ;
+        deep_copy(_space, p,  0.) ;
+        deep_copy(_space, v,  0.) ;
+
+        SKL_REAL rho_old { 1. }, alpha { 1. }, omega { 1. } ;
+        for( size_t k=0; k<_max_iter; ++k) {
+            if( rho == 0 or omega == 0 ) {
+                break ; // breakdown
+            }
+            SKL_REAL const beta = (rho / rho_old) * (alpha / omega) ;
+            // p = r + beta (p - omega v)
+            auto _p = p ; auto _r = r ; auto _v = v ;
+            parallel_for("bicgstab::direction", RangePolicy<exec_space>(_space, 0, _N)
+                        , KOKKOS_LAMBDA (int i)
+                {
+                    _p(i) = _r(i) + beta * ( _p(i) - omega * _v(i) ) ;
+                }) ;
+            apply_prec(prec, p, phat) ;
+            detail::plain_jvp(_space, _fence, res, x, phat, v, v_seed, jv_seed) ; // v = J M^-1 p
+            alpha = rho / utils::linalg::dot(_space, r0, v) ;
+            // s = r - alpha v
+            utils::linalg::scal(_space, s, SKL_REAL{1.}, r) ;
+            utils::linalg::axpy(_space, -alpha, v, s) ;
+            apply_prec(prec, s, shat) ;
+            detail::plain_jvp(_space, _fence, res, x, shat, t, v_seed, jv_seed) ; // t = J M^-1 s
+            auto const [ts, tt, ss] = utils::linalg::dots(_space, {t, s, t, t, s, s}) ;
+            _iter++ ;
+            if( Kokkos::sqrt(ss) / b_norm < _tol or tt == 0 ) {
+                utils::linalg::axpy(_space, alpha, phat, dx) ;
+                _err = Kokkos::sqrt(ss) / b_norm ;
+                break ;
+            }
+            omega = ts / tt ;
+            // dx += alpha phat + omega shat, r = s - omega t
+            auto _dx = dx ; auto _phat = phat ; auto _shat = shat ; auto _s = s ; auto _t = t ;
+            SKL_REAL const a = alpha, o = omega ;
+            parallel_for("bicgstab::update", RangePolicy<exec_space>(_space, 0, _N)
+                        , KOKKOS_LAMBDA (int i)
+                {
+                    _dx(i) += a * _phat(i) + o * _shat(i) ;
+                    _r(i)   = _s(i) - o * _t(i) ;
+                }) ;
+            rho_old = rho ;
+            auto const [rho_new, rr_new] = utils::linalg::dots(_space, {r0, r, r, r}) ;
+            rho = rho_new ;
+            _err = Kokkos::sqrt(rr_new) / b_norm ;
+            if( _err < _tol ) {
+                break ;
+            }
+        }
+
+        utils::linalg::axpy(_space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
+
+    template< typename prec_t >
+    void apply_prec(prec_t const& prec, plain_t const& in, plain_t const& out) {
+        if constexpr ( not std::is_same_v<prec_t, identity_preconditioner> ) {
+            detail::apply_preconditioner(_space, _fence, prec, in, out) ;
+        }
+    }
+
+    size_t _N        ; //!< Size of the problem to invert
+    size_t _max_iter ; //!< Maximum number of iterations
+    SKL_REAL _tol    ; //!< Relative tolerance
+    size_t _iter     ; //!< Iterations of the last solve
+    SKL_REAL _err    ; //!< Relative residual of the last solve
+    vector_t b       ; //!< F(x), in the arithmetic of the residual
+    plain_t r, r0    ; //!< Residual and shadow residual
+    plain_t p, v     ; //!< Search direction and J M^-1 p
+    plain_t s, t     ; //!< Intermediate residual and J M^-1 s
+    plain_t dx       ; //!< Update
+    plain_t phat_buf, shat_buf ; //!< Preconditioned p and s ( only allocated if needed )
+    vector_t v_seed, jv_seed   ; //!< Fad directions for residuals without plain_directions
+    exec_space _space ; //!< Execution space instance of the current solve
+    bool _fence { false } ; //!< Whether residual calls need to be ordered with _space
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_BICGSTAB_HH */
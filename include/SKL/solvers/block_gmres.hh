@@ -0,0 +1,464 @@
+/**
+ * @file block_gmres.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Block GMRES for multiple right hand sides.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_BLOCK_GMRES_HH
+#define SKL_SOLVERS_BLOCK_GMRES_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Restarted block GMRES for J(x) X = B with several right hand sides.
+ * \ingroup solvers
+ *
+ * The residual object must provide <code>res.jvp(x, v, Jv)</code> as for
+ * skl::gmres. If it also provides <code>res.block_jvp(x, V, JV)</code>
+ * acting on rank-2 Views (one column per vector) the operator is
+ * applied to the whole block in a single pass, otherwise it is applied
+ * column by column. Orthogonalization is done block-wise with
+ * utils::linalg::gemm and CholQR2, so that the work per iteration is
+ * dominated by GEMM-like kernels. If the initial block residual is 
+ * numerically rank deficient, e.g. with a zero or repeated right hand 
+ * side, the columns which have not converged are solved one at a time
+ * instead. A breakdown later in a cycle ends the cycle at the last 
+ * complete block, the solve then continues from a restart.
+ */
+class block_gmres {
+
+ public:
+    using vector_t      = sfad_view_t<1> ;
+    using exec_space    = Kokkos::DefaultExecutionSpace ;
+    using block_t       = Kokkos::View<sfad_t<1>**, Kokkos::DefaultExecutionSpace> ;
+    using host_matrix_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::HostSpace> ;
+
+    /**
+     * @brief Construct the solver.
+     *
+     * @param problem_size Size of the problem to invert.
+     * @param block_size   Number of right hand sides.
+     * @param max_iter     Number of block iterations before restart.
+     * @param tol          Relative tolerance, enforced on every right hand side.
+     * @param max_restarts Maximum number of restarts.
+     */
+    block_gmres( size_t problem_size, size_t block_size, size_t max_iter, SKL_REAL tol, size_t max_restarts = 10 )
+     : _N(problem_size), _s(block_size), _max_iter(max_iter), _max_restarts(max_restarts), _tol(tol), _iter(0)
+    {
+        Kokkos::realloc(V, _N, (_max_iter+1)*_s, 2) ;
+        Kokkos::realloc(R, _N, _s, 2) ;
+        Kokkos::realloc(S, _s, _s) ;
+        Kokkos::realloc(Rinv, _s, _s) ;
+        Kokkos::realloc(H, (_max_iter+1)*_s, _max_iter*_s) ;
+        Kokkos::realloc(Z, (_max_iter+1)*_s, _s) ;
+        Kokkos::realloc(cs, _max_iter*_s, _s) ;
+        Kokkos::realloc(sn, _max_iter*_s, _s) ;
+    }
+
+    /**
+     * @brief Solve J(x) X = B.
+     *
+     * @tparam res_t Type of the residual.
+     * @tparam b_t   Type of the rank-2 View holding the right hand sides.
+     * @tparam X_t   Type of the rank-2 View holding the solutions.
+     * @param res Residual object.
+     * @param x   State the Jacobian is evaluated at.
+     * @param B   Right hand sides, one per column.
+     * @param X   Initial guesses on entry, solutions on exit.
+     * @return size_t Number of block iterations performed.
+     */
+    template< typename res_t, typename b_t, typename X_t >
+    size_t solve(res_t& res, vector_t& x, b_t const& B, X_t const& X)
+    {
+        _space = exec_space() ;
+        _fence = false ;
+        return solve_impl(res, x, B, X) ;
+    }
+
+    /**
+     * @brief Solve J(x) X = B on an execution space instance.
+     *
+     * @param space Execution space instance all kernels are enqueued on.
+     * @see solve(res_t&, vector_t&, b_t const&, X_t const&)
+     */
+    template< typename res_t, typename b_t, typename X_t >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x, b_t const& B, X_t const& X)
+    {
+        _space = space ;
+        _fence = true ;
+        return solve_impl(res, x, B, X) ;
+    }
+
+    size_t iterations() const { return _iter ; }
+
+ private:
+
+    template< typename res_t, typename b_t, typename X_t >
+    size_t solve_impl(res_t& res, vector_t& x, b_t const& B, X_t const& X)
+    {
+        using namespace Kokkos ;
+        static_assert( b_t::rank() == 2 and X_t::rank() == 2, "block_gmres needs rank-2 right hand sides." ) ;
+        detail::linearize_if_supported(_space, _fence, res, x) ;
+
+        std::vector<SKL_REAL> b_norm(_s) ;
+        for( size_t l=0; l<_s; ++l) {
+            b_norm[l] = utils::linalg::nrm2(_space, subview(B, ALL(), l)) ;
+            if( b_norm[l] == 0 ) b_norm[l] = 1. ;
+        }
+
+        _iter = 0 ;
+        for( size_t restart=0; restart<_max_restarts; ++restart) {
+            // R = B - J X
+            apply_operator(res, x, X, R) ;
+            utils::linalg::gemm(_space, "N", "N", 1., B, identity(), -1., R) ;
+
+            SKL_REAL err { 0. } ;
+            std::vector<SKL_REAL> col_err(_s) ;
+            for( size_t l=0; l<_s; ++l) {
+                col_err[l] = utils::linalg::nrm2(_space, subview(R, ALL(), l)) / b_norm[l] ;
+                err = Kokkos::max(err, col_err[l]) ;
+            }
+            if( err < _tol ) {
+                break ;
+            }
+
+            // R = V_0 S
+            deep_copy(H, 0.) ; deep_copy(Z, 0.) ;
+            auto V0 = block(0) ;
+            deep_copy(_space, V0, R) ;
+            host_matrix_t S0("bgmres_S0", _s, _s) ;
+            if( not cholqr(V0, S0) ) {
+                // The block residual is numerically rank deficient, e.g. because 
+                // of a zero, converged or repeated right hand side: the block 
+                // Krylov space cannot be built, solve the remaining columns one 
+                // at a time. A single column only breaks down if its residual
+                // vanishes.
+                if( _s > 1 ) {
+                    solve_columns(res, x, B, X, col_err) ;
+                }
+                break ;
+            }
+            for( size_t i=0; i<_s; ++i) for( size_t j=0; j<_s; ++j) Z(i,j) = S0(i,j) ;
+
+            size_t n_blocks { 0 } ;
+            for( size_t j=0; j<_max_iter; ++j) {
+                bool const ok = block_arnoldi_iteration(res, x, j) ;
+                _iter++ ;
+                // On breakdown the subdiagonal block of column j is not known,
+                // the cycle ends with the last complete block. With a single 
+                // column the subdiagonal entry vanishes and the least-squares
+                // problem is solved exactly ( lucky breakdown ).
+                if( not ok and _s > 1 ) {
+                    break ;
+                }
+                block_givens_rotation(j) ;
+                n_blocks = j+1 ;
+
+                err = 0. ;
+                for( size_t l=0; l<_s; ++l) {
+                    SKL_REAL rl { 0. } ;
+                    for( size_t i=(j+1)*_s; i<(j+2)*_s; ++i) rl += Z(i,l)*Z(i,l) ;
+                    err = Kokkos::max(err, Kokkos::sqrt(rl) / b_norm[l]) ;
+                }
+                if( err < _tol or not ok ) {
+                    break ;
+                }
+            }
+            if( n_blocks == 0 ) {
+                // No block could be completed, deflate by solving the columns separately
+                solve_columns(res, x, B, X, col_err) ;
+                break ;
+            }
+            compute_solution(n_blocks, X) ;
+            if( err < _tol ) {
+                break ;
+            }
+        }
+        return _iter ;
+    }
+
+    /**
+     * @brief Solve the columns of J X = B which have not converged with 
+     *        block size one, through contiguous copies of the columns.
+     */
+    template< typename res_t, typename b_t, typename X_t >
+    void solve_columns(res_t& res, vector_t& x, b_t const& B, X_t const& X, std::vector<SKL_REAL> const& col_err)
+    {
+        using namespace Kokkos ;
+        using b_value_t = typename b_t::non_const_value_type ;
+        using x_value_t = typename X_t::non_const_value_type ;
+        View<b_value_t**, LayoutLeft, exec_space> Bl ;
+        View<x_value_t**, LayoutLeft, exec_space> Xl ;
+        if constexpr ( Sacado::IsFad<b_value_t>::value ) {
+            Bl = decltype(Bl)("bgmres_Bl", _N, 1, dimension_scalar(B)) ;
+        } else {
+            Bl = decltype(Bl)("bgmres_Bl", _N, 1) ;
+        }
+        if constexpr ( Sacado::IsFad<x_value_t>::value ) {
+            Xl = decltype(Xl)("bgmres_Xl", _N, 1, dimension_scalar(X)) ;
+        } else {
+            Xl = decltype(Xl)("bgmres_Xl", _N, 1) ;
+        }
+        block_gmres single(_N, 1, _max_iter, _tol, _max_restarts) ;
+        single._space = _space ;
+        single._fence = _fence ;
+        for( size_t l=0; l<_s; ++l) {
+            if( col_err[l] < _tol ) {
+                continue ;
+            }
+            parallel_for("BGMRES_column_in", RangePolicy<exec_space>(_space, 0, _N)
+                        , KOKKOS_LAMBDA (int i)
+                {
+                    Bl(i,0) = B(i,l) ;
+                    Xl(i,0) = X(i,l) ;
+                }) ;
+            _iter += single.solve_impl(res, x, Bl, Xl) ;
+            parallel_for("BGMRES_column_out", RangePolicy<exec_space>(_space, 0, _N)
+                        , KOKKOS_LAMBDA (int i)
+                {
+                    X(i,l) = Xl(i,0) ;
+                }) ;
+        }
+    }
+
+    auto block(size_t j) const {
+        return Kokkos::subview(V, Kokkos::ALL(), std::make_pair(j*_s, (j+1)*_s)) ;
+    }
+
+    /**
+     * @brief s x s identity on device, used to copy-and-scale blocks with gemm.
+     */
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> identity() {
+        if( Id.extent(0) != _s ) {
+            Kokkos::realloc(Id, _s, _s) ;
+            auto h_Id = Kokkos::create_mirror_view(Id) ;
+            for( size_t i=0; i<_s; ++i) h_Id(i,i) = 1. ;
+            Kokkos::deep_copy(Id, h_Id) ;
+        }
+        return Id ;
+    }
+
+    template< typename res_t, typename in_t, typename out_t >
+    void apply_operator(res_t& res, vector_t& x, in_t const& in, out_t const& out)
+    {
+        if constexpr (    requires { res.block_jvp(x, in, out) ; }
+                       or requires { res.block_jvp(_space, x, in, out) ; } ) {
+            detail::block_jvp(_space, _fence, res, x, in, out) ;
+        } else {
+            for( size_t l=0; l<in.extent(1); ++l) {
+                auto v  = Kokkos::subview(in,  Kokkos::ALL(), l) ;
+                auto jv = Kokkos::subview(out, Kokkos::ALL(), l) ;
+                detail::jvp(_space, _fence, res, x, v, jv) ;
+            }
+        }
+    }
+
+    /**
+     * @brief Block modified Gram-Schmidt step followed by CholQR2 of the new block.
+     *
+     * @return false on breakdown of the block QR, the subdiagonal block is then zero.
+     */
+    template< typename res_t >
+    bool block_arnoldi_iteration(res_t& res, vector_t& x, size_t j)
+    {
+        using namespace Kokkos ;
+        auto Vj = block(j)   ;
+        auto W  = block(j+1) ;
+        apply_operator(res, x, Vj, W) ;
+        for( size_t i=0; i<=j; ++i) {
+            auto Vi = block(i) ;
+            utils::linalg::gemm(_space, "T", "N", 1., Vi, W, 0., S) ;   // H_ij = V_i^T W
+            utils::linalg::gemm(_space, "N", "N", -1., Vi, S, 1., W) ;  // W = W - V_i H_ij
+            auto h_S = create_mirror_view_and_copy(HostSpace(), S) ;
+            for( size_t a=0; a<_s; ++a) for( size_t c=0; c<_s; ++c) {
+                H(i*_s+a, j*_s+c) = h_S(a,c) ;
+            }
+        }
+        host_matrix_t Rj("bgmres_Rj", _s, _s) ;
+        bool const ok = cholqr(W, Rj) ;
+        if( not ok ) {
+            Kokkos::deep_copy(Rj, 0.) ;
+        }
+        for( size_t a=0; a<_s; ++a) for( size_t c=0; c<_s; ++c) {
+            H((j+1)*_s+a, j*_s+c) = Rj(a,c) ;
+        }
+        return ok ;
+    }
+
+    /**
+     * @brief In-place CholQR2 factorization W = Q R, Q overwrites W.
+     *
+     * A column breaks down if its Cholesky pivot is below machine epsilon
+     * times its squared norm, i.e. if it makes an angle below sqrt(eps)
+     * with the span of the previous columns. CholQR cannot orthogonalize
+     * such a block accurately.
+     *
+     * @return false if the Gram matrix is numerically singular.
+     */
+    template< typename W_t >
+    bool cholqr(W_t const& W, host_matrix_t& Rtot)
+    {
+        using namespace Kokkos ;
+        for( size_t i=0; i<_s; ++i) for( size_t j=0; j<_s; ++j) Rtot(i,j) = (i==j) ;
+        host_matrix_t L("bgmres_L", _s, _s) ;
+        for( int pass=0; pass<2; ++pass) {
+            utils::linalg::gemm(_space, "T", "N", 1., W, W, 0., S) ;
+            auto h_S = create_mirror_view_and_copy(HostSpace(), S) ;
+            // Cholesky S = L L^T
+            for( size_t j=0; j<_s; ++j) {
+                SKL_REAL diag = h_S(j,j) ;
+                for( size_t l=0; l<j; ++l) diag -= L(j,l)*L(j,l) ;
+                if( diag <= std::numeric_limits<SKL_REAL>::epsilon() * h_S(j,j) ) {
+                    return false ;
+                }
+                L(j,j) = Kokkos::sqrt(diag) ;
+                for( size_t i=j+1; i<_s; ++i) {
+                    SKL_REAL v = h_S(i,j) ;
+                    for( size_t l=0; l<j; ++l) v -= L(i,l)*L(j,l) ;
+                    L(i,j) = v / L(j,j) ;
+                }
+            }
+            // W = W L^{-T}, one row per thread
+            auto h_Rinv = create_mirror_view(Rinv) ;
+            for( size_t i=0; i<_s; ++i) for( size_t j=0; j<_s; ++j) h_Rinv(i,j) = (i<=j) ? L(j,i) : 0. ;
+            deep_copy(Rinv, h_Rinv) ;
+            auto _R = Rinv ; size_t const s = _s ;
+            parallel_for("BGMRES_cholqr_solve", RangePolicy<exec_space>(_space, 0, W.extent(0))
+                        , KOKKOS_LAMBDA (int n)
+                {
+                    for( size_t j=0; j<s; ++j) {
+                        SKL_REAL w = W(n,j).val() ;
+                        for( size_t i=0; i<j; ++i) w -= W(n,i).val() * _R(i,j) ;
+                        W(n,j) = w / _R(j,j) ;
+                    }
+                }) ;
+            // Rtot = L^T Rtot
+            host_matrix_t tmp("bgmres_tmp", _s, _s) ;
+            for( size_t i=0; i<_s; ++i) for( size_t j=0; j<_s; ++j) {
+                for( size_t l=i; l<_s; ++l) tmp(i,j) += L(l,i) * Rtot(l,j) ;
+            }
+            deep_copy(Rtot, tmp) ;
+            deep_copy(L, 0.) ;
+        }
+        return true ;
+    }
+
+    /**
+     * @brief Reduce the new block column of H to upper triangular form.
+     *
+     * Each column has s subdiagonal entries, which are eliminated with
+     * s Givens rotations against the diagonal. The rotations are also
+     * applied to the least-squares rhs Z.
+     */
+    void block_givens_rotation(size_t j)
+    {
+        auto rotate = [] (SKL_REAL c, SKL_REAL s, SKL_REAL& a, SKL_REAL& b) {
+            SKL_REAL const t = c * a + s * b ;
+            b = - s * a + c * b ;
+            a = t ;
+        } ;
+        size_t const c0 = j*_s, c1 = (j+1)*_s ;
+        // Apply previous rotations to the new columns
+        for( size_t c=0; c<c0; ++c) {
+            for( size_t q=1; q<=_s; ++q) {
+                for( size_t col=c0; col<c1; ++col) {
+                    rotate(cs(c,q-1), sn(c,q-1), H(c,col), H(c+q,col)) ;
+                }
+            }
+        }
+        // Generate new rotations
+        for( size_t c=c0; c<c1; ++c) {
+            for( size_t q=1; q<=_s; ++q) {
+                SKL_REAL const a = H(c,c), b = H(c+q,c) ;
+                SKL_REAL const t = Kokkos::sqrt(a*a + b*b) ;
+                cs(c,q-1) = (t == 0) ? 1. : a/t ;
+                sn(c,q-1) = (t == 0) ? 0. : b/t ;
+                for( size_t col=c; col<c1; ++col) {
+                    rotate(cs(c,q-1), sn(c,q-1), H(c,col), H(c+q,col)) ;
+                }
+                for( size_t l=0; l<_s; ++l) {
+                    rotate(cs(c,q-1), sn(c,q-1), Z(c,l), Z(c+q,l)) ;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief X = X + V Y with H Y = Z solved by back substitution.
+     */
+    template< typename X_t >
+    void compute_solution(size_t n_blocks, X_t const& X)
+    {
+        using namespace Kokkos ;
+        size_t const n = n_blocks * _s ;
+        Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> Y("bgmres_Y", n, _s) ;
+        auto h_Y = create_mirror_view(Y) ;
+        for( size_t l=0; l<_s; ++l) {
+            for( int i=n-1; i>=0; --i) {
+                SKL_REAL v = Z(i,l) ;
+                for( size_t c=i+1; c<n; ++c) v -= H(i,c) * h_Y(c,l) ;
+                h_Y(i,l) = v / H(i,i) ;
+            }
+        }
+        deep_copy(Y, h_Y) ;
+        auto Vn = subview(V, ALL(), std::make_pair(size_t{0}, n)) ;
+        utils::linalg::gemm(_space, "N", "N", 1., Vn, Y, 1., X) ;
+    }
+
+    Kokkos::View<sfad_t<1>**, Kokkos::DefaultExecutionSpace> V ; //!< Block Krylov basis
+    block_t R                                                  ; //!< Block residual
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> S, Rinv, Id ; //!< s x s scratch
+    host_matrix_t H      ; //!< Block Hessenberg matrix ( stored on host )
+    host_matrix_t Z      ; //!< Least-squares rhs ( stored on host )
+    host_matrix_t cs, sn ; //!< Givens rotations, s per column
+
+    size_t _N            ; //!< Size of the problem to invert
+    size_t _s            ; //!< Block size
+    size_t _max_iter     ; //!< Block iterations before restart
+    size_t _max_restarts ; //!< Maximum number of restarts
+    SKL_REAL _tol        ; //!< Relative tolerance
+    size_t _iter         ; //!< Block iterations of the last solve
+    exec_space _space    ; //!< Execution space instance of the current solve
+    bool _fence { false } ; //!< Whether residual calls need to be ordered with _space
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_BLOCK_GMRES_HH */
@@ -0,0 +1,268 @@
+/**
+ * @file cg.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Preconditioned conjugate gradient solver.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SOLVERS_CG_HH
+#define SKL_SOLVERS_CG_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+#include <SKL/preconditioners/identity.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <type_traits>
+
+namespace skl {
+
+/**
+ * @brief Preconditioned conjugate gradient solver for the 
+ *        linearized residual.
+ * \ingroup solvers
+ *
+ * Same interface as skl::gmres: the Newton update dx solving 
+ * J(x) dx = -F(x) is computed from <code>res.compute_residual(x, r)</code>
+ * and <code>res.jvp(x, v, Jv)</code> and applied to x. The Jacobian
+ * and the preconditioner <code>prec.apply(r, z)</code> must be 
+ * symmetric positive definite. The work vectors are plain SKL_REAL,
+ * see skl::gmres for how directions are passed to jvp().
+ *
+ * Two variants are available:
+ *  - variant::classic: textbook PCG, two global reductions per 
+ *    iteration ( (p, Jp), then (r, z) fused with |r| ).
+ *  - variant::chronopoulos_gear: the recurrences of Chronopoulos 
+ *    and Gear, which compute J z right after the preconditioner 
+ *    and obtain the step length from (r, z) and (J z, z). All inner
+ *    products of an iteration, including |r| for the convergence 
+ *    check, are done in a single fused reduction
+ *    ( see utils::linalg::dots ), i.e. one host synchronization per
+ *    iteration, at the price of one extra vector update.
+ * Convergence is declared when |r| / |F(x)| < tol. The iteration 
+ * stops early if the curvature (p, Jp) is not positive.
+ */
+class cg {
+
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    enum class variant { classic, chronopoulos_gear } ;
+
+    cg( size_t problem_size, size_t max_iter, SKL_REAL tol, variant v = variant::chronopoulos_gear )
+     : _N(problem_size), _max_iter(max_iter), _tol(tol), _variant(v), _iter(0), _err(0)
+     , b("cg_b", _N, 2), r("cg_r", _N), w("cg_w", _N), p("cg_p", _N), s("cg_s", _N), dx("cg_dx", _N)
+    {}
+
+    /**
+     * @brief Solve the linearized system and update the state.
+     *
+     * @tparam res_t  Type of the residual.
+     * @tparam prec_t Type of the preconditioner.
+     * @param res  Residual object.
+     * @param x    State, overwritten by x + dx on exit.
+     * @param prec Symmetric positive definite preconditioner.
+     * @return size_t Number of iterations performed.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = exec_space() ;
+        _fence = false ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space instance.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = space ;
+        _fence = true ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    size_t iterations() const { return _iter ; }
+    //! Relative residual |r| / |F(x)| at the end of the last solve
+    SKL_REAL residual() const { return _err ; }
+
+ private:
+
+    template< typename res_t, typename prec_t >
+    size_t solve_impl(res_t& res, vector_t& x, prec_t const& prec)
+    {
+        using namespace Kokkos ;
+        constexpr bool preconditioned = not std::is_same_v<prec_t, identity_preconditioner> ;
+        if constexpr ( preconditioned ) {
+            if( u_buf.extent(0) != _N ) {
+                Kokkos::realloc(u_buf, _N) ;
+            }
+        }
+        if constexpr ( not detail::plain_directions<res_t> ) {
+            if( v_seed.extent(0) != _N ) {
+                Kokkos::realloc(v_seed,  _N, 2) ;
+                Kokkos::realloc(jv_seed, _N, 2) ;
+            }
+        }
+        // Without preconditioner u = r, the two share storage
+        u = preconditioned ? u_buf : r ;
+
+        _iter = 0 ;
+        _err  = 0 ;
+        detail::linearize_if_supported(_space, _fence, res, x) ;
+        detail::compute_residual(_space, _fence, res, x, b) ; // b = F(x)
+        utils::linalg::scal(_space, r, SKL_REAL{-1.}, b) ;     // r = -F(x), dx = 0
+        SKL_REAL const b_norm = utils::linalg::nrm2(_space, r) ;
+        if( b_norm == 0 ) {
+            return 0 ;
+        }
+        deep_copy(_space, dx, 0.) ;
+        deep_copy(_space, p,  0.) ;
+        deep_copy(_space, s,  0.) ;
+
+        if( _variant == variant::classic ) {
+            classic_iteration(res, x, prec, b_norm) ;
+        } else {
+            chronopoulos_gear_iteration(res, x, prec, b_norm) ;
+        }
+
+        utils::linalg::axpy(_space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
+
+    template< typename res_t, typename prec_t >
+    void classic_iteration(res_t& res, vector_t& x, prec_t const& prec, SKL_REAL b_norm)
+    {
+        apply_prec(prec, r, u) ;
+        deep_copy(_space, p, u) ;
+        SKL_REAL gamma = utils::linalg::dot(_space, r, u) ;
+        for( size_t k=0; k<_max_iter; ++k) {
+            detail::plain_jvp(_space, _fence, res, x, p, w, v_seed, jv_seed) ; // w = J p
+            SKL_REAL const delta = utils::linalg::dot(_space, p, w) ;
+            if( not (delta > 0) ) {
+                break ;
+            }
+            SKL_REAL const alpha = gamma / delta ;
+            utils::linalg::axpy(_space,  alpha, p, dx) ;
+            utils::linalg::axpy(_space, -alpha, w, r) ;
+            apply_prec(prec, r, u) ;
+            auto const [gamma_new, rr] = utils::linalg::dots(_space, {r, u, r, r}) ;
+            _iter++ ;
+            _err = Kokkos::sqrt(rr) / b_norm ;
+            if( _err < _tol ) {
+                break ;
+            }
+            SKL_REAL const beta = gamma_new / gamma ;
+            gamma = gamma_new ;
+            update_direction(p, u, beta) ; // p = u + beta p
+        }
+    }
+
+    template< typename res_t, typename prec_t >
+    void chronopoulos_gear_iteration(res_t& res, vector_t& x, prec_t const& prec, SKL_REAL b_norm)
+    {
+        using namespace Kokkos ;
+        apply_prec(prec, r, u) ;
+        detail::plain_jvp(_space, _fence, res, x, u, w, v_seed, jv_seed) ; // w = J u
+        auto [gamma, delta] = utils::linalg::dots(_space, {r, u, w, u}) ;
+        SKL_REAL gamma_old { 0. }, alpha_old { 0. } ;
+        for( size_t k=0; k<_max_iter; ++k) {
+            SKL_REAL beta { 0. }, alpha ;
+            if( k == 0 ) {
+                alpha = gamma / delta ;
+            } else {
+                beta  = gamma / gamma_old ;
+                alpha = gamma / (delta - beta * gamma / alpha_old) ;
+            }
+            // (p, J p) = gamma / alpha must be positive
+            if( not (alpha > 0) ) {
+                break ;
+            }
+            // p = u + beta p, s = w + beta s, dx += alpha p, r -= alpha s
+            auto _u = u ; auto _w = w ; auto _p = p ; auto _s = s ; auto _r = r ; auto _dx = dx ;
+            parallel_for("cg::update", RangePolicy<exec_space>(_space, 0, _N)
+                        , KOKKOS_LAMBDA (int i)
+                {
+                    _p(i)   = _u(i) + beta * _p(i) ;
+                    _s(i)   = _w(i) + beta * _s(i) ;
+                    _dx(i) += alpha * _p(i) ;
+                    _r(i)  -= alpha * _s(i) ;
+                }) ;
+            apply_prec(prec, r, u) ;
+            detail::plain_jvp(_space, _fence, res, x, u, w, v_seed, jv_seed) ;
+            gamma_old = gamma ; alpha_old = alpha ;
+            auto const [g, d, rr] = utils::linalg::dots(_space, {r, u, w, u, r, r}) ;
+            gamma = g ; delta = d ;
+            _iter++ ;
+            _err = Kokkos::sqrt(rr) / b_norm ;
+            if( _err < _tol ) {
+                break ;
+            }
+        }
+    }
+
+    template< typename prec_t >
+    void apply_prec(prec_t const& prec, plain_t const& in, plain_t const& out) {
+        if constexpr ( not std::is_same_v<prec_t, identity_preconditioner> ) {
+            detail::apply_preconditioner(_space, _fence, prec, in, out) ;
+        }
+    }
+
+    void update_direction(plain_t const& dir, plain_t const& z, SKL_REAL beta) {
+        using namespace Kokkos ;
+        auto _d = dir ; auto _z = z ;
+        parallel_for("cg::direction", RangePolicy<exec_space>(_space, 0, _N)
+                    , KOKKOS_LAMBDA (int i) { _d(i) = _z(i) + beta * _d(i) ; }) ;
+    }
+
+    size_t _N          ; //!< Size of the problem to invert
+    size_t _max_iter   ; //!< Maximum number of iterations
+    SKL_REAL _tol      ; //!< Relative tolerance
+    variant _variant   ; //!< Recurrence used
+    size_t _iter       ; //!< Iterations of the last solve
+    SKL_REAL _err      ; //!< Relative residual of the last solve
+    vector_t b         ; //!< F(x), in the arithmetic of the residual
+    plain_t r, w, p, s ; //!< Residual, J u, search direction and J p
+    plain_t dx         ; //!< Update
+    plain_t u_buf      ; //!< Preconditioned residual ( only allocated if needed )
+    plain_t u          ; //!< Preconditioned residual, aliases r without preconditioner
+    vector_t v_seed, jv_seed ; //!< Fad directions for residuals without plain_directions
+    exec_space _space  ; //!< Execution space instance of the current solve
+    bool _fence { false } ; //!< Whether residual calls need to be ordered with _space
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_CG_HH */
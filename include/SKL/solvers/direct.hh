@@ -0,0 +1,181 @@
+/**
+ * @file direct.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Newton updates from an assembled and LU factored Jacobian.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_DIRECT_HH
+#define SKL_SOLVERS_DIRECT_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/jacobian.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include <Sacado.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Direct solver for the linearized residual.
+ * \ingroup solvers
+ * 
+ * The Jacobian is assembled with jacobian_assembler<k>, factored
+ * with partially pivoted LU on host (LAPACK GETRF) and the factors 
+ * are kept on device. Triangular solves go through 
+ * utils::linalg::trsm. solve() follows the same contract as the 
+ * Krylov solvers and applies the Newton update J(x) dx = -F(x) to x.
+ * factor() and apply() can be used separately to keep the LU of a 
+ * frozen Jacobian, see frozen_jacobian_preconditioner.
+ * 
+ * @tparam k Number of tangent directions per residual evaluation.
+ */
+template< size_t k = 8 >
+class direct_solver 
+{
+ public:
+    using vector_t = sfad_view_t<1> ; 
+    using matrix_t = typename jacobian_assembler<k>::dense_matrix_t ; 
+
+    direct_solver( jacobian_pattern const& pattern ) 
+     : _assembler(pattern), _N(pattern.size()), _factored(false)
+    {
+        Kokkos::realloc(LU, _N, _N) ; 
+        Kokkos::realloc(perm, _N) ; 
+        Kokkos::realloc(b,  _N, 2) ; 
+        Kokkos::realloc(dx, _N, 2) ; 
+    }
+
+    /**
+     * @brief Assemble, factor and apply the Newton update.
+     * 
+     * @tparam res_t Type of the residual.
+     * @param res Residual object.
+     * @param x   State, overwritten by x + dx on exit.
+     * @return size_t Number of residual evaluations used for the assembly.
+     */
+    template< typename res_t >
+    size_t solve(res_t& res, vector_t& x) {
+        res.compute_residual(x, b) ; 
+        utils::linalg::scal(b, SKL_REAL{-1.}, b) ; 
+        factor(res, x) ; 
+        apply(b, dx) ; 
+        utils::linalg::axpy(SKL_REAL{1.}, dx, x) ; 
+        return _assembler.passes() ; 
+    }
+
+    /**
+     * @brief Assemble J(x) and compute its LU factorization.
+     */
+    template< typename res_t, typename x_t >
+    void factor(res_t& res, x_t const& x) {
+        _assembler.assemble(res, x, LU) ; 
+
+        auto h_LU = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LU) ; 
+        std::vector<int> ipiv(_N) ; 
+        int info { 0 } ; 
+        Teuchos::LAPACK<int, SKL_REAL> lapack ; 
+        lapack.GETRF(_N, _N, h_LU.data(), _N, ipiv.data(), &info) ; 
+        if( info != 0 ) {
+            Kokkos::abort("direct_solver: singular Jacobian.") ; 
+        }
+        // Row interchanges to permutation, P A = L U
+        auto h_perm = Kokkos::create_mirror_view(perm) ; 
+        for( size_t i=0; i<_N; ++i) h_perm(i) = i ; 
+        for( size_t i=0; i<_N; ++i) std::swap(h_perm(i), h_perm(ipiv[i]-1)) ; 
+        Kokkos::deep_copy(LU, h_LU) ; 
+        Kokkos::deep_copy(perm, h_perm) ; 
+        _factored = true ; 
+    }
+
+    /**
+     * @brief Solve J z = r with the stored factorization.
+     * 
+     * Only the values of r are used, z receives values only.
+     * 
+     * @param r Right hand side.
+     * @param z Solution (output).
+     */
+    template< typename r_t, typename z_t >
+    void apply(r_t const& r, z_t const& z) const {
+        apply(Kokkos::DefaultExecutionSpace(), r, z) ; 
+    }
+
+    /**
+     * @brief Solve J z = r with the stored factorization on an
+     *        execution space instance.
+     * 
+     * The triangular solves work on a scratch vector allocated for
+     * each call, apply() only reads the solver's 
+     * members. Calls on different instances may therefore run 
+     * concurrently, as long as they write to different z, while 
+     * factor() must not overlap with any of them.
+     */
+    template< typename exec_t, typename r_t, typename z_t >
+    void apply(exec_t const& space, r_t const& r, z_t const& z) const {
+        using r_value_t = typename r_t::non_const_value_type ; 
+        rhs_t rhs(Kokkos::view_alloc(Kokkos::WithoutInitializing, "direct_solver_rhs"), _N, 1) ; 
+        auto _rhs = rhs ; auto _perm = perm ; 
+        Kokkos::parallel_for("direct_solver::permute", Kokkos::RangePolicy<exec_t>(space, 0, _N)
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                _rhs(i,0) = Sacado::ScalarValue<r_value_t>::eval(r(_perm(i))) ; 
+            }) ; 
+        utils::linalg::trsm(space, "L", "L", "N", "U", SKL_REAL{1.}, LU, rhs) ; 
+        utils::linalg::trsm(space, "L", "U", "N", "N", SKL_REAL{1.}, LU, rhs) ; 
+        Kokkos::parallel_for("direct_solver::extract", Kokkos::RangePolicy<exec_t>(space, 0, _N)
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                z(i) = _rhs(i,0) ; 
+            }) ; 
+    }
+
+    bool factored() const { return _factored ; }
+    size_t passes() const { return _assembler.passes() ; }
+    matrix_t factors() const { return LU ; }
+    jacobian_assembler<k>& assembler() { return _assembler ; }
+
+ private:
+    using rhs_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ; //!< Triangular solve workspace
+
+    jacobian_assembler<k> _assembler ; //!< Jacobian assembly
+    size_t _N       ; //!< Size of the problem to invert
+    bool _factored  ; //!< Whether LU holds a valid factorization
+    matrix_t LU     ; //!< LU factors ( unit lower triangle implicit )
+    Kokkos::View<size_t*, Kokkos::DefaultExecutionSpace> perm ; //!< Row permutation
+    vector_t b, dx  ; //!< Rhs and update
+} ; 
+
+}
+
+#endif /* SKL_SOLVERS_DIRECT_HH */
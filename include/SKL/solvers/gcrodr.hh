@@ -0,0 +1,578 @@
+/**
+ * @file gcrodr.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief GMRES with deflated restarting and Krylov subspace recycling.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_GCRODR_HH
+#define SKL_SOLVERS_GCRODR_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include <Sacado.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief GCRO-DR solver (Parks et al. 2006) for sequences of linearized systems.
+ * \ingroup solvers
+ *
+ * Same interface and residual contract as skl::gmres. At the end of
+ * every full cycle the solver extracts <code>k</code> harmonic Ritz
+ * vectors of the operator from the Arnoldi relation and keeps them
+ * (as U, with C = J U orthonormal) across calls to solve(). On the
+ * next solve, C is recomputed for the new Jacobian and the recycled
+ * space is deflated from the Krylov iteration, so that slowly varying
+ * sequences (Newton steps, parameter sweeps, time steps) need fewer
+ * iterations. The recycled space is dropped with reset().
+ * As in skl::gmres the bases live on device in plain SKL_REAL and the 
+ * directions reach the residual through detail::plain_jvp.
+ * Recycled vectors whose image under the operator is numerically 
+ * dependent on the others are dropped. If the harmonic Ritz vectors 
+ * cannot be computed the recycled space is dropped as well, the 
+ * following cycles are plain GMRES cycles until the next full cycle 
+ * rebuilds it; recycle_failures() counts these events.
+ */
+class gcrodr {
+
+ public:
+    using vector_t      = sfad_view_t<1> ;
+    using exec_space    = Kokkos::DefaultExecutionSpace ;
+    using plain_t       = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+    using basis_t       = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+    using host_matrix_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::HostSpace> ;
+    using host_vector_t = Kokkos::View<SKL_REAL*, Kokkos::HostSpace> ;
+
+    /**
+     * @brief Construct the solver.
+     *
+     * @param problem_size Size of the problem to invert.
+     * @param max_iter     Dimension of the search space per cycle (recycled + Krylov).
+     * @param n_recycle    Number of harmonic Ritz vectors kept, must be < max_iter.
+     * @param tol          Relative tolerance.
+     * @param max_restarts Maximum number of cycles per solve.
+     */
+    gcrodr( size_t problem_size, size_t max_iter, size_t n_recycle, SKL_REAL tol, size_t max_restarts = 50 )
+     : _N(problem_size), _m(max_iter), _k(n_recycle), _max_restarts(max_restarts), _tol(tol)
+     , _iter(0), _k_cur(0), _recycle_failures(0)
+    {
+        if( _k >= _m ) {
+            Kokkos::abort("gcrodr: the number of recycled vectors must be smaller than the cycle length.") ;
+        }
+        Kokkos::realloc(V, _N, _m+1) ;
+        Kokkos::realloc(U, _N, _k) ;
+        Kokkos::realloc(C, _N, _k) ;
+        Kokkos::realloc(U_new, _N, _k) ;
+        Kokkos::realloc(C_new, _N, _k) ;
+        Kokkos::realloc(b,  _N, 2) ;
+        Kokkos::realloc(r,  _N) ;
+        Kokkos::realloc(dx, _N) ;
+        Kokkos::realloc(G,     _m+1, _m) ;
+        Kokkos::realloc(G_rot, _m+1, _m) ;
+        Kokkos::realloc(cs, _m) ;
+        Kokkos::realloc(sn, _m) ;
+        Kokkos::realloc(g,  _m+1) ;
+        Kokkos::realloc(d,  _k) ;
+    }
+
+    /**
+     * @brief Solve the linearized system and update the state.
+     *
+     * @tparam res_t Type of the residual.
+     * @param res Residual object.
+     * @param x   State, overwritten by x + dx on exit.
+     * @return size_t Number of Arnoldi iterations performed.
+     */
+    template< typename res_t >
+    size_t solve(res_t& res, vector_t& x )
+    {
+        _space = exec_space() ;
+        _fence = false ;
+        return solve_impl(res, x) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space instance.
+     *
+     * @tparam res_t Type of the residual.
+     * @param space Execution space instance all kernels are enqueued on.
+     * @param res   Residual object.
+     * @param x     State, overwritten by x + dx on exit.
+     * @return size_t Number of Arnoldi iterations performed.
+     */
+    template< typename res_t >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x )
+    {
+        _space = space ;
+        _fence = true ;
+        return solve_impl(res, x) ;
+    }
+
+    /**
+     * @brief Drop the recycled subspace.
+     */
+    void reset() { _k_cur = 0 ; }
+
+    size_t iterations() const { return _iter ; }
+    size_t recycled()   const { return _k_cur ; }
+    //! Number of cycles whose recycled space could not be computed and was dropped
+    size_t recycle_failures() const { return _recycle_failures ; }
+
+ private:
+
+    template< typename res_t >
+    size_t solve_impl(res_t& res, vector_t& x )
+    {
+        using namespace Kokkos ;
+        if constexpr ( not detail::plain_directions<res_t> ) {
+            if( v_seed.extent(0) != _N ) {
+                Kokkos::realloc(v_seed,  _N, 2) ;
+                Kokkos::realloc(jv_seed, _N, 2) ;
+            }
+        }
+
+        detail::linearize_if_supported(_space, _fence, res, x) ;
+        detail::compute_residual(_space, _fence, res, x, b) ;
+        utils::linalg::scal(_space, b, SKL_REAL{-1.}, b) ;
+        SKL_REAL const b_norm = utils::linalg::nrm2(_space, b) ;
+        if( b_norm == 0 ) {
+            return 0 ;
+        }
+
+        deep_copy(_space, dx, 0.) ;
+        deep_copy(_space, r,  0.) ;
+        utils::linalg::axpy(_space, SKL_REAL{1.}, b, r) ;
+        _iter = 0 ;
+
+        // The operator changed since the recycled space was built:
+        // recompute C = J U and make it orthonormal.
+        if( _k_cur > 0 ) {
+            refresh_recycle_space(res, x) ;
+        }
+
+        SKL_REAL err = utils::linalg::nrm2(_space, r) / b_norm ;
+        for( size_t cycle=0; cycle<_max_restarts and err >= _tol; ++cycle) {
+            size_t const kk = _k_cur ;
+            size_t const p  = _m - kk ;
+
+            // Deflate the recycled space out of the residual
+            project_residual(kk) ;
+            SKL_REAL const beta = utils::linalg::nrm2(_space, r) ;
+            err = beta / b_norm ;
+            if( err < _tol ) {
+                break ;
+            }
+            auto v0 = subview(V, ALL(), 0) ;
+            utils::linalg::scal(_space, v0, 1./beta, r) ;
+
+            deep_copy(G, 0.) ; deep_copy(G_rot, 0.) ; deep_copy(g, 0.) ;
+            for( size_t i=0; i<kk; ++i) {
+                G(i,i) = G_rot(i,i) = d(i) ;
+                cs(i) = 1. ; sn(i) = 0. ;
+            }
+            g(kk) = beta ;
+
+            size_t j_used { 0 } ;
+            for( size_t j=0; j<p; ++j) {
+                arnoldi_iteration(res, x, j, kk) ;
+                size_t const col = kk + j ;
+                givens_rotation(col) ;
+                g(col+1) = -sn(col) * g(col) ;
+                g(col)  *=  cs(col) ;
+                err = Kokkos::fabs(g(col+1)) / b_norm ;
+                _iter++ ;
+                j_used = j+1 ;
+                if( err < _tol ) {
+                    break ;
+                }
+            }
+            compute_solution(kk, kk + j_used) ;
+
+            // Explicit residual, r = b - J dx
+            detail::plain_jvp(_space, _fence, res, x, dx, r, v_seed, jv_seed) ;
+            utils::linalg::scal(_space, r, SKL_REAL{-1.}, r) ;
+            utils::linalg::axpy(_space, SKL_REAL{1.}, b, r) ;
+            err = utils::linalg::nrm2(_space, r) / b_norm ;
+
+            // Only full cycles have a meaningful Arnoldi relation
+            if( j_used == p and _k > 0 ) {
+                update_recycle_space(kk, p) ;
+            }
+        }
+
+        utils::linalg::axpy(_space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
+
+    template< typename res_t >
+    void refresh_recycle_space(res_t& res, vector_t& x)
+    {
+        using namespace Kokkos ;
+        for( size_t i=0; i<_k_cur; ++i) {
+            auto u = subview(U, ALL(), i) ;
+            auto c = subview(C, ALL(), i) ;
+            detail::plain_jvp(_space, _fence, res, x, u, c, v_seed, jv_seed) ;
+        }
+        // C = Q R by modified Gram-Schmidt, U <- U R^{-1}. The recycled 
+        // space is truncated before the first column of C that depends 
+        // on the previous ones.
+        host_matrix_t R("gcrodr_R", _k_cur, _k_cur) ;
+        size_t k_valid { 0 } ;
+        for( size_t j=0; j<_k_cur; ++j) {
+            auto cj = subview(C, ALL(), j) ;
+            SKL_REAL const c_norm = utils::linalg::nrm2(_space, cj) ;
+            for( size_t i=0; i<j; ++i) {
+                auto ci = subview(C, ALL(), i) ;
+                R(i,j) = utils::linalg::dot(_space, ci, cj) ;
+                utils::linalg::axpy(_space, -R(i,j), ci, cj) ;
+            }
+            R(j,j) = utils::linalg::nrm2(_space, cj) ;
+            if( dependent(R(j,j), c_norm) ) {
+                break ;
+            }
+            utils::linalg::scal(_space, cj, 1./R(j,j), cj) ;
+            k_valid = j+1 ;
+        }
+        _k_cur = k_valid ;
+        apply_inverse_r(U, R, _k_cur) ;
+        compute_scaling() ;
+    }
+
+    void project_residual(size_t kk)
+    {
+        using namespace Kokkos ;
+        for( size_t i=0; i<kk; ++i) {
+            auto ci = subview(C, ALL(), i) ;
+            auto ui = subview(U, ALL(), i) ;
+            SKL_REAL const c = utils::linalg::dot(_space, ci, r) ;
+            utils::linalg::axpy(_space, -c, ci, r ) ;
+            utils::linalg::axpy(_space,  c, ui, dx) ;
+        }
+    }
+
+    template< typename res_t >
+    void arnoldi_iteration(res_t& res, vector_t& x, size_t j, size_t kk)
+    {
+        using namespace Kokkos ;
+        static constexpr double eps = 1e-12 ;
+
+        auto v = subview(V, ALL(), j)   ;
+        auto w = subview(V, ALL(), j+1) ;
+        detail::plain_jvp(_space, _fence, res, x, v, w, v_seed, jv_seed) ;
+        // Projection onto the complement of range(C)
+        for( size_t i=0; i<kk; ++i) {
+            auto ci = subview(C, ALL(), i) ;
+            G(i, kk+j) = utils::linalg::dot(_space, ci, w) ;
+            utils::linalg::axpy(_space, -G(i,kk+j), ci, w) ;
+        }
+        for( size_t l=0; l<=j; ++l) {
+            auto vl = subview(V, ALL(), l) ;
+            G(kk+l, kk+j) = utils::linalg::dot(_space, vl, w) ;
+            utils::linalg::axpy(_space, -G(kk+l,kk+j), vl, w) ;
+        }
+        G(kk+j+1, kk+j) = utils::linalg::nrm2(_space, w) ;
+        if( G(kk+j+1, kk+j) > eps ) {
+            utils::linalg::scal(_space, w, 1./G(kk+j+1,kk+j), w) ;
+        }
+        for( size_t i=0; i<=kk+j+1; ++i) {
+            G_rot(i, kk+j) = G(i, kk+j) ;
+        }
+    }
+
+    void givens_rotation(size_t n)
+    {
+        for( size_t i=0; i<n; ++i) {
+            SKL_REAL tmp = cs(i) * G_rot(i, n) + sn(i) * G_rot(i+1, n) ;
+            G_rot(i+1,n) = - sn(i) * G_rot(i, n) + cs(i) * G_rot(i+1, n) ;
+            G_rot(i,  n) = tmp ;
+        }
+        SKL_REAL v1 = G_rot(n,  n) ;
+        SKL_REAL v2 = G_rot(n+1,n) ;
+        SKL_REAL t = Kokkos::sqrt( v1*v1 + v2*v2 ) ;
+        cs(n) = v1 / t ;
+        sn(n) = v2 / t ;
+        G_rot(n,n)   = t  ;
+        G_rot(n+1,n) = 0. ;
+    }
+
+    /**
+     * @brief Solve the least squares problem and update dx = dx + [U D, V] y.
+     */
+    void compute_solution(size_t kk, size_t n)
+    {
+        host_matrix_t y("gcrodr_y", n, 1) ;
+        for( int i=n-1; i>=0; --i) {
+            y(i,0) = g(i) ;
+            for( size_t j=i+1; j<n; ++j) {
+                y(i,0) -= G_rot(i,j) * y(j,0) ;
+            }
+            y(i,0) /= G_rot(i,i) ;
+        }
+        host_matrix_t y_u("gcrodr_y_u", kk,   1) ;
+        host_matrix_t y_v("gcrodr_y_v", n-kk, 1) ;
+        for( size_t i=0; i<kk; ++i)   y_u(i,0) = d(i) * y(i,0) ;
+        for( size_t i=kk; i<n; ++i)   y_v(i-kk,0) = y(i,0) ;
+        combine_columns(dx, U, y_u, kk, V, y_v, n-kk, true) ;
+    }
+
+    /**
+     * @brief Compute k harmonic Ritz vectors from the last full cycle and
+     *        replace the recycled space with them.
+     */
+    void update_recycle_space(size_t kk, size_t p)
+    {
+        using namespace Kokkos ;
+        int const n = kk + p ;
+
+        // W^T V_hat = [[C^T U D, 0], [V^T U D, [I;0]]]
+        host_matrix_t WV("gcrodr_WV", n+1, n) ;
+        for( size_t j=0; j<kk; ++j) {
+            auto uj = subview(U, ALL(), j) ;
+            for( size_t i=0; i<kk; ++i) {
+                WV(i,j) = d(j) * utils::linalg::dot(_space, subview(C, ALL(), i), uj) ;
+            }
+            for( size_t i=0; i<=p; ++i) {
+                WV(kk+i,j) = d(j) * utils::linalg::dot(_space, subview(V, ALL(), i), uj) ;
+            }
+        }
+        for( size_t j=0; j<p; ++j) {
+            WV(kk+j, kk+j) = 1. ;
+        }
+
+        // Generalized eigenproblem G^T G z = theta G^T (W^T V_hat) z
+        host_matrix_t A("gcrodr_A", n, n), B("gcrodr_B", n, n) ;
+        for( int i=0; i<n; ++i) for( int j=0; j<n; ++j) {
+            for( int l=0; l<=n; ++l) {
+                A(i,j) += G(l,i) * G(l,j)  ;
+                B(i,j) += G(l,i) * WV(l,j) ;
+            }
+        }
+        host_vector_t ar("gcrodr_ar", n), ai("gcrodr_ai", n), be("gcrodr_be", n) ;
+        host_matrix_t VR("gcrodr_VR", n, n) ;
+        int const lwork = 16*n + 16 ;
+        std::vector<SKL_REAL> work(lwork) ;
+        SKL_REAL vl_dummy ;
+        int info ;
+        Teuchos::LAPACK<int, SKL_REAL> lapack ;
+        lapack.GGEV( 'N', 'V', n, A.data(), n, B.data(), n
+                   , ar.data(), ai.data(), be.data()
+                   , &vl_dummy, 1, VR.data(), n, work.data(), lwork, &info ) ;
+        if( info != 0 ) {
+            drop_recycle_space() ;
+            return ;
+        }
+
+        // Select the harmonic Ritz values of smallest magnitude.
+        // Complex conjugate pairs are stored by LAPACK as real and
+        // imaginary part in consecutive columns and are kept together.
+        std::vector<SKL_REAL> mag(n) ;
+        for( int i=0; i<n; ++i ) {
+            mag[i] = be(i) == 0 ? std::numeric_limits<SKL_REAL>::max()
+                                : Kokkos::sqrt(ar(i)*ar(i)+ai(i)*ai(i)) / Kokkos::fabs(be(i)) ;
+        }
+        std::vector<int> idx(n) ;
+        std::iota(idx.begin(), idx.end(), 0) ;
+        std::stable_sort(idx.begin(), idx.end(), [&](int a, int c) { return mag[a] < mag[c] ; }) ;
+        std::vector<int> selected ;
+        for( int i: idx ) {
+            if( selected.size() == _k ) break ;
+            if( ai(i) == 0 ) {
+                selected.push_back(i) ;
+            } else if( ai(i) > 0 and selected.size() + 2 <= _k ) {
+                selected.push_back(i) ; selected.push_back(i+1) ;
+            }
+        }
+        size_t k_new = selected.size() ;
+        if( k_new == 0 ) {
+            drop_recycle_space() ;
+            return ;
+        }
+        host_matrix_t P("gcrodr_P", n, k_new) ;
+        for( size_t j=0; j<k_new; ++j) {
+            for( int i=0; i<n; ++i) P(i,j) = VR(i, selected[j]) ;
+        }
+
+        // [Q, R] = qr(G P), truncated before the first dependent column
+        host_matrix_t Qh("gcrodr_Q", n+1, k_new), R("gcrodr_R", k_new, k_new) ;
+        size_t k_valid { 0 } ;
+        for( size_t j=0; j<k_new; ++j) {
+            SKL_REAL q_norm { 0. } ;
+            for( int i=0; i<=n; ++i) {
+                for( int l=0; l<n; ++l) Qh(i,j) += G(i,l) * P(l,j) ;
+                q_norm += Qh(i,j) * Qh(i,j) ;
+            }
+            for( size_t l=0; l<j; ++l) {
+                for( int i=0; i<=n; ++i) R(l,j) += Qh(i,l) * Qh(i,j) ;
+                for( int i=0; i<=n; ++i) Qh(i,j) -= R(l,j) * Qh(i,l) ;
+            }
+            for( int i=0; i<=n; ++i) R(j,j) += Qh(i,j) * Qh(i,j) ;
+            R(j,j) = Kokkos::sqrt(R(j,j)) ;
+            if( dependent(R(j,j), Kokkos::sqrt(q_norm)) ) {
+                break ;
+            }
+            for( int i=0; i<=n; ++i) Qh(i,j) /= R(j,j) ;
+            k_valid = j+1 ;
+        }
+        if( k_valid == 0 ) {
+            drop_recycle_space() ;
+            return ;
+        }
+        k_new = k_valid ;
+
+        // U_new = [U D, V] P R^{-1},  C_new = [C, V] Q
+        host_matrix_t P_u("gcrodr_P_u", kk, k_new), P_v("gcrodr_P_v", p, k_new) ;
+        host_matrix_t Q_c("gcrodr_Q_c", kk, k_new), Q_v("gcrodr_Q_v", p+1, k_new) ;
+        for( size_t j=0; j<k_new; ++j) {
+            for( size_t i=0; i<kk; ++i) {
+                P_u(i,j) = d(i) * P(i,j) ;
+                Q_c(i,j) = Qh(i,j) ;
+            }
+            for( size_t i=0; i<p; ++i)  P_v(i,j) = P(kk+i,j) ;
+            for( size_t i=0; i<=p; ++i) Q_v(i,j) = Qh(kk+i,j) ;
+        }
+        combine_columns(U_new, U, P_u, kk, V, P_v, p,   false) ;
+        combine_columns(C_new, C, Q_c, kk, V, Q_v, p+1, false) ;
+        apply_inverse_r(U_new, R, k_new) ;
+
+        std::swap(U, U_new) ;
+        std::swap(C, C_new) ;
+        _k_cur = k_new ;
+        compute_scaling() ;
+    }
+
+    /**
+     * @brief out(:,j) (+)= sum_l A(:,l) PA(l,j) + sum_l B(:,l) PB(l,j).
+     *
+     * Works both for rank-1 and rank-2 outputs, in the former
+     * case the coefficient matrices have a single column.
+     */
+    template< typename out_t >
+    void combine_columns( out_t const& out
+                        , basis_t const& A, host_matrix_t const& PA, size_t nA
+                        , basis_t const& B, host_matrix_t const& PB, size_t nB
+                        , bool accumulate )
+    {
+        using namespace Kokkos ;
+        auto d_PA = create_mirror_view_and_copy(exec_space::memory_space(), PA) ;
+        auto d_PB = create_mirror_view_and_copy(exec_space::memory_space(), PB) ;
+        size_t const ncols = PA.extent(1) ;
+        parallel_for( "GCRODR_combine_columns"
+                    , MDRangePolicy<Rank<2>, exec_space>(_space, {0,0},{_N, ncols})
+                    , KOKKOS_LAMBDA (int i, int j)
+            {
+                SKL_REAL sum { 0. } ;
+                for( size_t l=0; l<nA; ++l) sum += A(i,l) * d_PA(l,j) ;
+                for( size_t l=0; l<nB; ++l) sum += B(i,l) * d_PB(l,j) ;
+                if constexpr ( out_t::rank() == 1 ) {
+                    if( accumulate ) out(i) += sum ; else out(i) = sum ;
+                } else {
+                    if( accumulate ) out(i,j) += sum ; else out(i,j) = sum ;
+                }
+            }
+        ) ;
+    }
+
+    /**
+     * @brief In-place right triangular solve X <- X R^{-1}.
+     */
+    void apply_inverse_r(basis_t const& X, host_matrix_t const& R, size_t k)
+    {
+        using namespace Kokkos ;
+        for( size_t j=0; j<k; ++j) {
+            auto xj = subview(X, ALL(), j) ;
+            for( size_t i=0; i<j; ++i) {
+                utils::linalg::axpy(_space, -R(i,j), subview(X, ALL(), i), xj) ;
+            }
+            utils::linalg::scal(_space, xj, 1./R(j,j), xj) ;
+        }
+    }
+
+    /**
+     * @brief Whether a column whose norm dropped from norm to r_jj by 
+     *        orthogonalization is numerically dependent on the previous ones.
+     */
+    static bool dependent(SKL_REAL r_jj, SKL_REAL norm) {
+        return r_jj <= Kokkos::sqrt(std::numeric_limits<SKL_REAL>::epsilon()) * norm ;
+    }
+
+    /**
+     * @brief Forget the recycled space after a failed update.
+     */
+    void drop_recycle_space() {
+        _k_cur = 0 ;
+        _recycle_failures++ ;
+    }
+
+    /**
+     * @brief d(i) = 1/||U_i||, such that U D has unit columns.
+     */
+    void compute_scaling()
+    {
+        using namespace Kokkos ;
+        for( size_t i=0; i<_k_cur; ++i) {
+            d(i) = 1. / utils::linalg::nrm2(_space, subview(U, ALL(), i)) ;
+        }
+    }
+
+    basis_t V            ; //!< Krylov basis
+    basis_t U, C         ; //!< Recycled space and its image under the operator
+    basis_t U_new, C_new ; //!< Scratch space for the recycled space update
+    vector_t b           ; //!< Rhs, in the arithmetic of the residual
+    plain_t r, dx        ; //!< Residual and update
+    vector_t v_seed, jv_seed ; //!< Fad directions for residuals without plain_directions
+
+    host_matrix_t G, G_rot ; //!< Extended Hessenberg matrix and its triangular factor
+    host_vector_t cs, sn   ; //!< Givens rotations
+    host_vector_t g        ; //!< Least-squares rhs
+    host_vector_t d        ; //!< Column scaling of U
+
+    size_t _N            ; //!< Size of the problem to invert
+    size_t _m            ; //!< Cycle length
+    size_t _k            ; //!< Maximum number of recycled vectors
+    size_t _max_restarts ; //!< Maximum number of cycles
+    SKL_REAL _tol        ; //!< Relative tolerance
+    size_t _iter         ; //!< Iterations of the last solve
+    size_t _k_cur        ; //!< Number of recycled vectors currently held
+    size_t _recycle_failures ; //!< Failed updates of the recycled space
+    exec_space _space    ; //!< Execution space instance of the current solve
+    bool _fence { false } ; //!< Whether residual calls need to be ordered with _space
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_GCRODR_HH */
@@ -1,28 +1,28 @@
 /**
  * @file gmres.hh
  * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
- * @brief 
+ * @brief
  * @date 2024-09-10
- * 
+ *
  * @copyright This file is part of the General Relativistic Astrophysics
  * Code for Exascale.
  * SKL is an evolution framework that uses Finite Volume
  * methods to simulate relativistic spacetimes and plasmas
  * Copyright (C) 2023 Carlo Musolino
- *                                    
+ *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation, either version 3 of the License, or
  * any later version.
- *   
+ *
  * This program is distributed in the hope that it will be useful,
  * but WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
  * GNU General Public License for more details.
- *   
+ *
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
- * 
+ *
  */
 
 #ifndef SKL_SOLVERS_GMRES_HH
@@ -34,7 +34,12 @@
 #include <SKL/utils/inline.h>
 #include <SKL/utils/types.hh>
 #include <SKL/utils/linalg.hh>
+#include <SKL/utils/workspace.hh>
 #include <SKL/solvers/helpers.hh>
+#include <SKL/preconditioners/identity.hh>
+#ifdef SKL_ENABLE_HDF5
+#include <SKL/io/checkpoint.hh>
+#endif
 
 #include <Kokkos_Core.hpp>
 #include <KokkosBlas1_team_nrm2.hpp>
@@ -42,137 +47,378 @@
 
 #include <Sacado.hpp>
 
+#include <string>
+#include <type_traits>
+
 namespace skl {
 
+/**
+ * @brief Restarted GMRES solver for the linearized residual.
+ * \ingroup solvers
+ *
+ * Given a residual object <code>res</code> and a state <code>x</code>
+ * this solver computes the Newton update <code>dx</code> solving
+ * J(x) dx = -F(x) and applies it to <code>x</code>. The residual
+ * object must provide:
+ *  - <code>res.compute_residual(x, r)</code>: store F(x) in r.
+ *  - <code>res.jvp(x, v, Jv)</code>: store J(x) v in Jv.
+ * The Krylov basis lives on device in plain SKL_REAL, the (small) 
+ * Hessenberg matrix, the Givens rotations and the least-squares rhs 
+ * live on host. Fad arithmetic is only used inside the residual: 
+ * residuals declaring <code>static constexpr bool plain_directions = true</code>
+ * receive the plain basis vectors in jvp() directly, for all others 
+ * the direction is copied into the value of a Fad seed vector.
+ * An optional right preconditioner <code>prec.apply(r, z)</code> 
+ * can be passed to solve(). The preconditioned vectors are stored,
+ * as in flexible GMRES, so that the preconditioner may change 
+ * between iterations.
+ * All device work can be enqueued on a given execution space 
+ * instance, so that independent solves on different instances 
+ * (see skl::partition_space) overlap. Residuals and preconditioners
+ * may accept the instance as an additional first argument.
+ */
 class gmres {
 
- public: 
-    gmres( size_t problem_size, size_t max_iter, SKL_REAL tol )
-     : _N(problem_size), _max_iter(max_iter), _tol(tol) 
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+    using basis_t    = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    gmres( size_t problem_size, size_t max_iter, SKL_REAL tol, size_t max_restarts = 10 )
+     : _N(problem_size), _max_iter(max_iter), _max_restarts(max_restarts), _tol(tol)
+     , _iter(0), _restart(0), _resume(false)
     {
-        Kokkos::realloc(Q, _N, _max_iter, 2) ; 
-        Kokkos::realloc(H, _max_iter+1, _max_iter ) ; 
-        Kokkos::realloc(cs, _N) ; 
-        Kokkos::realloc(sn, _N) ; 
+        Kokkos::realloc(Q, _N, _max_iter+1) ;
+        Kokkos::realloc(b,  _N, 2) ;
+        Kokkos::realloc(r,  _N) ;
+        Kokkos::realloc(dx, _N) ;
+        Kokkos::realloc(y, _max_iter) ;
+        Kokkos::realloc(h, _max_iter+1) ;
+        allocate_host() ;
     }
 
-    template< typename res_t > 
-    sfad_view_t<1> solve(res_t& res, sfad_view_t<1>& x ) 
+    /**
+     * @brief Construct the solver with its device storage carved 
+     *        from a workspace.
+     * 
+     * The basis and the work vectors are unmanaged Views into ws, 
+     * which must stay alive (and not be reset) as long as the solver
+     * is used. The small host side arrays are allocated as usual.
+     */
+    gmres( size_t problem_size, size_t max_iter, SKL_REAL tol, size_t max_restarts, workspace<>& ws )
+     : _N(problem_size), _max_iter(max_iter), _max_restarts(max_restarts), _tol(tol)
+     , _iter(0), _restart(0), _resume(false)
     {
-        using namespace Kokkos; 
-        // Initialization: we batch the operations by launching 
-        // a single thread team that will perform all operations. 
-        double b_norm, err; 
-        
-        auto q = subview(Q, ALL(), 0) ; 
-        res.compute_residual(x, q) ;             // stored in-place: q = b 
-        auto b_norm = utils::linalg::nrm2(q)     // norm of b
-        auto Ax = res.compute_jvp(team, x, q) ;  // compute Ax  
-        utils::linalg::axpy(-1, Ax, q) ;         // store in place: q = b - Ax 
-        
-        auto r_norm = utils::linalg::nrm2(q) ;   // Compute norm of q 
-
-        double err = _r_norm / _b_norm ;         // Initial error 
-        utils::linalg::scal(q, 1./r_norm, q) ;   // q = q/r_norm 
-
-        int k { 0 } ; 
-        do {
-            // This call adds a column to H and Q 
-            arnoldi_iteration(res, k) ; 
-            // This call fills the rotation matrices
-            givens_rotation(k) ; 
-
-            parallel_for( "GMRES_update_beta", 1
-                        , KOKKOS_LAMBDA(int dummy)
-                {
-                    beta(k+1) = -sn(k) * beta(k) ; 
-                    beta(k ) *= cs(k) ; 
-                    error     = Kokkos::fabs(beta(k+1)/b_norm) ; 
+        Q  = ws.view<basis_t>(_N, _max_iter+1) ;
+        b  = ws.view<vector_t>(_N, 2) ;
+        r  = ws.view<plain_t>(_N) ;
+        dx = ws.view<plain_t>(_N) ;
+        y  = ws.view<decltype(y)>(_max_iter) ;
+        h  = ws.view<decltype(h)>(_max_iter+1) ;
+        allocate_host() ;
+    }
+
+    /**
+     * @brief Solve the linearized system and update the state.
+     *
+     * @tparam res_t  Type of the residual.
+     * @tparam prec_t Type of the preconditioner.
+     * @param res  Residual object.
+     * @param x    State, overwritten by x + dx on exit.
+     * @param prec Right preconditioner.
+     * @return size_t Total number of Arnoldi iterations performed.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = exec_space() ;
+        _fence = false ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space instance.
+     *
+     * @tparam res_t  Type of the residual.
+     * @tparam prec_t Type of the preconditioner.
+     * @param space Execution space instance all kernels are enqueued on.
+     * @param res   Residual object.
+     * @param x     State, overwritten by x + dx on exit.
+     * @param prec  Right preconditioner.
+     * @return size_t Total number of Arnoldi iterations performed.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = space ;
+        _fence = true ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    size_t iterations() const { return _iter ; }
+    size_t restarts()   const { return _restart ; }
+
+    #ifdef SKL_ENABLE_HDF5
+    /**
+     * @brief Write the solver state to a checkpoint.
+     *
+     * The state consists of the current iterate of the update
+     * and the iteration counters. The restart vector is not 
+     * stored, solve() recomputes it from the update.
+     *
+     * @param ckpt   Checkpoint file.
+     * @param prefix Group the state is stored in.
+     */
+    void save_state(io::checkpoint& ckpt, std::string const& prefix = "gmres") const {
+        ckpt.write_view(prefix + "/dx", dx) ;
+        ckpt.write_scalar(prefix + "/iteration", _iter) ;
+        ckpt.write_scalar(prefix + "/restart",   _restart) ;
+    }
+
+    /**
+     * @brief Restore the solver state from a checkpoint.
+     *
+     * The next call to solve() resumes from the stored update
+     * rather than starting from zero.
+     *
+     * @param ckpt   Checkpoint file.
+     * @param prefix Group the state is stored in.
+     */
+    void load_state(io::checkpoint& ckpt, std::string const& prefix = "gmres") {
+        ckpt.read_view(prefix + "/dx", dx) ;
+        _iter    = ckpt.read_scalar<size_t>(prefix + "/iteration") ;
+        _restart = ckpt.read_scalar<size_t>(prefix + "/restart") ;
+        _resume  = true ;
+    }
+
+    /**
+     * @brief Periodically checkpoint the solver state during solve().
+     *
+     * @param ckpt  Checkpoint file, nullptr disables checkpointing.
+     * @param every Number of restart cycles between checkpoints.
+     */
+    void set_checkpoint(io::checkpoint* ckpt, size_t every = 1) {
+        _ckpt = ckpt ;
+        _ckpt_every = every ;
+    }
+    #endif
+
+ private:
+
+    template< typename res_t, typename prec_t >
+    size_t solve_impl(res_t& res, vector_t& x, prec_t const& prec)
+    {
+        using namespace Kokkos;
+        constexpr bool preconditioned = not std::is_same_v<prec_t, identity_preconditioner> ; 
+        if constexpr ( preconditioned ) {
+            if( Z.extent(0) != _N ) {
+                Kokkos::realloc(Z, _N, _max_iter) ; 
+            }
+        }
+        if constexpr ( not detail::plain_directions<res_t> ) {
+            if( v_seed.extent(0) != _N ) {
+                Kokkos::realloc(v_seed,  _N, 2) ; 
+                Kokkos::realloc(jv_seed, _N, 2) ; 
+            }
+        }
+
+        detail::linearize_if_supported(_space, _fence, res, x) ;
+        detail::compute_residual(_space, _fence, res, x, b) ; // b = F(x)
+        utils::linalg::scal(_space, b, SKL_REAL{-1.}, b) ; // b = -F(x)
+        SKL_REAL const b_norm = utils::linalg::nrm2(_space, b) ;
+        if( b_norm == 0 ) {
+            return 0 ;
+        }
+
+        if( not _resume ) {
+            deep_copy(_space, dx, 0.) ;
+            _iter = 0 ; _restart = 0 ;
+        }
+        _resume = false ;
+
+        SKL_REAL err { 1. } ;
+        while( _restart < _max_restarts ) {
+            // Restart vector r = b - J dx
+            detail::plain_jvp(_space, _fence, res, x, dx, r, v_seed, jv_seed) ;
+            utils::linalg::scal(_space, r, SKL_REAL{-1.}, r) ;
+            utils::linalg::axpy(_space, SKL_REAL{1.}, b, r) ;
+            SKL_REAL const r_norm = utils::linalg::nrm2(_space, r) ;
+            err = r_norm / b_norm ;
+            if( err < _tol or r_norm == 0 ) {
+                break ;
+            }
+
+            auto q = subview(Q, ALL(), 0) ;
+            utils::linalg::scal(_space, q, 1./r_norm, r) ; // q = r/r_norm
+            deep_copy(beta, 0.) ;
+            beta(0) = r_norm ;
+
+            size_t n_cols { 0 } ;
+            bool breakdown { false } ;
+            for( size_t k=0; k<_max_iter; ++k) {
+                // This call adds a column to H and Q
+                arnoldi_iteration(res, x, k, prec) ;
+                // This call fills the rotation matrices, a vanishing
+                // column means J is singular on the Krylov space
+                if( not givens_rotation(k) ) {
+                    breakdown = true ;
+                    break ;
+                }
+
+                beta(k+1) = -sn(k) * beta(k) ;
+                beta(k)  *=  cs(k) ;
+                err = Kokkos::fabs(beta(k+1)) / b_norm ;
+
+                _iter++  ;
+                n_cols = k+1 ;
+                if ( err < _tol ) {
+                    break ;
                 }
-            ) ; 
-            if ( error < _tol ) {
-                break ; 
             }
-            k++ ; 
-        } while( k < _max_iter) ; 
+            if constexpr ( preconditioned ) {
+                compute_solution(n_cols, Z) ;
+            } else {
+                compute_solution(n_cols, Q) ;
+            }
+            _restart++ ;
+            #ifdef SKL_ENABLE_HDF5
+            if( _ckpt != nullptr and _restart % _ckpt_every == 0 ) {
+                save_state(*_ckpt) ;
+            }
+            #endif
+            if( err < _tol or breakdown ) {
+                break ;
+            }
+        }
 
-    } ; 
+        utils::linalg::axpy(_space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
 
- private:
+    void allocate_host() {
+        _h_y = Kokkos::create_mirror_view(y) ;
+        _h_h = Kokkos::create_mirror_view(h) ;
+        Kokkos::realloc(H, _max_iter+1, _max_iter ) ;
+        Kokkos::realloc(cs, _max_iter) ;
+        Kokkos::realloc(sn, _max_iter) ;
+        Kokkos::realloc(beta, _max_iter+1) ;
+    }
 
-    template< typename res_t >
-    void arnoldi_iteration(res_t&  res, sfad_view_t<1>& r, int n) {
-        using namespace Kokkos ; 
+    template< typename res_t, typename prec_t >
+    void arnoldi_iteration(res_t&  res, vector_t& x, int n, prec_t const& prec) {
+        using namespace Kokkos ;
 
-        static constexpr double eps = 1e-12 ; 
-        /* Best accessed on host */
-        auto h_H = create_mirror_view(H) ; 
-        deep_copy(h_H, H) ; 
+        static constexpr double eps = 1e-12 ;
 
-        auto q = Kokkos::subview(Q, Kokkos::ALL(), n) ; 
-        auto v = res.jvp(q)     ;  
+        auto q = subview(Q, ALL(), n)   ;
+        auto v = subview(Q, ALL(), n+1) ;
+        if constexpr ( std::is_same_v<prec_t, identity_preconditioner> ) {
+            detail::plain_jvp(_space, _fence, res, x, q, v, v_seed, jv_seed) ;
+        } else {
+            auto z = subview(Z, ALL(), n) ;
+            detail::apply_preconditioner(_space, _fence, prec, q, z) ;
+            detail::plain_jvp(_space, _fence, res, x, z, v, v_seed, jv_seed) ;
+        }
+        // The projection coefficients stay on device, the whole column 
+        // is enqueued and read back with a single fence.
         for(int j=0; j<=n; ++j) {
-                auto q1  = Kokkos::subview(Q, Kokkos::ALL(), j) ; 
-                H(j,n) = utils::linalg::dot(q1, v) ;  
-                utils::linalg::axpy(-H(j,n), q1, v) ; // Gram-Schmidt projection
-                #if 0 
-                parallel_for( "Arnoldi_Gram_Schmidt_projection", _N 
-                            , KOKKOS_LAMBDA (int l) 
-                        {
-                            v(l) = v(l) - H(j,n) * q1(l) ; 
-                        }
-                ) ; 
-                #endif 
+                auto q1  = subview(Q, ALL(), j) ;
+                auto hj  = subview(h, j) ;
+                utils::linalg::dot(_space, q1, v, hj) ;
+                utils::linalg::axpy(_space, SKL_REAL{-1.}, hj, q1, v) ; // Gram-Schmidt projection
+        }
+        auto hn = subview(h, n+1) ;
+        utils::linalg::nrm2(_space, v, hn) ;
+        auto col   = subview(h, std::make_pair(0, n+2)) ;
+        auto h_col = subview(_h_h, std::make_pair(0, n+2)) ;
+        deep_copy(_space, h_col, col) ;
+        _space.fence("GMRES_arnoldi_column") ;
+        for(int j=0; j<=n+1; ++j) {
+            H(j,n) = h_col(j) ;
         }
-        H(n+1,n) = utils::linalg::nrm2(v) ;
         if ( H(n+1,n) > eps ) {
-            auto qq = subview(Q, ALL(), k) ; 
-            deep_copy(qq, v) ; 
-            utils::linalg::scal(qq, 1./H(n+1,n)) ; // Rescale ( TODO scal in blas-1 interface )
-        } 
+            utils::linalg::rscal(_space, v, hn, v) ;
+        }
     }
 
-    void givens_rotation(int n) {
-        using namespace Kokkos ; 
-        parallel_for( "GMRES_Givens_rotation", n-1
-                    , KOKKOS_LAMBDA( int i ) 
-            {
-                SKL_REAL tmp = cs(i) * H(i, n) + sn(i) * H(i+1, n) ; 
-                H(i+1,n) = - sn(i) * H(i, n) + cs(i) * H(i+1, n)   ; 
-                H(i,  n) = tmp ;     
-            }
-        ); 
+    //! Returns false if the rotated column vanishes
+    bool givens_rotation(int n) {
+        for( int i=0; i<n; ++i) {
+            SKL_REAL tmp = cs(i) * H(i, n) + sn(i) * H(i+1, n) ;
+            H(i+1,n) = - sn(i) * H(i, n) + cs(i) * H(i+1, n)   ;
+            H(i,  n) = tmp ;
+        }
 
-        parallel_for( "GMRES_Givens_rotation", 1
-                    , KOKKOS_LAMBDA( int _dummy ) 
+        SKL_REAL v1 = H(n,  n) ;
+        SKL_REAL v2 = H(n+1,n) ;
+        SKL_REAL t = Kokkos::sqrt( v1*v1 + v2*v2 ) ;
+        if( t == 0 ) {
+            cs(n) = 1. ; sn(n) = 0. ;
+            return false ;
+        }
+        cs(n) =  v1 / t ;
+        sn(n) =  v2 / t ;
+        H(n,n) = cs(n) * H(n,n) + sn(n) * H(n+1,n) ;
+        H(n+1,n) = 0. ;
+        return true ;
+    }
+
+    template< typename basis_t >
+    void compute_solution(int k, basis_t const& V) {
+        using namespace Kokkos ;
+        // Back substitution on the triangular system H y = beta
+        auto h_y = _h_y ;
+        for( int i=k-1; i>=0; --i) {
+            h_y(i) = beta(i) ;
+            for( int j=i+1; j<k; ++j) {
+                h_y(i) -= H(i,j) * h_y(j) ;
+            }
+            h_y(i) /= H(i,i) ;
+        }
+        deep_copy(_space, y, h_y) ;
+        // dx = dx + V y, V = Q or the preconditioned basis Z
+        auto _V = V ; auto _y = y ; auto _dx = dx ;
+        parallel_for( "GMRES_update_solution", RangePolicy<exec_space>(_space, 0, _N)
+                    , KOKKOS_LAMBDA (int i)
             {
-                SKL_REAL v1 = H(n,  n) ; 
-                SKL_REAL v2 = H(n+1,n) ; 
-                SKL_REAL t = Kokkos::sqrt( math::int_pow<2>(v1) + math::int_pow<2>(v2) )
-                cs(n) =  v1 / t ; 
-                sn(n) =  v2 / t ; 
-                H(n,n) = cs(n) + H(n,n) + sn(n) * H(n+1,n) ; 
-                H(n+1,n) = 0. ; 
+                SKL_REAL sum { 0. } ;
+                for( int j=0; j<k; ++j) {
+                    sum += _V(i,j) * _y(j) ;
+                }
+                _dx(i) += sum ;
             }
-        );
+        ) ;
     }
 
-    void compute_solution(int k) {
+    basis_t Q                                                       ; //!< Krylov basis
+    basis_t Z                                                       ; //!< Preconditioned basis ( only allocated if needed )
+    vector_t b                                                      ; //!< Rhs, in the arithmetic of the residual
+    plain_t r, dx                                                   ; //!< Restart vector and update
+    vector_t v_seed, jv_seed                                        ; //!< Fad directions for residuals without plain_directions
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace>   y      ; //!< Least-squares solution
+    typename Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace>::HostMirror _h_y ; //!< Host copy of y
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace>   h      ; //!< Current Hessenberg column ( device resident )
+    typename Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace>::HostMirror _h_h ; //!< Host copy of h
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultHostExecutionSpace> H   ; //!< Hessenberg matrix ( stored on host )
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultHostExecutionSpace> cs, sn, beta ; //!< Givens rotations and rhs ( stored on host )
 
-    }
-         
-    
-    
-    Kokkos::View<sfad_t<1>**, Kokkos::DeafultExecutionSpace> Q      ; 
-    Kokkos::View<sfad_t<1>*, Kokkos::DeafultExecutionSpace>  cs, sn, beta ; 
-    Kokkos::View<double**, Kokkos::HostExecutionSpace> H         ; //!< Hessenberg matrix ( stored on host )
-
-    size_t _N        ; //!< Size of the problem to invert 
+    size_t _N        ; //!< Size of the problem to invert
     size_t _max_iter ; //!< Maximum number of iterations before restart
-    SKL_REAL _tol  ; //!< Absolute tolerance 
-} ; 
+    size_t _max_restarts ; //!< Maximum number of restarts
+    SKL_REAL _tol  ; //!< Relative tolerance
+    size_t _iter     ; //!< Total number of iterations
+    size_t _restart  ; //!< Number of restart cycles completed
+    bool   _resume   ; //!< Whether the next solve resumes from a restored state
+    exec_space _space ; //!< Execution space instance of the current solve
+    bool   _fence { false } ; //!< Whether residual calls need to be ordered with _space
+    #ifdef SKL_ENABLE_HDF5
+    io::checkpoint* _ckpt { nullptr } ; //!< Checkpoint written during solve
+    size_t _ckpt_every { 1 }          ; //!< Checkpoint frequency in restart cycles
+    #endif
+} ;
 
 
 }
 
-#endif /* SKL_SOLVERS_GMRES_HH */
\ No newline at end of file
+#endif /* SKL_SOLVERS_GMRES_HH */
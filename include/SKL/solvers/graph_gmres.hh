@@ -0,0 +1,455 @@
+/**
+ * @file graph_gmres.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Restarted GMRES with the Arnoldi step captured in a Kokkos Graph.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_GRAPH_GMRES_HH
+#define SKL_SOLVERS_GRAPH_GMRES_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Graph.hpp>
+
+#include <Sacado.hpp>
+
+#include <any>
+#include <concepts>
+#include <optional>
+
+namespace skl {
+
+/**
+ * @brief Restarted GMRES with the Arnoldi step submitted as a graph.
+ * \ingroup solvers
+ *
+ * Every Arnoldi iteration performs the same sequence of kernels,
+ * only the column index changes. Here the index, the Hessenberg
+ * matrix, the Givens rotations and the least-squares rhs all live on
+ * device, so that the sequence
+ *   - operator application q_{k+1} = J q_k,
+ *   - two passes of classical Gram-Schmidt ( CGS2 ),
+ *   - norm and normalization,
+ *   - Givens update of H and of the rhs, convergence test
+ * can be built once as a Kokkos::Experimental::Graph and resubmitted
+ * every iteration. Once a cycle has converged (or reached max_iter)
+ * a device flag turns the remaining submissions into no-ops, so the
+ * host only needs to check the flag every check_interval() iterations.
+ *
+ * On backends without native graph support Kokkos executes the nodes
+ * one after the other on the graph's execution space, alternatively
+ * the graph can be disabled at construction, in which case the same
+ * kernels are launched directly.
+ *
+ * The operator is applied from inside the graph kernels: besides
+ * <code>res.compute_residual(x, r)</code> the residual must provide
+ * <code>res.row_operator()</code>, returning a device copyable functor
+ * whose <code>op.row(i, v)</code> returns row i of J v for a plain
+ * SKL_REAL View v. The graph captures a copy of this functor when it
+ * is built. It is reused by the next solve() on the same instance if
+ * the new functor provides <code>op.same_as(captured)</code> and that
+ * returns true, i.e. the functor itself states whether it reads the 
+ * same Views ( see linearized_residual::device_operator() ). Functors 
+ * without same_as() are rebuilt on every solve. The content of the 
+ * Views may change between solves, e.g. through 
+ * <code>res.linearize(x)</code>, which is called at the start of every 
+ * solve if available.
+ */
+class graph_gmres {
+
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, exec_space> ;
+    using basis_t    = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, exec_space> ;
+
+    /**
+     * @brief Construct the solver.
+     *
+     * @param problem_size Size of the problem to invert.
+     * @param max_iter     Number of iterations before restart.
+     * @param tol          Relative tolerance.
+     * @param max_restarts Maximum number of restarts.
+     * @param use_graph    Whether to build a graph or to launch the
+     *                     kernels directly.
+     */
+    graph_gmres( size_t problem_size, size_t max_iter, SKL_REAL tol, size_t max_restarts = 10, bool use_graph = true )
+     : _N(problem_size), _m(max_iter), _max_restarts(max_restarts), _tol(tol)
+     , _use_graph(use_graph), _check(1), _iter(0), _restart(0)
+    {
+        s.Q      = basis_t("graph_gmres_Q", _N, _m+1) ;
+        s.H      = matrix_t("graph_gmres_H", _m+1, _m) ;
+        s.cs     = vec_t("graph_gmres_cs", _m+1) ;
+        s.sn     = vec_t("graph_gmres_sn", _m+1) ;
+        s.g      = vec_t("graph_gmres_g",  _m+1) ;
+        s.h1     = vec_t("graph_gmres_h1", _m+1) ;
+        s.h2     = vec_t("graph_gmres_h2", _m+1) ;
+        s.nrm    = scalar_t("graph_gmres_nrm") ;
+        s.real   = vec_t("graph_gmres_real", 2) ;
+        s.istate = ivec_t("graph_gmres_istate", 2) ;
+        s.N = _N ; s.m = _m ; s.tol = _tol ;
+        b  = plain_t("graph_gmres_b", _N) ;
+        dx = plain_t("graph_gmres_dx", _N) ;
+        F  = vector_t("graph_gmres_F", _N, 2) ;
+        h_real   = Kokkos::create_mirror_view(s.real) ;
+        h_istate = Kokkos::create_mirror_view(s.istate) ;
+    }
+
+    /**
+     * @brief Number of iterations between two convergence checks on
+     *        host. Larger values save fences at the price of at most
+     *        every-1 empty graph submissions per cycle.
+     */
+    void set_check_interval(size_t every) { _check = every > 0 ? every : 1 ; }
+    size_t check_interval() const { return _check ; }
+
+    bool uses_graph() const { return _use_graph ; }
+
+    template< typename res_t >
+    size_t solve(res_t& res, vector_t& x)
+    {
+        return solve(exec_space(), res, x) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space
+     *        instance and update the state.
+     *
+     * The graph is rebuilt whenever the operator of the residual or
+     * the instance differ from the previous solve().
+     *
+     * @tparam res_t Type of the residual.
+     * @param space Execution space instance.
+     * @param res   Residual object.
+     * @param x     State, overwritten by x + dx on exit.
+     * @return size_t Total number of Arnoldi iterations performed.
+     */
+    template< typename res_t >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x)
+    {
+        using namespace Kokkos ;
+        static_assert( requires { res.row_operator() ; }
+                     , "graph_gmres needs a residual providing row_operator()." ) ;
+        bool const fence = not (space == exec_space()) ;
+        detail::linearize_if_supported(space, fence, res, x) ;
+        detail::compute_residual(space, fence, res, x, F) ;
+
+        auto op = res.row_operator() ;
+        auto _b = b ; auto _F = F ;
+        parallel_for("graph_gmres::rhs", RangePolicy<exec_space>(space, 0, _N)
+                    , KOKKOS_LAMBDA (int i) { _b(i) = -_F(i).val() ; }) ;
+        SKL_REAL const b_norm = utils::linalg::nrm2(space, b) ;
+        if( b_norm == 0 ) {
+            return 0 ;
+        }
+        deep_copy(space, dx, 0.) ;
+
+        // The graph runs on the instance it was built on
+        if( _use_graph and ( not same_operator(op) or not (*_graph_space == space) ) ) {
+            build_graph(space, op) ;
+            _graph_op = op ;
+            _graph_space = space ;
+        }
+
+        _iter = 0 ; _restart = 0 ;
+        auto q0 = subview(s.Q, ALL(), 0) ;
+        while( _restart < _max_restarts ) {
+            // q_0 = b - J dx
+            parallel_for("graph_gmres::restart_vector", RangePolicy<exec_space>(space, 0, _N)
+                        , restart_f<decltype(op)>{ s, op, _b, dx } ) ;
+            SKL_REAL const beta = utils::linalg::nrm2(space, q0) ;
+            if( beta / b_norm < _tol ) {
+                break ;
+            }
+            utils::linalg::scal(space, q0, 1./beta, q0) ;
+            parallel_for("graph_gmres::init_cycle", RangePolicy<exec_space>(space, 0, 1)
+                        , init_f{ s, beta, b_norm } ) ;
+
+            for( size_t k=0; k<_m; ++k) {
+                if( _use_graph ) {
+                    _graph->submit() ;
+                } else {
+                    launch_iteration(space, op) ;
+                }
+                if( (k+1) % _check == 0 or k+1 == _m ) {
+                    deep_copy(space, h_istate, s.istate) ;
+                    space.fence("graph_gmres::check") ;
+                    if( h_istate(1) ) {
+                        break ;
+                    }
+                }
+            }
+            // dx = dx + Q y with H y = g
+            parallel_for("graph_gmres::back_substitution", RangePolicy<exec_space>(space, 0, 1)
+                        , solution_f{ s } ) ;
+            parallel_for("graph_gmres::update_solution", RangePolicy<exec_space>(space, 0, _N)
+                        , update_f{ s, dx } ) ;
+            deep_copy(space, h_istate, s.istate) ;
+            deep_copy(space, h_real, s.real) ;
+            space.fence("graph_gmres::cycle") ;
+            _iter += h_istate(0) ;
+            _restart++ ;
+            if( h_real(1) < _tol ) {
+                break ;
+            }
+        }
+
+        utils::linalg::axpy(space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
+
+    size_t iterations() const { return _iter ; }
+    size_t restarts()   const { return _restart ; }
+
+ private:
+    using vec_t    = Kokkos::View<SKL_REAL*, exec_space> ;
+    using matrix_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, exec_space> ;
+    using scalar_t = Kokkos::View<SKL_REAL, exec_space> ;
+    using ivec_t   = Kokkos::View<int*, exec_space> ;
+    using team_t   = typename Kokkos::TeamPolicy<exec_space>::member_type ;
+
+    static constexpr SKL_REAL eps = 1e-12 ;
+
+    /*
+     * Device state of a cycle. real = ( b_norm, err ),
+     * istate = ( number of columns k, done flag ).
+     */
+    struct state_t {
+        basis_t Q ;
+        matrix_t H ;
+        vec_t cs, sn, g, h1, h2, real ;
+        scalar_t nrm ;
+        ivec_t istate ;
+        size_t N, m ;
+        SKL_REAL tol ;
+    } ;
+
+    template< typename op_t >
+    struct restart_f {
+        state_t s ; op_t op ; plain_t b, dx ;
+        KOKKOS_INLINE_FUNCTION void operator() (int i) const {
+            s.Q(i,0) = b(i) - op.row(i, dx) ;
+        }
+    } ;
+
+    struct init_f {
+        state_t s ; SKL_REAL beta, b_norm ;
+        KOKKOS_INLINE_FUNCTION void operator() (int) const {
+            for( size_t i=0; i<=s.m; ++i) s.g(i) = 0. ;
+            s.g(0) = beta ;
+            s.real(0) = b_norm ;
+            s.real(1) = beta / b_norm ;
+            s.istate(0) = 0 ;
+            s.istate(1) = 0 ;
+        }
+    } ;
+
+    //! q_{k+1} = J q_k
+    template< typename op_t >
+    struct jvp_f {
+        state_t s ; op_t op ;
+        KOKKOS_INLINE_FUNCTION void operator() (int i) const {
+            if( s.istate(1) ) return ;
+            int const k = s.istate(0) ;
+            s.Q(i,k+1) = op.row(i, Kokkos::subview(s.Q, Kokkos::ALL(), k)) ;
+        }
+    } ;
+
+    //! h(j) = q_j . q_{k+1}, one team per column
+    struct project_f {
+        state_t s ; vec_t h ;
+        KOKKOS_INLINE_FUNCTION void operator() (team_t const& team) const {
+            if( s.istate(1) ) return ;
+            int const k = s.istate(0) ;
+            int const j = team.league_rank() ;
+            if( j > k ) return ;
+            SKL_REAL dot { 0. } ;
+            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, s.N), [&] (int i, SKL_REAL& acc) {
+                acc += s.Q(i,j) * s.Q(i,k+1) ;
+            }, dot) ;
+            Kokkos::single(Kokkos::PerTeam(team), [&] () { h(j) = dot ; }) ;
+        }
+    } ;
+
+    //! q_{k+1} -= sum_j h(j) q_j
+    struct subtract_f {
+        state_t s ; vec_t h ;
+        KOKKOS_INLINE_FUNCTION void operator() (int i) const {
+            if( s.istate(1) ) return ;
+            int const k = s.istate(0) ;
+            SKL_REAL sum { 0. } ;
+            for( int j=0; j<=k; ++j) sum += s.Q(i,j) * h(j) ;
+            s.Q(i,k+1) -= sum ;
+        }
+    } ;
+
+    struct norm_f {
+        state_t s ;
+        KOKKOS_INLINE_FUNCTION void operator() (int i, SKL_REAL& acc) const {
+            if( s.istate(1) ) return ;
+            int const k = s.istate(0) ;
+            acc += s.Q(i,k+1) * s.Q(i,k+1) ;
+        }
+    } ;
+
+    struct normalize_f {
+        state_t s ;
+        KOKKOS_INLINE_FUNCTION void operator() (int i) const {
+            if( s.istate(1) ) return ;
+            int const k = s.istate(0) ;
+            SKL_REAL const hn = Kokkos::sqrt(s.nrm()) ;
+            if( hn > eps ) s.Q(i,k+1) /= hn ;
+        }
+    } ;
+
+    //! Givens update of column k, convergence test and k <- k+1
+    struct givens_f {
+        state_t s ;
+        KOKKOS_INLINE_FUNCTION void operator() (int) const {
+            if( s.istate(1) ) return ;
+            int const k = s.istate(0) ;
+            SKL_REAL const hn = Kokkos::sqrt(s.nrm()) ;
+            for( int j=0; j<=k; ++j) s.H(j,k) = s.h1(j) + s.h2(j) ;
+            s.H(k+1,k) = hn ;
+            for( int i=0; i<k; ++i) {
+                SKL_REAL const t = s.cs(i) * s.H(i,k) + s.sn(i) * s.H(i+1,k) ;
+                s.H(i+1,k) = - s.sn(i) * s.H(i,k) + s.cs(i) * s.H(i+1,k) ;
+                s.H(i,k) = t ;
+            }
+            SKL_REAL const v1 = s.H(k,k), v2 = s.H(k+1,k) ;
+            SKL_REAL const t = Kokkos::sqrt(v1*v1 + v2*v2) ;
+            s.cs(k) = v1 / t ;
+            s.sn(k) = v2 / t ;
+            s.H(k,k) = t ;
+            s.H(k+1,k) = 0. ;
+            s.g(k+1) = - s.sn(k) * s.g(k) ;
+            s.g(k)  *=   s.cs(k) ;
+            s.real(1) = Kokkos::fabs(s.g(k+1)) / s.real(0) ;
+            s.istate(0) = k+1 ;
+            if( s.real(1) < s.tol or hn <= eps or size_t(k+1) == s.m ) {
+                s.istate(1) = 1 ;
+            }
+        }
+    } ;
+
+    //! Back substitution H y = g, y overwrites h1
+    struct solution_f {
+        state_t s ;
+        KOKKOS_INLINE_FUNCTION void operator() (int) const {
+            int const n = s.istate(0) ;
+            for( int i=n-1; i>=0; --i) {
+                SKL_REAL v = s.g(i) ;
+                for( int j=i+1; j<n; ++j) v -= s.H(i,j) * s.h1(j) ;
+                s.h1(i) = v / s.H(i,i) ;
+            }
+        }
+    } ;
+
+    struct update_f {
+        state_t s ; plain_t dx ;
+        KOKKOS_INLINE_FUNCTION void operator() (int i) const {
+            int const n = s.istate(0) ;
+            SKL_REAL sum { 0. } ;
+            for( int j=0; j<n; ++j) sum += s.Q(i,j) * s.h1(j) ;
+            dx(i) += sum ;
+        }
+    } ;
+
+    /*
+     * Whether the graph was built for an operator reading the same Views,
+     * as reported by op.same_as(). A residual which is destroyed and 
+     * rebuilt at the same address holds new Views, while the captured 
+     * copy keeps the old ones alive so their memory is not reused.
+     */
+    template< typename op_t >
+    bool same_operator(op_t const& op) const {
+        if constexpr ( requires { { op.same_as(op) } -> std::convertible_to<bool> ; } ) {
+            auto const* captured = std::any_cast<op_t>(&_graph_op) ;
+            return captured != nullptr and op.same_as(*captured) ;
+        } else {
+            return false ;
+        }
+    }
+
+    template< typename op_t >
+    void build_graph(exec_space const& space, op_t const& op)
+    {
+        using namespace Kokkos ;
+        size_t const N = _N, m = _m ;
+        _graph.emplace(Experimental::create_graph(space, [&] (auto const& root) {
+            auto jvp  = root.then_parallel_for("graph_gmres::jvp", RangePolicy<exec_space>(0, N), jvp_f<op_t>{ s, op }) ;
+            auto p1   = jvp.then_parallel_for("graph_gmres::project", TeamPolicy<exec_space>(m+1, AUTO), project_f{ s, s.h1 }) ;
+            auto s1   = p1.then_parallel_for("graph_gmres::subtract", RangePolicy<exec_space>(0, N), subtract_f{ s, s.h1 }) ;
+            auto p2   = s1.then_parallel_for("graph_gmres::project", TeamPolicy<exec_space>(m+1, AUTO), project_f{ s, s.h2 }) ;
+            auto s2   = p2.then_parallel_for("graph_gmres::subtract", RangePolicy<exec_space>(0, N), subtract_f{ s, s.h2 }) ;
+            auto nrm  = s2.then_parallel_reduce("graph_gmres::norm", RangePolicy<exec_space>(0, N), norm_f{ s }, s.nrm) ;
+            auto nz   = nrm.then_parallel_for("graph_gmres::normalize", RangePolicy<exec_space>(0, N), normalize_f{ s }) ;
+            nz.then_parallel_for("graph_gmres::givens", RangePolicy<exec_space>(0, 1), givens_f{ s }) ;
+        })) ;
+    }
+
+    template< typename op_t >
+    void launch_iteration(exec_space const& space, op_t const& op)
+    {
+        using namespace Kokkos ;
+        parallel_for("graph_gmres::jvp", RangePolicy<exec_space>(space, 0, _N), jvp_f<op_t>{ s, op }) ;
+        parallel_for("graph_gmres::project", TeamPolicy<exec_space>(space, _m+1, AUTO), project_f{ s, s.h1 }) ;
+        parallel_for("graph_gmres::subtract", RangePolicy<exec_space>(space, 0, _N), subtract_f{ s, s.h1 }) ;
+        parallel_for("graph_gmres::project", TeamPolicy<exec_space>(space, _m+1, AUTO), project_f{ s, s.h2 }) ;
+        parallel_for("graph_gmres::subtract", RangePolicy<exec_space>(space, 0, _N), subtract_f{ s, s.h2 }) ;
+        parallel_reduce("graph_gmres::norm", RangePolicy<exec_space>(space, 0, _N), norm_f{ s }, s.nrm) ;
+        parallel_for("graph_gmres::normalize", RangePolicy<exec_space>(space, 0, _N), normalize_f{ s }) ;
+        parallel_for("graph_gmres::givens", RangePolicy<exec_space>(space, 0, 1), givens_f{ s }) ;
+    }
+
+    size_t _N            ; //!< Size of the problem to invert
+    size_t _m            ; //!< Maximum number of iterations before restart
+    size_t _max_restarts ; //!< Maximum number of restarts
+    SKL_REAL _tol        ; //!< Relative tolerance
+    bool _use_graph      ; //!< Whether iterations are submitted as a graph
+    size_t _check        ; //!< Iterations between convergence checks
+    size_t _iter         ; //!< Iterations of the last solve
+    size_t _restart      ; //!< Restart cycles of the last solve
+
+    state_t s            ; //!< Device state shared by all kernels
+    plain_t b, dx        ; //!< Rhs and update
+    vector_t F           ; //!< Residual in the arithmetic of the state
+    typename vec_t::HostMirror  h_real   ; //!< Host copy of s.real
+    typename ivec_t::HostMirror h_istate ; //!< Host copy of s.istate
+
+    std::optional<Kokkos::Experimental::Graph<exec_space>> _graph ; //!< Captured Arnoldi step
+    std::optional<exec_space> _graph_space ; //!< Instance the graph was built on
+    std::any _graph_op                     ; //!< Copy of the captured operator, see same_operator()
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_GRAPH_GMRES_HH */
@@ -32,21 +32,148 @@
 
 #include <SKL/utils/device.h>
 #include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
 
 #include <Kokkos_Core.hpp>
 #include <Sacado.hpp>
 
+#include <type_traits>
+
 namespace utils {
 
+template< size_t n_der >
 SKL_REAL SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
-norm( skl::fad_view<SKL_REAL> v ) {
+norm( skl::sfad_view_t<n_der> v ) {
     SKL_REAL sum{0} ; 
-    for( int ii=0; ii<v.extent(0); ++vv) {
-        sum += math::int_pow<2>(v(ii).val()) ; 
+    for( int ii=0; ii<v.extent(0); ++ii) {
+        sum += v(ii).val() * v(ii).val() ; 
     }
     return Kokkos::sqrt(sum) ; 
 }
 
 }
 
+namespace skl {
+
+namespace detail {
+
+/**
+ * @brief Refresh a cached linearization at the beginning of a 
+ *        solve, for residuals which provide one.
+ */
+template< typename res_t, typename x_t >
+void linearize_if_supported(res_t& res, x_t const& x) {
+    if constexpr ( requires { res.linearize(x) ; } ) {
+        res.linearize(x) ; 
+    }
+}
+
+/*
+ * The solvers launch their own kernels on a user provided execution 
+ * space instance. Residuals and preconditioners may accept the 
+ * instance as their first argument, in which case their work is 
+ * enqueued on it as well. Otherwise they launch on the default 
+ * instance and, if the solver runs on a different one (fence == true),
+ * both are fenced around the call to keep the ordering.
+ */
+
+template< typename exec_t, typename res_t, typename x_t >
+void linearize_if_supported(exec_t const& space, bool fence, res_t& res, x_t const& x) {
+    if constexpr ( requires { res.linearize(space, x) ; } ) {
+        res.linearize(space, x) ; 
+    } else if constexpr ( requires { res.linearize(x) ; } ) {
+        if( fence ) space.fence("skl::linearize") ; 
+        res.linearize(x) ; 
+        if( fence ) Kokkos::DefaultExecutionSpace().fence("skl::linearize") ; 
+    }
+}
+
+template< typename exec_t, typename res_t, typename x_t, typename r_t >
+void compute_residual(exec_t const& space, bool fence, res_t& res, x_t const& x, r_t const& r) {
+    if constexpr ( requires { res.compute_residual(space, x, r) ; } ) {
+        res.compute_residual(space, x, r) ; 
+    } else {
+        if( fence ) space.fence("skl::compute_residual") ; 
+        res.compute_residual(x, r) ; 
+        if( fence ) Kokkos::DefaultExecutionSpace().fence("skl::compute_residual") ; 
+    }
+}
+
+template< typename exec_t, typename res_t, typename x_t, typename v_t, typename jv_t >
+void jvp(exec_t const& space, bool fence, res_t& res, x_t const& x, v_t const& v, jv_t const& Jv) {
+    if constexpr ( requires { res.jvp(space, x, v, Jv) ; } ) {
+        res.jvp(space, x, v, Jv) ; 
+    } else {
+        if( fence ) space.fence("skl::jvp") ; 
+        res.jvp(x, v, Jv) ; 
+        if( fence ) Kokkos::DefaultExecutionSpace().fence("skl::jvp") ; 
+    }
+}
+
+/**
+ * @brief Whether a residual accepts plain SKL_REAL Views as 
+ *        directions and results of jvp().
+ * 
+ * Residuals opt in by declaring 
+ * <code>static constexpr bool plain_directions = true</code>.
+ */
+template< typename res_t >
+constexpr bool plain_directions = requires { requires std::remove_cvref_t<res_t>::plain_directions ; } ; 
+
+/**
+ * @brief Jv = J(x) v for plain SKL_REAL Krylov vectors.
+ * 
+ * If the residual accepts plain directions they are passed through,
+ * otherwise v is copied into the value of v_seed and the value of 
+ * jv_seed is extracted into Jv.
+ */
+template< typename exec_t, typename res_t, typename x_t, typename v_t, typename jv_t, typename seed_t >
+void plain_jvp( exec_t const& space, bool fence, res_t& res, x_t const& x, v_t const& v, jv_t const& Jv
+              , seed_t const& v_seed, seed_t const& jv_seed ) 
+{
+    if constexpr ( plain_directions<res_t> ) {
+        jvp(space, fence, res, x, v, Jv) ; 
+    } else {
+        using seed_value_t = typename seed_t::non_const_value_type ; 
+        Kokkos::RangePolicy<exec_t> policy(space, 0, v.extent(0)) ; 
+        Kokkos::parallel_for("skl::seed_direction", policy
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                v_seed(i) = v(i) ; 
+            }) ; 
+        jvp(space, fence, res, x, v_seed, jv_seed) ; 
+        Kokkos::parallel_for("skl::extract_jvp", policy
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                Jv(i) = Sacado::ScalarValue<seed_value_t>::eval(jv_seed(i)) ; 
+            }) ; 
+    }
+}
+
+template< typename exec_t, typename res_t, typename x_t, typename V_t, typename JV_t >
+void block_jvp(exec_t const& space, bool fence, res_t& res, x_t const& x, V_t const& V, JV_t const& JV) {
+    if constexpr ( requires { res.block_jvp(space, x, V, JV) ; } ) {
+        res.block_jvp(space, x, V, JV) ; 
+    } else {
+        if( fence ) space.fence("skl::block_jvp") ; 
+        res.block_jvp(x, V, JV) ; 
+        if( fence ) Kokkos::DefaultExecutionSpace().fence("skl::block_jvp") ; 
+    }
+}
+
+template< typename exec_t, typename prec_t, typename r_t, typename z_t >
+void apply_preconditioner(exec_t const& space, bool fence, prec_t const& prec, r_t const& r, z_t const& z) {
+    if constexpr ( requires { prec.apply(space, r, z) ; } ) {
+        prec.apply(space, r, z) ; 
+    } else {
+        if( fence ) space.fence("skl::apply_preconditioner") ; 
+        prec.apply(r, z) ; 
+        if( fence ) Kokkos::DefaultExecutionSpace().fence("skl::apply_preconditioner") ; 
+    }
+}
+
+}
+
+}
+
 #endif 
\ No newline at end of file
@@ -0,0 +1,323 @@
+/**
+ * @file jacobian.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Vector mode AD assembly of collocation Jacobians.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_JACOBIAN_HH
+#define SKL_SOLVERS_JACOBIAN_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+#include <KokkosSparse_CrsMatrix.hpp>
+
+#include <Sacado.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Sparsity pattern and column coloring of a Jacobian.
+ * \ingroup solvers
+ * 
+ * The pattern is stored in CRS format. Columns are colored with a 
+ * greedy distance-2 coloring, i.e. two columns which have a non-zero 
+ * in a common row never share a color. All columns of one color 
+ * can then be seeded in the same tangent direction and the Jacobian
+ * is recovered from n_colors() directional derivatives rather than N.
+ */
+class jacobian_pattern 
+{
+ public:
+    using index_view_t = Kokkos::View<size_t*, Kokkos::DefaultExecutionSpace> ; 
+    using entry_view_t = Kokkos::View<int*,    Kokkos::DefaultExecutionSpace> ; 
+
+    /**
+     * @brief Build a pattern from host CRS arrays.
+     * 
+     * @param N       Number of rows and columns.
+     * @param row_map Row offsets, size N+1.
+     * @param entries Column indices, size row_map[N].
+     */
+    jacobian_pattern( size_t N, std::vector<size_t> const& row_map, std::vector<int> const& entries ) 
+     : _N(N), _n_colors(0)
+    {
+        std::vector<int> colors(N, -1) ; 
+        color(row_map, entries, colors) ; 
+        upload(row_map, entries, colors) ; 
+    }
+
+    /**
+     * @brief Fully coupled pattern, every column has its own color.
+     */
+    static jacobian_pattern dense(size_t N) {
+        std::vector<size_t> row_map(N+1) ; 
+        std::vector<int> entries(N*N) ; 
+        for( size_t i=0; i<=N; ++i) row_map[i] = i*N ; 
+        for( size_t i=0; i<N; ++i) for( size_t j=0; j<N; ++j) entries[i*N+j] = j ; 
+        return jacobian_pattern(N, row_map, entries) ; 
+    }
+
+    /**
+     * @brief Pattern of a tensor product collocation discretization.
+     * 
+     * Points are ordered lexicographically with the last extent 
+     * running fastest and the n_vars unknowns of each point are 
+     * stored contiguously. Derivative matrices couple a point to 
+     * all points on the coordinate lines through it, and point-wise
+     * terms couple all variables at a point.
+     * 
+     * @param extents Number of collocation points per direction.
+     * @param n_vars  Number of unknowns per point.
+     */
+    static jacobian_pattern tensor_product(std::vector<size_t> const& extents, size_t n_vars = 1) {
+        size_t const dim = extents.size() ; 
+        std::vector<size_t> stride(dim, 1) ; 
+        for( int d=static_cast<int>(dim)-2; d>=0; --d) stride[d] = stride[d+1] * extents[d+1] ; 
+        size_t n_points = 1 ; 
+        for( auto const& e: extents ) n_points *= e ; 
+        size_t const N = n_points * n_vars ; 
+
+        std::vector<size_t> row_map(N+1, 0) ; 
+        std::vector<int> entries ; 
+        std::vector<size_t> cols ; 
+        for( size_t p=0; p<n_points; ++p) {
+            // Points sharing a coordinate line with p
+            cols.clear() ; 
+            cols.push_back(p) ; 
+            for( size_t d=0; d<dim; ++d) {
+                size_t const id = (p / stride[d]) % extents[d] ; 
+                size_t const p0 = p - id * stride[d] ; 
+                for( size_t l=0; l<extents[d]; ++l) {
+                    if( l != id ) cols.push_back(p0 + l * stride[d]) ; 
+                }
+            }
+            std::sort(cols.begin(), cols.end()) ; 
+            for( size_t v=0; v<n_vars; ++v) {
+                for( auto const& q: cols ) for( size_t w=0; w<n_vars; ++w) {
+                    entries.push_back(static_cast<int>(q * n_vars + w)) ; 
+                }
+                row_map[p*n_vars+v+1] = entries.size() ; 
+            }
+        }
+        return jacobian_pattern(N, row_map, entries) ; 
+    }
+
+    size_t size()     const { return _N ; }
+    size_t nnz()      const { return _entries.extent(0) ; }
+    size_t n_colors() const { return _n_colors ; }
+    index_view_t row_map() const { return _row_map ; }
+    entry_view_t entries() const { return _entries ; }
+    entry_view_t colors()  const { return _colors  ; }
+
+ private:
+
+    void color( std::vector<size_t> const& row_map
+              , std::vector<int> const& entries
+              , std::vector<int>& colors ) 
+    {
+        // Transpose of the pattern: rows in which each column appears
+        std::vector<size_t> col_map(_N+1, 0) ; 
+        for( auto const& j: entries ) col_map[j+1]++ ; 
+        for( size_t j=0; j<_N; ++j) col_map[j+1] += col_map[j] ; 
+        std::vector<size_t> rows(entries.size()) ; 
+        std::vector<size_t> fill(col_map.begin(), col_map.end()-1) ; 
+        for( size_t i=0; i<_N; ++i) for( size_t e=row_map[i]; e<row_map[i+1]; ++e) {
+            rows[fill[entries[e]]++] = i ; 
+        }
+
+        std::vector<size_t> forbidden(_N, _N) ; 
+        for( size_t j=0; j<_N; ++j) {
+            for( size_t e=col_map[j]; e<col_map[j+1]; ++e) {
+                size_t const i = rows[e] ; 
+                for( size_t f=row_map[i]; f<row_map[i+1]; ++f) {
+                    int const c = colors[entries[f]] ; 
+                    if( c >= 0 ) forbidden[c] = j ; 
+                }
+            }
+            int c = 0 ; 
+            while( forbidden[c] == j ) ++c ; 
+            colors[j] = c ; 
+            _n_colors = std::max(_n_colors, static_cast<size_t>(c+1)) ; 
+        }
+    }
+
+    void upload( std::vector<size_t> const& row_map
+               , std::vector<int> const& entries
+               , std::vector<int> const& colors ) 
+    {
+        _row_map = index_view_t("jacobian_row_map", _N+1) ; 
+        _entries = entry_view_t("jacobian_entries", entries.size()) ; 
+        _colors  = entry_view_t("jacobian_colors", _N) ; 
+        Kokkos::deep_copy(_row_map, Kokkos::View<size_t const*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(row_map.data(), _N+1)) ; 
+        Kokkos::deep_copy(_entries, Kokkos::View<int const*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(entries.data(), entries.size())) ; 
+        Kokkos::deep_copy(_colors,  Kokkos::View<int const*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(colors.data(), _N)) ; 
+    }
+
+    size_t _N          ; //!< Number of rows and columns
+    size_t _n_colors   ; //!< Number of column colors
+    index_view_t _row_map ; //!< CRS row offsets
+    entry_view_t _entries ; //!< CRS column indices
+    entry_view_t _colors  ; //!< Color of each column
+} ; 
+
+/**
+ * @brief Vector mode AD assembly of the Jacobian of a residual.
+ * \ingroup solvers
+ * 
+ * Each residual evaluation is performed in sfad_t<k> arithmetic
+ * with k colors seeded at once, so that the full Jacobian costs 
+ * ceil(n_colors/k) residual evaluations. The residual object must 
+ * provide <code>res.compute_residual(x, r)</code> templated on the 
+ * View types, as required by the Krylov solvers.
+ * 
+ * @tparam k Number of tangent directions per residual evaluation.
+ */
+template< size_t k >
+class jacobian_assembler 
+{
+ public:
+    using seed_view_t    = sfad_view_t<k> ; 
+    using dense_matrix_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ; 
+    using crs_matrix_t   = KokkosSparse::CrsMatrix<SKL_REAL, int, Kokkos::DefaultExecutionSpace, void, size_t> ; 
+
+    jacobian_assembler( jacobian_pattern const& pattern ) 
+     : _pattern(pattern)
+    {
+        Kokkos::realloc(xs, _pattern.size(), k+1) ; 
+        Kokkos::realloc(rs, _pattern.size(), k+1) ; 
+    }
+
+    jacobian_pattern const& pattern() const { return _pattern ; }
+
+    /**
+     * @brief Number of residual evaluations per assembly.
+     */
+    size_t passes() const { return (_pattern.n_colors() + k - 1) / k ; }
+
+    /**
+     * @brief Allocate a CRS matrix with the sparsity of the pattern.
+     */
+    crs_matrix_t create_crs() const {
+        Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> values("jacobian_values", _pattern.nnz()) ; 
+        return crs_matrix_t("jacobian", _pattern.size(), _pattern.size(), _pattern.nnz()
+                           , values, _pattern.row_map(), _pattern.entries()) ; 
+    }
+
+    /**
+     * @brief Assemble J(x) into a dense column major matrix.
+     * 
+     * @param res Residual object.
+     * @param x   State at which the Jacobian is evaluated.
+     * @param J   N x N matrix (output).
+     */
+    template< typename res_t, typename x_t >
+    void assemble(res_t& res, x_t const& x, dense_matrix_t const& J) {
+        Kokkos::deep_copy(J, 0.) ; 
+        auto row_map = _pattern.row_map() ; 
+        auto entries = _pattern.entries() ; 
+        auto colors  = _pattern.colors()  ; 
+        auto _rs = rs ; 
+        for( size_t c0=0; c0<_pattern.n_colors(); c0+=k) {
+            seed(res, x, c0) ; 
+            Kokkos::parallel_for("jacobian::extract_dense", _pattern.size()
+                                , KOKKOS_LAMBDA (int i) 
+                {
+                    for( size_t e=row_map(i); e<row_map(i+1); ++e) {
+                        int const j = entries(e) ; 
+                        int const d = colors(j) - static_cast<int>(c0) ; 
+                        if( d >= 0 and d < static_cast<int>(k) ) {
+                            J(i,j) = _rs(i).fastAccessDx(d) ; 
+                        }
+                    }
+                }) ; 
+        }
+    }
+
+    /**
+     * @brief Assemble J(x) into the values of a CRS matrix created 
+     *        by create_crs().
+     * 
+     * @param res Residual object.
+     * @param x   State at which the Jacobian is evaluated.
+     * @param J   CRS matrix (output).
+     */
+    template< typename res_t, typename x_t >
+    void assemble(res_t& res, x_t const& x, crs_matrix_t const& J) {
+        auto row_map = _pattern.row_map() ; 
+        auto entries = _pattern.entries() ; 
+        auto colors  = _pattern.colors()  ; 
+        auto values  = J.values ; 
+        auto _rs = rs ; 
+        for( size_t c0=0; c0<_pattern.n_colors(); c0+=k) {
+            seed(res, x, c0) ; 
+            Kokkos::parallel_for("jacobian::extract_crs", _pattern.size()
+                                , KOKKOS_LAMBDA (int i) 
+                {
+                    for( size_t e=row_map(i); e<row_map(i+1); ++e) {
+                        int const d = colors(entries(e)) - static_cast<int>(c0) ; 
+                        if( d >= 0 and d < static_cast<int>(k) ) {
+                            values(e) = _rs(i).fastAccessDx(d) ; 
+                        }
+                    }
+                }) ; 
+        }
+    }
+
+ private:
+
+    /**
+     * @brief Seed colors [c0, c0+k) and evaluate the residual.
+     */
+    template< typename res_t, typename x_t >
+    void seed(res_t& res, x_t const& x, size_t c0) {
+        using value_t = typename x_t::non_const_value_type ; 
+        auto colors = _pattern.colors() ; 
+        auto _xs = xs ; 
+        Kokkos::parallel_for("jacobian::seed", _pattern.size()
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                _xs(i) = sfad_t<k>(Sacado::ScalarValue<value_t>::eval(x(i))) ; 
+                int const d = colors(i) - static_cast<int>(c0) ; 
+                if( d >= 0 and d < static_cast<int>(k) ) {
+                    _xs(i).fastAccessDx(d) = 1. ; 
+                }
+            }) ; 
+        res.compute_residual(xs, rs) ; 
+    }
+
+    jacobian_pattern _pattern ; //!< Sparsity pattern and coloring
+    seed_view_t xs, rs        ; //!< Seeded state and residual
+} ; 
+
+}
+
+#endif /* SKL_SOLVERS_JACOBIAN_HH */
@@ -0,0 +1,286 @@
+/**
+ * @file linearized_operator.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Cached linearization of point-wise collocation residuals.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_LINEARIZED_OPERATOR_HH
+#define SKL_SOLVERS_LINEARIZED_OPERATOR_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/workspace.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+namespace skl {
+
+/**
+ * @brief Residual of a second order point-wise collocation problem
+ *        with a cached linearization.
+ * \ingroup solvers
+ * 
+ * The problem is described by a point-wise function 
+ * <code>pde(i, x, u, u_x, u_xx)</code>, templated on the scalar type,
+ * which returns F_i given the physical coordinate and the value and 
+ * derivatives of the solution at collocation point i (boundary rows
+ * are expressed through the same function, switching on i).
+ * 
+ * compute_residual() evaluates F in the arithmetic of its arguments.
+ * linearize(u) runs a single sfad_t<3> pass to store the coefficient
+ * fields a = dF/du, b = dF/du_x, c = dF/du_xx at u. Afterwards 
+ * jvp() applies J v = a v + b D v + c D2 v in plain SKL_REAL, 
+ * independently of the Fad type of the Krylov vectors. The Krylov 
+ * solvers call linearize() at the start of every solve(), so the 
+ * nonlinear residual is evaluated in Fad arithmetic once per Newton 
+ * step instead of once per Krylov iteration. If a workspace is given,
+ * the temporaries of compute_residual() are taken from it.
+ * 
+ * @tparam pde_t  Point-wise residual.
+ * @tparam op_t   Spectral operator, e.g. chebyshev_collocation.
+ * @tparam grid_t Mapped grid built on the operator points.
+ */
+template< typename pde_t, typename op_t, typename grid_t >
+class linearized_residual 
+{
+ public:
+    using view_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ; 
+
+    //! jvp() takes directions of any scalar type, Krylov vectors are passed unseeded
+    static constexpr bool plain_directions = true ; 
+
+    linearized_residual( pde_t const& pde, op_t const& op, grid_t const& grid, workspace<>* ws = nullptr ) 
+     : _pde(pde), _op(op), _grid(grid), _N(grid.size()), _ws(ws)
+     , a("linearized_a", _N), b("linearized_b", _N), c("linearized_c", _N)
+     , v0("linearized_v", _N), dv("linearized_dv", _N), d2v("linearized_d2v", _N)
+     , _linearized(false)
+    {}
+
+    /**
+     * @brief Evaluate F(u) in the arithmetic of u.
+     */
+    template< typename u_t, typename r_t >
+    void compute_residual(u_t const& u, r_t const& r) {
+        using value_t = typename u_t::non_const_value_type ; 
+        using tmp_t   = Kokkos::View<value_t*, Kokkos::DefaultExecutionSpace> ; 
+        size_t const ws_mark = _ws != nullptr ? _ws->mark() : 0 ; 
+        auto make_tmp = [&] (const char label[]) {
+            if constexpr ( Sacado::IsFad<value_t>::value ) {
+                size_t const dim = Kokkos::dimension_scalar(u) ; 
+                return _ws != nullptr ? tmp_t(_ws->template view<tmp_t>(_N, dim)) : tmp_t(label, _N, dim) ; 
+            } else {
+                return _ws != nullptr ? tmp_t(_ws->template view<tmp_t>(_N)) : tmp_t(label, _N) ; 
+            }
+        } ; 
+        tmp_t ux  = make_tmp("linearized_ux")  ; 
+        tmp_t uxx = make_tmp("linearized_uxx") ; 
+        _op.derivative(_grid, u, ux) ; 
+        _op.second_derivative(_grid, u, uxx) ; 
+        auto const pde = _pde ; auto x = _grid.physical() ; 
+        Kokkos::parallel_for("linearized_residual::residual", _N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                r(i) = pde(i, x(i), value_t(u(i)), value_t(ux(i)), value_t(uxx(i))) ; 
+            }) ; 
+        if( _ws != nullptr ) {
+            _ws->release(ws_mark) ; 
+        }
+    }
+
+    /**
+     * @brief Store the coefficient fields of the linearization at u.
+     */
+    template< typename u_t >
+    void linearize(u_t const& u) {
+        using u_value_t = typename u_t::non_const_value_type ; 
+        using fad_t = sfad_t<3> ; 
+        auto _v = v0 ; 
+        Kokkos::parallel_for("linearized_residual::values", _N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                _v(i) = Sacado::ScalarValue<u_value_t>::eval(u(i)) ; 
+            }) ; 
+        _op.derivative(_grid, v0, dv) ; 
+        _op.second_derivative(_grid, v0, d2v) ; 
+        auto const pde = _pde ; auto x = _grid.physical() ; 
+        auto _a = a ; auto _b = b ; auto _c = c ; auto _dv = dv ; auto _d2v = d2v ; 
+        Kokkos::parallel_for("linearized_residual::linearize", _N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                fad_t const U  (3, 0, _v(i))   ; 
+                fad_t const UX (3, 1, _dv(i))  ; 
+                fad_t const UXX(3, 2, _d2v(i)) ; 
+                fad_t const F = pde(i, x(i), U, UX, UXX) ; 
+                _a(i) = F.dx(0) ; 
+                _b(i) = F.dx(1) ; 
+                _c(i) = F.dx(2) ; 
+            }) ; 
+        _linearized = true ; 
+    }
+
+    /**
+     * @brief Apply the cached linearization, Jv = a v + b D v + c D2 v.
+     * 
+     * The state argument is only kept for compatibility with the 
+     * residual contract of the solvers, the Jacobian is the one 
+     * stored by the last call to linearize().
+     */
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) {
+        using v_value_t = typename v_t::non_const_value_type ; 
+        if( not _linearized ) {
+            linearize(x) ; 
+        }
+        auto _v = v0 ; 
+        Kokkos::parallel_for("linearized_residual::copy", _N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                _v(i) = Sacado::ScalarValue<v_value_t>::eval(v(i)) ; 
+            }) ; 
+        _op.derivative(_grid, v0, dv) ; 
+        _op.second_derivative(_grid, v0, d2v) ; 
+        auto _a = a ; auto _b = b ; auto _c = c ; auto _dv = dv ; auto _d2v = d2v ; 
+        Kokkos::parallel_for("linearized_residual::jvp", _N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                Jv(i) = _a(i) * _v(i) + _b(i) * _dv(i) + _c(i) * _d2v(i) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Device callable application of the cached linearization.
+     * 
+     * The returned functor computes rows of Jv = a v + b D v + c D2 v
+     * for plain SKL_REAL Views, with the chain rule of the grid applied
+     * inline: <code>op.row(i, v)</code> returns row i, and 
+     * <code>op(team, v, Jv)</code> fills Jv cooperatively within a 
+     * thread team. It is meant for solvers which apply the operator 
+     * from inside their own kernels, such as skl::team_gmres and 
+     * skl::graph_gmres. The functor shares the coefficient fields with
+     * the residual, i.e. it follows later calls to linearize().
+     */
+    auto device_operator() const requires requires { _op.D() ; _op.D2() ; } 
+    {
+        if( not _linearized ) {
+            Kokkos::abort("linearized_residual: linearize() must be called before device_operator().") ; 
+        }
+        return device_operator_t<decltype(_op.D())>{ a, b, c, _grid.dxi_dx(), _grid.d2xi_dx2(), _op.D(), _op.D2(), _N } ; 
+    }
+
+    //! Operator used by skl::team_gmres, see device_operator()
+    auto team_operator() const requires requires { _op.D() ; _op.D2() ; } { return device_operator() ; }
+
+    //! Operator used by skl::graph_gmres, see device_operator()
+    auto row_operator() const requires requires { _op.D() ; _op.D2() ; } { return device_operator() ; }
+
+    /**
+     * @brief Diagonal of the cached linearization,
+     *        J_ii = a + b dxi/dx D_ii + c ( (dxi/dx)^2 D2_ii + d2xi/dx2 D_ii ).
+     *
+     * @param diag Diagonal entries (output).
+     */
+    template< typename d_t >
+    void diagonal(d_t const& diag) const requires requires { _op.D() ; _op.D2() ; }
+    {
+        auto const op = device_operator() ;
+        Kokkos::parallel_for("linearized_residual::diagonal", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                SKL_REAL const Dii = op.D(i,i), D2ii = op.D2(i,i) ;
+                diag(i) = op.a(i) + op.b(i) * op.d1(i) * Dii
+                        + op.c(i) * ( op.d1(i) * op.d1(i) * D2ii + op.d2(i) * Dii ) ;
+            }) ;
+    }
+
+    /**
+     * @brief Drop the cached linearization, the next jvp()
+     *        linearizes at its state argument.
+     */
+    void invalidate() { _linearized = false ; }
+
+    //! Point-wise residual, e.g. to change its parameters between solves
+    pde_t&       pde()       { return _pde ; }
+    pde_t const& pde() const { return _pde ; }
+
+    bool linearized() const { return _linearized ; }
+    view_t dF_du()   const { return a ; }
+    view_t dF_dux()  const { return b ; }
+    view_t dF_duxx() const { return c ; }
+
+ private:
+    template< typename matrix_t >
+    struct device_operator_t {
+        view_t a, b, c     ; //!< Coefficient fields
+        view_t d1, d2      ; //!< Metric factors of the grid
+        matrix_t D, D2     ; //!< Logical derivative matrices
+        size_t N           ; //!< Number of collocation points
+
+        //! Whether both functors read the same fields and matrices
+        bool same_as(device_operator_t const& o) const {
+            return a.data()  == o.a.data()  and b.data()  == o.b.data()  and c.data() == o.c.data()
+               and d1.data() == o.d1.data() and d2.data() == o.d2.data()
+               and D.data()  == o.D.data()  and D2.data() == o.D2.data() and N == o.N ;
+        }
+
+        //! Row i of J v
+        template< typename v_t >
+        KOKKOS_INLINE_FUNCTION
+        SKL_REAL row(int i, v_t const& v) const {
+            SKL_REAL s1 { 0. }, s2 { 0. } ; 
+            for( size_t j=0; j<N; ++j) {
+                s1 += D(i,j)  * v(j) ; 
+                s2 += D2(i,j) * v(j) ; 
+            }
+            return a(i) * v(i) + b(i) * d1(i) * s1 + c(i) * ( d1(i) * d1(i) * s2 + d2(i) * s1 ) ; 
+        }
+
+        //! Jv = J v, cooperatively within a team
+        template< typename team_t, typename v_t, typename jv_t >
+        KOKKOS_INLINE_FUNCTION
+        void operator() (team_t const& team, v_t const& v, jv_t const& Jv) const {
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&] (int i) 
+            {
+                Jv(i) = row(i, v) ; 
+            }) ; 
+        }
+    } ; 
+
+    pde_t  _pde  ; //!< Point-wise residual
+    op_t   _op   ; //!< Spectral operator
+    grid_t _grid ; //!< Mapped grid
+    size_t _N    ; //!< Number of collocation points
+    workspace<>* _ws    ; //!< Optional arena for temporaries
+    view_t a, b, c      ; //!< Coefficient fields of the linearization
+    view_t v0, dv, d2v  ; //!< Workspace for the operator application
+    bool _linearized    ; //!< Whether a, b, c are valid
+} ; 
+
+}
+
+#endif /* SKL_SOLVERS_LINEARIZED_OPERATOR_HH */
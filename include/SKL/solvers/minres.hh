@@ -0,0 +1,224 @@
+/**
+ * @file minres.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Preconditioned MINRES solver for symmetric systems.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SOLVERS_MINRES_HH
+#define SKL_SOLVERS_MINRES_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+#include <SKL/preconditioners/identity.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace skl {
+
+/**
+ * @brief MINRES solver for the linearized residual.
+ * \ingroup solvers
+ *
+ * Same interface as skl::gmres and skl::cg. The Jacobian must be 
+ * symmetric but may be indefinite, the optional preconditioner 
+ * <code>prec.apply(r, z)</code> must be symmetric positive definite.
+ * This is the Lanczos based algorithm of Paige and Saunders: the 
+ * three term recurrence replaces the Arnoldi orthogonalization of
+ * GMRES, so memory and work per iteration do not grow, and the 
+ * tridiagonal least-squares problem is updated with one Givens 
+ * rotation per step on host scalars.
+ *
+ * The two inner products of a Lanczos step are separated by the 
+ * preconditioner, so they cannot be fused; the vector updates of 
+ * an iteration are done in a single kernel. The convergence 
+ * estimate is the preconditioned residual norm, tracked by the 
+ * rotations without extra reductions: the iteration stops when 
+ * |r|_M^-1 / |F(x)|_M^-1 < tol.
+ */
+class minres {
+
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    minres( size_t problem_size, size_t max_iter, SKL_REAL tol )
+     : _N(problem_size), _max_iter(max_iter), _tol(tol), _iter(0), _err(0)
+     , b("minres_b", _N, 2), r1("minres_r1", _N), r2("minres_r2", _N), v("minres_v", _N)
+     , y("minres_y", _N), w("minres_w", _N), w1("minres_w1", _N), w2("minres_w2", _N), dx("minres_dx", _N)
+    {}
+
+    /**
+     * @brief Solve the linearized system and update the state.
+     *
+     * @tparam res_t  Type of the residual.
+     * @tparam prec_t Type of the preconditioner.
+     * @param res  Residual object.
+     * @param x    State, overwritten by x + dx on exit.
+     * @param prec Symmetric positive definite preconditioner.
+     * @return size_t Number of iterations performed.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = exec_space() ;
+        _fence = false ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space instance.
+     */
+    template< typename res_t, typename prec_t = identity_preconditioner >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x, prec_t const& prec = prec_t{} )
+    {
+        _space = space ;
+        _fence = true ;
+        return solve_impl(res, x, prec) ;
+    }
+
+    size_t iterations() const { return _iter ; }
+    //! Estimate of the relative ( preconditioned ) residual at the end of the last solve
+    SKL_REAL residual() const { return _err ; }
+
+ private:
+
+    template< typename res_t, typename prec_t >
+    size_t solve_impl(res_t& res, vector_t& x, prec_t const& prec)
+    {
+        using namespace Kokkos ;
+        constexpr bool preconditioned = not std::is_same_v<prec_t, identity_preconditioner> ;
+        if constexpr ( not detail::plain_directions<res_t> ) {
+            if( v_seed.extent(0) != _N ) {
+                Kokkos::realloc(v_seed,  _N, 2) ;
+                Kokkos::realloc(jv_seed, _N, 2) ;
+            }
+        }
+
+        _iter = 0 ;
+        _err  = 0 ;
+        detail::linearize_if_supported(_space, _fence, res, x) ;
+        detail::compute_residual(_space, _fence, res, x, b) ; // b = F(x)
+        utils::linalg::scal(_space, r1, SKL_REAL{-1.}, b) ;    // r1 = -F(x)
+        // y = M^-1 r2, without preconditioner r2 is used in place of y
+        deep_copy(_space, r2, r1) ;
+        apply_prec(prec, r2, y) ;
+        SKL_REAL const beta1 = Kokkos::sqrt(utils::linalg::dot(_space, r2, preconditioned ? y : r2)) ;
+        if( beta1 == 0 ) {
+            return 0 ;
+        }
+        deep_copy(_space, dx, 0.) ;
+        deep_copy(_space, w,  0.) ;
+        deep_copy(_space, w2, 0.) ;
+
+        constexpr SKL_REAL eps = 1e-300 ;
+        SKL_REAL beta { beta1 }, oldb { 0. }, dbar { 0. }, epsln { 0. } ;
+        SKL_REAL phibar { beta1 }, cs { -1. }, sn { 0. } ;
+        for( size_t k=0; k<_max_iter; ++k) {
+            // Lanczos step: v = y / beta, y = J v - (beta/oldb) r1 - (alpha/beta) r2
+            utils::linalg::scal(_space, v, 1./beta, preconditioned ? y : r2) ;
+            detail::plain_jvp(_space, _fence, res, x, v, y, v_seed, jv_seed) ;
+            if( k > 0 ) {
+                utils::linalg::axpy(_space, -beta/oldb, r1, y) ;
+            }
+            SKL_REAL const alpha = utils::linalg::dot(_space, v, y) ;
+            utils::linalg::axpy(_space, -alpha/beta, r2, y) ;
+            // r1 <- r2, r2 <- y, the storage of r1 is recycled for y
+            std::swap(r1, r2) ;
+            std::swap(r2, y) ;
+            apply_prec(prec, r2, y) ;
+            oldb = beta ;
+            beta = Kokkos::sqrt(utils::linalg::dot(_space, r2, preconditioned ? y : r2)) ;
+
+            // Apply the previous rotation and compute the new one
+            SKL_REAL const oldeps = epsln ;
+            SKL_REAL const delta  = cs * dbar + sn * alpha ;
+            SKL_REAL const gbar   = sn * dbar - cs * alpha ;
+            epsln = sn * beta ;
+            dbar  = - cs * beta ;
+            SKL_REAL const gamma = Kokkos::fmax(Kokkos::sqrt(gbar*gbar + beta*beta), eps) ;
+            cs = gbar / gamma ;
+            sn = beta / gamma ;
+            SKL_REAL const phi = cs * phibar ;
+            phibar *= sn ;
+
+            // w1 <- w2 <- w, w = (v - oldeps w1 - delta w2) / gamma, dx += phi w
+            std::swap(w1, w2) ;
+            std::swap(w2, w) ;
+            auto _v = v ; auto _w = w ; auto _w1 = w1 ; auto _w2 = w2 ; auto _dx = dx ;
+            parallel_for("minres::update", RangePolicy<exec_space>(_space, 0, _N)
+                        , KOKKOS_LAMBDA (int i)
+                {
+                    _w(i)   = ( _v(i) - oldeps * _w1(i) - delta * _w2(i) ) / gamma ;
+                    _dx(i) += phi * _w(i) ;
+                }) ;
+
+            _iter++ ;
+            _err = phibar / beta1 ;
+            if( _err < _tol or beta == 0 ) {
+                break ;
+            }
+        }
+
+        utils::linalg::axpy(_space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
+
+    template< typename prec_t >
+    void apply_prec(prec_t const& prec, plain_t const& in, plain_t const& out) {
+        if constexpr ( not std::is_same_v<prec_t, identity_preconditioner> ) {
+            detail::apply_preconditioner(_space, _fence, prec, in, out) ;
+        }
+    }
+
+    size_t _N        ; //!< Size of the problem to invert
+    size_t _max_iter ; //!< Maximum number of iterations
+    SKL_REAL _tol    ; //!< Relative tolerance
+    size_t _iter     ; //!< Iterations of the last solve
+    SKL_REAL _err    ; //!< Residual estimate of the last solve
+    vector_t b       ; //!< F(x), in the arithmetic of the residual
+    plain_t r1, r2   ; //!< Last two unnormalized Lanczos vectors
+    plain_t v        ; //!< Current Lanczos vector
+    plain_t y        ; //!< J v, then the preconditioned Lanczos vector
+    plain_t w, w1, w2 ; //!< Search directions
+    plain_t dx       ; //!< Update
+    vector_t v_seed, jv_seed ; //!< Fad directions for residuals without plain_directions
+    exec_space _space ; //!< Execution space instance of the current solve
+    bool _fence { false } ; //!< Whether residual calls need to be ordered with _space
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_MINRES_HH */
@@ -0,0 +1,472 @@
+/**
+ * @file multipatch.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Multi-patch Chebyshev collocation with a Schur complement interface solve.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SOLVERS_MULTIPATCH_HH
+#define SKL_SOLVERS_MULTIPATCH_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/mappings/mapped_grid.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include <Sacado.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Newton solver for second order point-wise collocation problems
+ *        on a chain of Chebyshev patches.
+ * \ingroup solvers
+ * 
+ * The interval is split into patches, each with its own coordinate 
+ * mapping and number of Chebyshev points. Patch p maps [-1,1] onto 
+ * [x_p, x_{p+1}], i.e. the patches are ordered from left to right and 
+ * neighbours share their end points. The problem is the point-wise 
+ * residual <code>pde(i, x, u, u_x, u_xx)</code> of linearized_residual,
+ * where i runs over the concatenated points of all patches, 
+ * i = offset(p) + j, so that the global boundary rows are i = 0 and 
+ * i = total_size()-1. The rows at the interfaces are never evaluated,
+ * they are replaced by C1 matching: u and u_x are continuous.
+ * 
+ * Every Newton step linearizes all patches in one kernel and 
+ * assembles the patch Jacobians with one team per patch. On each 
+ * patch the update is written as du = w + dL hL + dR hR, where w 
+ * solves the Newton system with homogeneous Dirichlet data at the 
+ * interfaces and hL, hR are the responses to unit Dirichlet data on 
+ * either side. Continuity of u_x at the interfaces then yields a 
+ * tridiagonal Schur complement system for the interface values, which
+ * is solved directly (LAPACK GTTRF). The patch Jacobians are LU 
+ * factored on host (LAPACK GETRF), the patches concurrently on 
+ * Kokkos::DefaultHostExecutionSpace. 
+ * 
+ * Under MPI the patches are distributed over the ranks of a 
+ * communicator in contiguous blocks. Only ten numbers per patch enter
+ * the Schur complement, they are exchanged with one MPI_Allreduce and
+ * every rank solves the interface system redundantly. The Views 
+ * returned by solution() and points() hold the local patches only.
+ * 
+ * @tparam pde_t     Point-wise residual, templated on the scalar type.
+ * @tparam mapping_t Coordinate mapping, shared by all patches.
+ */
+template< typename pde_t, typename mapping_t >
+class multipatch_solver 
+{
+ public:
+    //! Values per patch and point, padded to the largest patch
+    using view_t   = Kokkos::View<SKL_REAL**,  Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace> ; 
+    using matrix_t = Kokkos::View<SKL_REAL***, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace> ; 
+
+    /**
+     * @brief Construct the solver, with a zero initial guess.
+     * 
+     * @param pde   Point-wise residual.
+     * @param maps  Coordinate mapping of each patch, from left to right.
+     * @param sizes Number of collocation points of each patch.
+     * @param comm  Communicator the patches are distributed over. 
+     *              Ignored if MPI has not been initialized.
+     */
+    multipatch_solver( pde_t const& pde
+                     , std::vector<mapping_t> const& maps
+                     , std::vector<size_t> const& sizes
+                     , MPI_Comm comm = MPI_COMM_SELF ) 
+     : _pde(pde), _sizes(sizes), _P(maps.size()), _comm(comm), _rank(0), _n_ranks(1)
+    {
+        if( _P == 0 or sizes.size() != _P ) {
+            Kokkos::abort("multipatch_solver: one size per patch is needed.") ; 
+        }
+        int mpi_initialized ; 
+        MPI_Initialized(&mpi_initialized) ; 
+        if( mpi_initialized ) {
+            MPI_Comm_rank(_comm, &_rank) ; 
+            MPI_Comm_size(_comm, &_n_ranks) ; 
+        }
+        _p_begin = _P * _rank / _n_ranks ; 
+        _p_end   = _P * (_rank+1) / _n_ranks ; 
+        _P_local = _p_end - _p_begin ; 
+
+        _offsets.resize(_P+1, 0) ; 
+        for( size_t p=0; p<_P; ++p) {
+            if( sizes[p] < 3 ) {
+                Kokkos::abort("multipatch_solver: patches need at least three points.") ; 
+            }
+            _offsets[p+1] = _offsets[p] + sizes[p] ; 
+        }
+        _N_max = *std::max_element(sizes.begin(), sizes.end()) ; 
+
+        // Patches must tile the interval from left to right
+        for( size_t p=0; p<_P; ++p) {
+            SKL_REAL const xl = maps[p].template log_to_phys<SKL_REAL>(-1.) ; 
+            SKL_REAL const xr = maps[p].template log_to_phys<SKL_REAL>( 1.) ; 
+            if( not (xr > xl) ) {
+                Kokkos::abort("multipatch_solver: patches must map [-1,1] onto increasing intervals.") ; 
+            }
+            if( p > 0 ) {
+                SKL_REAL const xp = maps[p-1].template log_to_phys<SKL_REAL>(1.) ; 
+                if( Kokkos::abs(xl - xp) > 1e-12 * Kokkos::fmax(1., Kokkos::abs(xl)) ) {
+                    Kokkos::abort("multipatch_solver: neighbouring patches must share their end points.") ; 
+                }
+            }
+        }
+
+        size_t const Pl = _P_local, N = _N_max ; 
+        _n      = Kokkos::View<int*, Kokkos::DefaultExecutionSpace>("multipatch_n", Pl) ; 
+        _offset = Kokkos::View<int*, Kokkos::DefaultExecutionSpace>("multipatch_offset", Pl) ; 
+        _x  = view_t("multipatch_x",  Pl, N) ; 
+        _d1 = view_t("multipatch_d1", Pl, N) ; 
+        _d2 = view_t("multipatch_d2", Pl, N) ; 
+        _u  = view_t("multipatch_u",  Pl, N) ; 
+        _F  = view_t("multipatch_F",  Pl, N) ; 
+        _a  = view_t("multipatch_a",  Pl, N) ; 
+        _b  = view_t("multipatch_b",  Pl, N) ; 
+        _c  = view_t("multipatch_c",  Pl, N) ; 
+        _D  = matrix_t("multipatch_D",  Pl, N, N) ; 
+        _D2 = matrix_t("multipatch_D2", Pl, N, N) ; 
+        _LU = matrix_t("multipatch_LU", Pl, N, N) ; 
+
+        auto h_n      = Kokkos::create_mirror_view(_n) ; 
+        auto h_offset = Kokkos::create_mirror_view(_offset) ; 
+        for( size_t lp=0; lp<Pl; ++lp) {
+            size_t const p = _p_begin + lp, n = sizes[p] ; 
+            h_n(lp) = n ; h_offset(lp) = _offsets[p] ; 
+            chebyshev_collocation cheb(n) ; 
+            mapped_grid<mapping_t> grid(maps[p], cheb.points()) ; 
+            auto const pts = Kokkos::make_pair(size_t{0}, n) ; 
+            Kokkos::deep_copy(Kokkos::subview(_x,  lp, pts), grid.physical()) ; 
+            Kokkos::deep_copy(Kokkos::subview(_d1, lp, pts), grid.dxi_dx()) ; 
+            Kokkos::deep_copy(Kokkos::subview(_d2, lp, pts), grid.d2xi_dx2()) ; 
+            Kokkos::deep_copy(Kokkos::subview(_D,  lp, pts, pts), cheb.D()) ; 
+            Kokkos::deep_copy(Kokkos::subview(_D2, lp, pts, pts), cheb.D2()) ; 
+        }
+        Kokkos::deep_copy(_n, h_n) ; 
+        Kokkos::deep_copy(_offset, h_offset) ; 
+
+        _h_x   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), _x)  ; 
+        _h_d1  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), _d1) ; 
+        _h_D   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), _D)  ; 
+        _h_u   = Kokkos::create_mirror_view(_u)  ; 
+        _h_F   = Kokkos::create_mirror_view(_F)  ; 
+        _h_LU  = Kokkos::create_mirror_view(_LU) ; 
+        _h_R    = host_matrix_t("multipatch_R", Pl, 3, N) ; 
+        _h_ipiv = Kokkos::View<int**, Kokkos::LayoutRight, Kokkos::HostSpace>("multipatch_ipiv", Pl, N) ; 
+        _gamma.assign(_P-1, 0.) ; 
+    }
+
+    //! Maximum number of Newton steps and absolute tolerance on the update
+    void set_newton(size_t max_iter, SKL_REAL tol) { _max_newton = max_iter ; _newton_tol = tol ; }
+
+    /**
+     * @brief Set the state from a host callable f(x) evaluated at the
+     *        physical collocation points.
+     */
+    template< typename f_t >
+    void set_state(f_t const& f) {
+        for( size_t lp=0; lp<_P_local; ++lp) {
+            for( size_t i=0; i<_sizes[_p_begin+lp]; ++i) _h_u(lp,i) = f(_h_x(lp,i)) ; 
+        }
+        Kokkos::deep_copy(_u, _h_u) ; 
+    }
+
+    /**
+     * @brief Run Newton iterations until the update drops below the 
+     *        tolerance.
+     * 
+     * @return size_t Number of Newton steps.
+     */
+    size_t solve() {
+        _steps = 0 ; _converged = false ; 
+        while( _steps < _max_newton and not _converged ) {
+            _converged = step() < _newton_tol ; 
+            ++_steps ; 
+        }
+        return _steps ; 
+    }
+
+    /**
+     * @brief One Newton step on all patches.
+     * 
+     * @return SKL_REAL Maximum norm of the update over all patches.
+     */
+    SKL_REAL step() {
+        linearize() ; 
+        assemble() ; 
+        std::vector<SKL_REAL> ends = patch_solves() ; 
+        if( _n_ranks > 1 ) {
+            MPI_Allreduce(MPI_IN_PLACE, ends.data(), static_cast<int>(ends.size()), mpi_real(), MPI_SUM, _comm) ; 
+        }
+        interface_solve(ends) ; 
+        SKL_REAL du = update() ; 
+        if( _n_ranks > 1 ) {
+            MPI_Allreduce(MPI_IN_PLACE, &du, 1, mpi_real(), MPI_MAX, _comm) ; 
+        }
+        return du ; 
+    }
+
+    size_t n_patches()     const { return _P ; }
+    size_t local_patches() const { return _P_local ; }
+    size_t first_patch()   const { return _p_begin ; }
+    size_t size(size_t p)  const { return _sizes[p] ; }
+    size_t offset(size_t p) const { return _offsets[p] ; }
+    size_t total_size()    const { return _offsets[_P] ; }
+    size_t newton_steps()  const { return _steps ; }
+    bool converged()       const { return _converged ; }
+    //! Values of the solution at the interfaces, from left to right
+    std::vector<SKL_REAL> const& interface_values() const { return _gamma ; }
+    //! Solution on the local patches, entry (lp, i) for point i of patch first_patch() + lp
+    view_t solution() const { return _u ; }
+    //! Physical collocation points of the local patches
+    view_t points()   const { return _x ; }
+
+ private:
+    using host_matrix_t = Kokkos::View<SKL_REAL***, Kokkos::LayoutRight, Kokkos::HostSpace> ; 
+
+    //! Number of values per patch entering the Schur complement
+    static constexpr size_t n_ends = 10 ; 
+
+    static MPI_Datatype mpi_real() { 
+        return std::is_same_v<SKL_REAL, double> ? MPI_DOUBLE : MPI_FLOAT ; 
+    }
+
+    /**
+     * @brief Residual and coefficient fields a = dF/du, b = dF/du_x, 
+     *        c = dF/du_xx of all local patches, interface rows become 
+     *        identity rows with vanishing residual.
+     */
+    void linearize() {
+        using fad_t = sfad_t<3> ; 
+        auto const pde = _pde ; 
+        auto n = _n ; auto offset = _offset ; auto x = _x ; auto d1 = _d1 ; auto d2 = _d2 ; 
+        auto D = _D ; auto D2 = _D2 ; auto u = _u ; auto F = _F ; auto a = _a ; auto b = _b ; auto c = _c ; 
+        int const p_begin = _p_begin, P = _P ; 
+        Kokkos::parallel_for("multipatch::linearize"
+                            , Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0}, {_P_local, _N_max})
+                            , KOKKOS_LAMBDA (int lp, int i) 
+            {
+                int const N = n(lp) ; 
+                if( i >= N ) return ; 
+                bool const first = p_begin + lp == 0, last = p_begin + lp == P-1 ; 
+                if( (i == 0 and not first) or (i == N-1 and not last) ) {
+                    F(lp,i) = 0. ; a(lp,i) = 1. ; b(lp,i) = 0. ; c(lp,i) = 0. ; 
+                    return ; 
+                }
+                SKL_REAL s1 { 0. }, s2 { 0. } ; 
+                for( int j=0; j<N; ++j) {
+                    s1 += D(lp,i,j)  * u(lp,j) ; 
+                    s2 += D2(lp,i,j) * u(lp,j) ; 
+                }
+                fad_t const U  (3, 0, u(lp,i)) ; 
+                fad_t const UX (3, 1, d1(lp,i) * s1) ; 
+                fad_t const UXX(3, 2, d1(lp,i) * d1(lp,i) * s2 + d2(lp,i) * s1) ; 
+                fad_t const R = pde(offset(lp) + i, x(lp,i), U, UX, UXX) ; 
+                F(lp,i) = R.val()   ; 
+                a(lp,i) = R.dx(0) ; 
+                b(lp,i) = R.dx(1) ; 
+                c(lp,i) = R.dx(2) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Patch Jacobians J = a + b dxi/dx D + c ( (dxi/dx)^2 D2 + d2xi/dx2 D ),
+     *        one team per patch, stored column major for LAPACK.
+     */
+    void assemble() {
+        using team_t = typename Kokkos::TeamPolicy<>::member_type ; 
+        auto n = _n ; auto d1 = _d1 ; auto d2 = _d2 ; auto D = _D ; auto D2 = _D2 ; 
+        auto a = _a ; auto b = _b ; auto c = _c ; auto LU = _LU ; 
+        Kokkos::parallel_for("multipatch::assemble", Kokkos::TeamPolicy<>(_P_local, Kokkos::AUTO, Kokkos::AUTO)
+                            , KOKKOS_LAMBDA (team_t const& team) 
+            {
+                int const lp = team.league_rank() ; 
+                int const N = n(lp) ; 
+                Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&] (int i) 
+                {
+                    SKL_REAL const bi = b(lp,i) * d1(lp,i) ; 
+                    SKL_REAL const ci = c(lp,i) * d1(lp,i) * d1(lp,i) ; 
+                    SKL_REAL const ei = c(lp,i) * d2(lp,i) ; 
+                    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, N), [&] (int j) 
+                    {
+                        LU(lp,j,i) = (i == j ? a(lp,i) : 0.) + (bi + ei) * D(lp,i,j) + ci * D2(lp,i,j) ; 
+                    }) ; 
+                }) ; 
+            }) ; 
+    }
+
+    //! Physical derivative at point i of local patch lp of the values v
+    SKL_REAL end_derivative(size_t lp, size_t i, SKL_REAL const* v, size_t stride = 1) const {
+        SKL_REAL s { 0. } ; 
+        for( size_t j=0; j<_sizes[_p_begin+lp]; ++j) s += _h_D(lp,i,j) * v[j*stride] ; 
+        return _h_d1(lp,i) * s ; 
+    }
+
+    /**
+     * @brief Factor the patch Jacobians and solve for w, hL and hR.
+     * 
+     * @return Per patch hL_x, hR_x and w_x at the left and right end, 
+     *         u at both ends and u_x at both ends, zero for patches 
+     *         owned by other ranks.
+     */
+    std::vector<SKL_REAL> patch_solves() {
+        Kokkos::deep_copy(_h_LU, _LU) ; 
+        Kokkos::deep_copy(_h_F,  _F)  ; 
+        std::vector<SKL_REAL> ends(n_ends * _P, 0.) ; 
+        int const lda = _N_max ; 
+        Kokkos::parallel_for("multipatch::patch_solves"
+                            , Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, _P_local)
+                            , [&] (int lp) 
+            {
+                size_t const p = _p_begin + lp ; 
+                int const N = _sizes[p] ; 
+                Teuchos::LAPACK<int, SKL_REAL> lapack ; 
+                int info { 0 } ; 
+                lapack.GETRF(N, N, &_h_LU(lp,0,0), lda, &_h_ipiv(lp,0), &info) ; 
+                if( info != 0 ) {
+                    Kokkos::abort("multipatch_solver: singular patch Jacobian.") ; 
+                }
+                for( int k=0; k<3; ++k) for( int i=0; i<N; ++i) _h_R(lp,k,i) = 0. ; 
+                for( int i=0; i<N; ++i) _h_R(lp,0,i) = - _h_F(lp,i) ; 
+                if( p > 0    ) _h_R(lp,1,0)   = 1. ; 
+                if( p < _P-1 ) _h_R(lp,2,N-1) = 1. ; 
+                lapack.GETRS('N', N, 3, &_h_LU(lp,0,0), lda, &_h_ipiv(lp,0), &_h_R(lp,0,0), lda, &info) ; 
+                if( info != 0 ) {
+                    Kokkos::abort("multipatch_solver: patch solve failed.") ; 
+                }
+
+                SKL_REAL* e = ends.data() + n_ends * p ; 
+                e[0] = end_derivative(lp, 0,   &_h_R(lp,1,0)) ; 
+                e[1] = end_derivative(lp, N-1, &_h_R(lp,1,0)) ; 
+                e[2] = end_derivative(lp, 0,   &_h_R(lp,2,0)) ; 
+                e[3] = end_derivative(lp, N-1, &_h_R(lp,2,0)) ; 
+                e[4] = end_derivative(lp, 0,   &_h_R(lp,0,0)) ; 
+                e[5] = end_derivative(lp, N-1, &_h_R(lp,0,0)) ; 
+                e[6] = _h_u(lp,0) ; 
+                e[7] = _h_u(lp,N-1) ; 
+                e[8] = end_derivative(lp, 0,   &_h_u(lp,0)) ; 
+                e[9] = end_derivative(lp, N-1, &_h_u(lp,0)) ; 
+            }) ; 
+        return ends ; 
+    }
+
+    /**
+     * @brief Solve the tridiagonal Schur complement for the new 
+     *        interface values, continuity of u_x at interface k 
+     *        between patches k and k+1.
+     */
+    void interface_solve(std::vector<SKL_REAL> const& ends) {
+        int const K = _P - 1 ; 
+        if( K == 0 ) return ; 
+        std::vector<SKL_REAL> dl(std::max(K-1,1), 0.), d(K), du(std::max(K-1,1), 0.), du2(std::max(K-2,1), 0.) ; 
+        std::vector<int> ipiv(K) ; 
+        for( int k=0; k<K; ++k) {
+            SKL_REAL const* L = ends.data() + n_ends * k     ; 
+            SKL_REAL const* R = ends.data() + n_ends * (k+1) ; 
+            d[k] = L[3] - R[0] ; 
+            if( k > 0   ) dl[k-1] =  L[1] ; 
+            if( k < K-1 ) du[k]   = -R[2] ; 
+            _gamma[k] = R[8] + R[4] - R[6] * R[0] - R[7] * R[2] 
+                      - L[9] - L[5] + L[6] * L[1] + L[7] * L[3] ; 
+        }
+        Teuchos::LAPACK<int, SKL_REAL> lapack ; 
+        int info { 0 } ; 
+        lapack.GTTRF(K, dl.data(), d.data(), du.data(), du2.data(), ipiv.data(), &info) ; 
+        if( info != 0 ) {
+            Kokkos::abort("multipatch_solver: singular interface system.") ; 
+        }
+        lapack.GTTRS('N', K, 1, dl.data(), d.data(), du.data(), du2.data(), ipiv.data(), _gamma.data(), K, &info) ; 
+        if( info != 0 ) {
+            Kokkos::abort("multipatch_solver: interface solve failed.") ; 
+        }
+    }
+
+    /**
+     * @brief Apply du = w + dL hL + dR hR on the local patches.
+     * 
+     * @return SKL_REAL Maximum norm of the local update.
+     */
+    SKL_REAL update() {
+        SKL_REAL du_max { 0. } ; 
+        Kokkos::parallel_reduce("multipatch::update"
+                               , Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, _P_local)
+                               , [&] (int lp, SKL_REAL& m) 
+            {
+                size_t const p = _p_begin + lp ; 
+                int const N = _sizes[p] ; 
+                SKL_REAL const dL = p > 0    ? _gamma[p-1] - _h_u(lp,0)   : 0. ; 
+                SKL_REAL const dR = p < _P-1 ? _gamma[p]   - _h_u(lp,N-1) : 0. ; 
+                for( int i=0; i<N; ++i) {
+                    SKL_REAL const du = _h_R(lp,0,i) + dL * _h_R(lp,1,i) + dR * _h_R(lp,2,i) ; 
+                    _h_u(lp,i) += du ; 
+                    m = Kokkos::fmax(m, Kokkos::abs(du)) ; 
+                }
+            }, Kokkos::Max<SKL_REAL>(du_max)) ; 
+        Kokkos::deep_copy(_u, _h_u) ; 
+        return _P_local > 0 ? du_max : SKL_REAL(0.) ; 
+    }
+
+    pde_t _pde ; //!< Point-wise residual
+    std::vector<size_t> _sizes   ; //!< Number of points of each patch
+    std::vector<size_t> _offsets ; //!< Index of the first point of each patch
+    size_t _P       ; //!< Number of patches
+    size_t _P_local ; //!< Number of patches on this rank
+    size_t _p_begin, _p_end ; //!< Patches on this rank
+    size_t _N_max   ; //!< Largest patch
+    MPI_Comm _comm  ; //!< Communicator the patches are distributed over
+    int _rank, _n_ranks ; //!< Rank and size of the communicator
+
+    size_t _max_newton { 20 }     ; //!< Maximum number of Newton steps
+    SKL_REAL _newton_tol { 1e-10 } ; //!< Tolerance on the Newton update
+    size_t _steps { 0 }    ; //!< Newton steps of the last solve()
+    bool _converged { false } ; //!< Whether the last solve() converged
+
+    Kokkos::View<int*, Kokkos::DefaultExecutionSpace> _n, _offset ; //!< Size and global offset of the local patches
+    view_t _x, _d1, _d2   ; //!< Physical points and metric factors
+    view_t _u, _F         ; //!< State and residual
+    view_t _a, _b, _c     ; //!< Coefficient fields of the linearization
+    matrix_t _D, _D2      ; //!< Logical derivative matrices
+    matrix_t _LU          ; //!< Patch Jacobians, column major
+
+    typename view_t::HostMirror _h_x, _h_d1, _h_u, _h_F ; //!< Host copies
+    typename matrix_t::HostMirror _h_D, _h_LU ; //!< Host copies, _h_LU holds the LU factors
+    host_matrix_t _h_R ; //!< w, hL and hR of each patch, column major
+    Kokkos::View<int**, Kokkos::LayoutRight, Kokkos::HostSpace> _h_ipiv ; //!< Pivots of the patch LUs
+    std::vector<SKL_REAL> _gamma ; //!< Interface values
+} ; 
+
+}
+
+#endif /* SKL_SOLVERS_MULTIPATCH_HH */
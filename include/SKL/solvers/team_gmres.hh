@@ -0,0 +1,279 @@
+/**
+ * @file team_gmres.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Restarted GMRES running in a single team kernel.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_SOLVERS_TEAM_GMRES_HH
+#define SKL_SOLVERS_TEAM_GMRES_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/helpers.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+namespace skl {
+
+/**
+ * @brief Restarted GMRES for small systems, run as one team kernel.
+ * \ingroup solvers
+ *
+ * For problems of up to a few hundred unknowns the multi-kernel
+ * skl::gmres is dominated by launch and fence overhead. This solver
+ * launches a single team which performs all restart cycles: the
+ * Krylov basis, the Hessenberg matrix and the Givens data live in
+ * team scratch memory, projections use team level dot and nrm2, and
+ * the Givens updates and the back substitution are done by one
+ * thread of the team. The only host round-trip per solve is the
+ * read back of the iteration count.
+ *
+ * Besides the usual <code>res.compute_residual(x, r)</code> the
+ * residual must provide <code>res.team_operator()</code>, returning
+ * a device copyable functor <code>op(team, v, Jv)</code> that stores
+ * J v in Jv cooperatively within the team, for plain SKL_REAL Views
+ * v and Jv. The linearization is refreshed through
+ * <code>res.linearize(x)</code> if available, as in skl::gmres.
+ * Preconditioning is not supported.
+ *
+ * test/bench_team_gmres.cc times this solver against skl::gmres over
+ * a range of sizes; where the crossover lies depends on the backend
+ * and has to be measured there.
+ */
+class team_gmres {
+
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using exec_space = Kokkos::DefaultExecutionSpace ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    team_gmres( size_t problem_size, size_t max_iter, SKL_REAL tol, size_t max_restarts = 10 )
+     : _N(problem_size), _max_iter(max_iter), _max_restarts(max_restarts), _tol(tol)
+     , _iter(0), _restart(0)
+     , b("team_gmres_b", _N), dx("team_gmres_dx", _N), F("team_gmres_F", _N, 2)
+     , stats("team_gmres_stats", 2)
+    {}
+
+    /**
+     * @brief Bytes of team scratch memory needed for a given size.
+     */
+    static size_t scratch_size(size_t N, size_t max_iter) {
+        size_t const m = max_iter ;
+        return scratch_matrix_t::shmem_size(N, m+1)     // Q
+             + scratch_matrix_t::shmem_size(m+1, m)     // H
+             + 4 * scratch_vector_t::shmem_size(m+1)    // cs, sn, g, y
+             + scratch_vector_t::shmem_size(N) ;        // w
+    }
+
+    /**
+     * @brief Whether the scratch memory fits the fast ( level 0 )
+     *        team scratch, i.e. whether this solver is expected to
+     *        outperform skl::gmres.
+     */
+    static bool fits_level0(size_t N, size_t max_iter) {
+        return scratch_size(N, max_iter) <= level0_bytes ;
+    }
+
+    template< typename res_t >
+    size_t solve(res_t& res, vector_t& x)
+    {
+        return solve(exec_space(), res, x) ;
+    }
+
+    /**
+     * @brief Solve the linearized system on an execution space
+     *        instance and update the state.
+     *
+     * @tparam res_t Type of the residual.
+     * @param space Execution space instance.
+     * @param res   Residual object.
+     * @param x     State, overwritten by x + dx on exit.
+     * @return size_t Total number of Arnoldi iterations performed.
+     */
+    template< typename res_t >
+    size_t solve(exec_space const& space, res_t& res, vector_t& x)
+    {
+        using namespace Kokkos ;
+        static_assert( requires { res.team_operator() ; }
+                     , "team_gmres needs a residual providing team_operator()." ) ;
+        bool const fence = not (space == exec_space()) ;
+        detail::linearize_if_supported(space, fence, res, x) ;
+        detail::compute_residual(space, fence, res, x, F) ;
+
+        auto _b = b ; auto _F = F ;
+        parallel_for("team_gmres::rhs", RangePolicy<exec_space>(space, 0, _N)
+                    , KOKKOS_LAMBDA (int i) { _b(i) = -_F(i).val() ; }) ;
+        SKL_REAL const b_norm = utils::linalg::nrm2(space, b) ;
+        if( b_norm == 0 ) {
+            return 0 ;
+        }
+        deep_copy(space, dx, 0.) ;
+
+        auto const op = res.team_operator() ;
+        size_t const N = _N, m = _max_iter, max_restarts = _max_restarts ;
+        SKL_REAL const tol = _tol ;
+        auto _dx = dx ; auto _stats = stats ;
+
+        size_t const bytes = scratch_size(N, m) ;
+        int const level = bytes <= level0_bytes ? 0 : 1 ;
+        TeamPolicy<exec_space> policy(space, 1, AUTO) ;
+        policy.set_scratch_size(level, PerTeam(bytes)) ;
+
+        parallel_for("team_gmres::solve", policy
+                    , KOKKOS_LAMBDA (typename TeamPolicy<exec_space>::member_type const& team)
+            {
+                constexpr SKL_REAL eps = 1e-12 ;
+                scratch_matrix_t Q (team.team_scratch(level), N, m+1) ;
+                scratch_matrix_t H (team.team_scratch(level), m+1, m) ;
+                scratch_vector_t cs(team.team_scratch(level), m+1) ;
+                scratch_vector_t sn(team.team_scratch(level), m+1) ;
+                scratch_vector_t g (team.team_scratch(level), m+1) ;
+                scratch_vector_t y (team.team_scratch(level), m+1) ;
+                scratch_vector_t w (team.team_scratch(level), N) ;
+
+                size_t iter { 0 }, restart { 0 } ;
+                SKL_REAL err { 1. } ;
+                for( ; restart<max_restarts; ++restart) {
+                    // w = b - J dx
+                    op(team, _dx, w) ;
+                    team.team_barrier() ;
+                    parallel_for(TeamThreadRange(team, N), [&] (int i) { w(i) = _b(i) - w(i) ; }) ;
+                    team.team_barrier() ;
+                    SKL_REAL const beta = utils::linalg::nrm2(team, w) ;
+                    err = beta / b_norm ;
+                    if( err < tol ) {
+                        break ;
+                    }
+                    parallel_for(TeamThreadRange(team, N), [&] (int i) { Q(i,0) = w(i) / beta ; }) ;
+                    single(PerTeam(team), [&] () {
+                        for( size_t i=0; i<=m; ++i) g(i) = 0. ;
+                        g(0) = beta ;
+                    }) ;
+                    team.team_barrier() ;
+
+                    size_t n_cols { 0 } ;
+                    for( size_t k=0; k<m; ++k) {
+                        auto q = subview(Q, ALL(), k) ;
+                        op(team, q, w) ;
+                        team.team_barrier() ;
+                        // Modified Gram-Schmidt
+                        for( size_t j=0; j<=k; ++j) {
+                            auto qj = subview(Q, ALL(), j) ;
+                            SKL_REAL const h = utils::linalg::dot(team, qj, w) ;
+                            parallel_for(TeamThreadRange(team, N), [&] (int i) { w(i) -= h * qj(i) ; }) ;
+                            single(PerTeam(team), [&] () { H(j,k) = h ; }) ;
+                            team.team_barrier() ;
+                        }
+                        SKL_REAL const hn = utils::linalg::nrm2(team, w) ;
+                        if( hn > eps ) {
+                            parallel_for(TeamThreadRange(team, N), [&] (int i) { Q(i,k+1) = w(i) / hn ; }) ;
+                        }
+                        // Givens rotations on one thread
+                        single(PerTeam(team), [&] () {
+                            H(k+1,k) = hn ;
+                            for( size_t i=0; i<k; ++i) {
+                                SKL_REAL const t = cs(i) * H(i,k) + sn(i) * H(i+1,k) ;
+                                H(i+1,k) = - sn(i) * H(i,k) + cs(i) * H(i+1,k) ;
+                                H(i,k) = t ;
+                            }
+                            SKL_REAL const v1 = H(k,k), v2 = H(k+1,k) ;
+                            SKL_REAL const t = Kokkos::sqrt(v1*v1 + v2*v2) ;
+                            cs(k) = v1 / t ;
+                            sn(k) = v2 / t ;
+                            H(k,k) = t ;
+                            H(k+1,k) = 0. ;
+                            g(k+1) = - sn(k) * g(k) ;
+                            g(k)  *=   cs(k) ;
+                        }) ;
+                        team.team_barrier() ;
+                        err = Kokkos::fabs(g(k+1)) / b_norm ;
+                        iter++ ;
+                        n_cols = k+1 ;
+                        if( err < tol or hn <= eps ) {
+                            break ;
+                        }
+                    }
+                    // Back substitution and dx = dx + Q y
+                    single(PerTeam(team), [&] () {
+                        for( int i=n_cols-1; i>=0; --i) {
+                            SKL_REAL v = g(i) ;
+                            for( size_t j=i+1; j<n_cols; ++j) v -= H(i,j) * y(j) ;
+                            y(i) = v / H(i,i) ;
+                        }
+                    }) ;
+                    team.team_barrier() ;
+                    parallel_for(TeamThreadRange(team, N), [&] (int i) {
+                        SKL_REAL sum { 0. } ;
+                        for( size_t j=0; j<n_cols; ++j) sum += Q(i,j) * y(j) ;
+                        _dx(i) += sum ;
+                    }) ;
+                    team.team_barrier() ;
+                    if( err < tol ) {
+                        ++restart ;
+                        break ;
+                    }
+                }
+                single(PerTeam(team), [&] () {
+                    _stats(0) = iter ;
+                    _stats(1) = restart ;
+                }) ;
+            }) ;
+
+        auto h_stats = create_mirror_view_and_copy(HostSpace(), stats) ;
+        _iter    = h_stats(0) ;
+        _restart = h_stats(1) ;
+        utils::linalg::axpy(space, SKL_REAL{1.}, dx, x) ;
+        return _iter ;
+    }
+
+    size_t iterations() const { return _iter ; }
+    size_t restarts()   const { return _restart ; }
+
+ private:
+    using scratch_space_t  = typename exec_space::scratch_memory_space ;
+    using scratch_matrix_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, scratch_space_t, Kokkos::MemoryUnmanaged> ;
+    using scratch_vector_t = Kokkos::View<SKL_REAL*, scratch_space_t, Kokkos::MemoryUnmanaged> ;
+
+    static constexpr size_t level0_bytes = 32 * 1024 ; //!< Level 0 scratch budget per team
+
+    size_t _N            ; //!< Size of the problem to invert
+    size_t _max_iter     ; //!< Maximum number of iterations before restart
+    size_t _max_restarts ; //!< Maximum number of restarts
+    SKL_REAL _tol        ; //!< Relative tolerance
+    size_t _iter         ; //!< Iterations of the last solve
+    size_t _restart      ; //!< Restart cycles of the last solve
+    plain_t b, dx        ; //!< Rhs and update
+    vector_t F           ; //!< Residual in the arithmetic of the state
+    Kokkos::View<size_t*, Kokkos::DefaultExecutionSpace> stats ; //!< Iterations and restarts, written by the kernel
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_TEAM_GMRES_HH */
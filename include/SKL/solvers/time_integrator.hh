@@ -0,0 +1,639 @@
+/**
+ * @file time_integrator.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Implicit BDF and IMEX Runge-Kutta time integration of collocation problems.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SOLVERS_TIME_INTEGRATOR_HH
+#define SKL_SOLVERS_TIME_INTEGRATOR_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/helpers.hh>
+#include <SKL/solvers/linearized_operator.hh>
+#include <SKL/preconditioners/identity.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+namespace skl {
+
+//! Time integration schemes of skl::implicit_integrator
+enum class time_scheme {
+    bdf1, bdf2, bdf3, bdf4,      //!< Backward differentiation, with extrapolated explicit part ( SBDF )
+    imex_euler, ars222, ars443   //!< Stiffly accurate IMEX Runge-Kutta of Ascher, Ruuth and Spiteri
+} ;
+
+namespace detail {
+
+//! Right hand side which vanishes, the default explicit part of skl::implicit_integrator
+struct zero_rhs {
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        return T(0.) ;
+    }
+} ;
+
+/*
+ * Residual of an implicit stage: gamma ( u - h ) - f(u) on the interior
+ * rows, where h collects the known part of the stage, and the boundary
+ * conditions returned by f itself on the first and last row.
+ */
+template< typename rhs_t >
+struct implicit_stage {
+    rhs_t    f     ; //!< Implicit right hand side
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> h ; //!< Known part of the stage
+    SKL_REAL gamma ; //!< Inverse of the implicit step, 1 / ( a_ii dt )
+    int      N     ; //!< Number of collocation points
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return f(i, x, u, ux, uxx) ;
+        return gamma * ( u - h(i) ) - f(i, x, u, ux, uxx) ;
+    }
+} ;
+
+/*
+ * Forwards a residual to the solvers, but only linearizes it again
+ * once it has been marked stale. skl::gmres calls linearize() at the
+ * start of every solve(), through this wrapper the Jacobian is instead
+ * lagged across Newton steps and time steps.
+ */
+template< typename res_t >
+struct lagged_residual {
+    static constexpr bool plain_directions = detail::plain_directions<res_t> ;
+
+    res_t res           ; //!< Wrapped residual
+    bool  stale { true } ; //!< Whether the next linearize() is carried out
+
+    template< typename x_t, typename r_t >
+    void compute_residual(x_t const& x, r_t const& r) { res.compute_residual(x, r) ; }
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) { res.jvp(x, v, Jv) ; }
+
+    template< typename x_t >
+    void linearize(x_t const& x) {
+        if( stale ) {
+            res.linearize(x) ;
+            stale = false ;
+        }
+    }
+} ;
+
+//! Butcher tableaus of an IMEX Runge-Kutta scheme, the first stage is explicit
+struct imex_tableau {
+    size_t   stages   ; //!< Number of stages, including the explicit first one
+    size_t   order    ; //!< Order of accuracy
+    SKL_REAL A[5][5]  ; //!< Implicit coefficients
+    SKL_REAL Ah[5][5] ; //!< Explicit coefficients
+} ;
+
+inline imex_tableau make_imex_tableau(time_scheme scheme)
+{
+    imex_tableau t {} ;
+    switch( scheme ) {
+    case time_scheme::ars222: {
+        SKL_REAL const g = 1. - 1. / Kokkos::sqrt(2.) ;
+        SKL_REAL const d = 1. - 0.5 / g ;
+        t.stages = 3 ; t.order = 2 ;
+        t.A[1][1]  = g ;
+        t.A[2][1]  = 1. - g ; t.A[2][2] = g ;
+        t.Ah[1][0] = g ;
+        t.Ah[2][0] = d ; t.Ah[2][1] = 1. - d ;
+        break ; }
+    case time_scheme::ars443: {
+        SKL_REAL const A[5][5]  = { {0.}
+                                  , {0., 1./2.}
+                                  , {0., 1./6., 1./2.}
+                                  , {0., -1./2., 1./2., 1./2.}
+                                  , {0., 3./2., -3./2., 1./2., 1./2.} } ;
+        SKL_REAL const Ah[5][5] = { {0.}
+                                  , {1./2.}
+                                  , {11./18., 1./18.}
+                                  , {5./6., -5./6., 1./2.}
+                                  , {1./4., 7./4., 3./4., -7./4.} } ;
+        t.stages = 5 ; t.order = 3 ;
+        for( int i=0; i<5; ++i) for( int j=0; j<5; ++j) {
+            t.A[i][j] = A[i][j] ; t.Ah[i][j] = Ah[i][j] ;
+        }
+        break ; }
+    default:
+        t.stages = 2 ; t.order = 1 ;
+        t.A[1][1]  = 1. ;
+        t.Ah[1][0] = 1. ;
+        break ;
+    }
+    return t ;
+}
+
+//! BDF coefficients, u_{n+1} - sum_j alpha_j u_{n-j} = beta dt f(u_{n+1})
+inline constexpr SKL_REAL bdf_alpha[4][4] = { {1.}
+                                            , {4./3., -1./3.}
+                                            , {18./11., -9./11., 2./11.}
+                                            , {48./25., -36./25., 16./25., -3./25.} } ;
+inline constexpr SKL_REAL bdf_beta[4] = { 1., 2./3., 6./11., 12./25. } ;
+
+//! Polynomial extrapolation to t_{n+1} from the values at t_n, ..., t_{n-k}
+inline constexpr SKL_REAL bdf_extrapolation[4][4] = { {1.}
+                                                    , {2., -1.}
+                                                    , {3., -3., 1.}
+                                                    , {4., -6., 4., -1.} } ;
+
+}
+
+/**
+ * @brief Implicit time integrator for Chebyshev collocation problems
+ *        which reuses its Krylov solver, Jacobian and preconditioner
+ *        across steps.
+ * \ingroup solvers
+ *
+ * Integrates du/dt = f_I(u) + f_E(u) on a mapped Chebyshev grid. Both
+ * parts are point-wise functions <code>f(i, x, u, u_x, u_xx)</code>
+ * as in linearized_residual. The first and last row of f_I return
+ * the residual of the boundary conditions, which are imposed as
+ * algebraic constraints at every implicit stage, f_E is not evaluated
+ * there. The explicit part is optional and the right hand sides must
+ * not depend on time.
+ *
+ * The BDF schemes of order k use the last k solutions, the explicit
+ * part is extrapolated from the same steps ( SBDF ). The history is
+ * filled by steps of the third order ARS(4,4,3) scheme, also after
+ * set_state() and after the time step is changed. The IMEX
+ * Runge-Kutta schemes ( Ascher, Ruuth, Spiteri 1997 ) are stiffly
+ * accurate, i.e. the solution is the last stage, and all their
+ * implicit stages share the same diagonal coefficient.
+ *
+ * Each implicit stage gamma ( u - h ) - f_I(u) = 0 is solved by Newton
+ * steps of a single skl::gmres on a linearized_residual, starting
+ * from the extrapolation of the previous steps ( BDF ) or from the
+ * previous stage ( Runge-Kutta ). The Jacobian is lagged: it is only
+ * linearized again every set_lagging() steps, when gamma changes, or
+ * when Newton contracts by less than a half per step. The
+ * preconditioner is updated with it every set_lagging() steps, or
+ * when gamma changes, through <code>prec.update(res, x)</code> with
+ * res the residual() of the integrator, or <code>prec.update(x)</code>.
+ * If Newton does not converge, the stage is retried once from the
+ * same initial guess with a fresh Jacobian and preconditioner before
+ * the integrator aborts. The setup cost is thereby amortized over
+ * many steps, while each step costs a few Krylov iterations.
+ *
+ * The integrator keeps references to its own members in the residual
+ * and in the preconditioners updated by it, copying and moving are
+ * deleted.
+ *
+ * @tparam implicit_t Implicit right hand side, including the boundary rows.
+ * @tparam mapping_t  Coordinate mapping.
+ * @tparam explicit_t Explicit right hand side.
+ */
+template< typename implicit_t, typename mapping_t, typename explicit_t = detail::zero_rhs >
+class implicit_integrator
+{
+ public:
+    using vector_t   = sfad_view_t<1> ;
+    using plain_t    = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ;
+    using history_t  = Kokkos::View<SKL_REAL**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace> ;
+    using grid_t     = mapped_grid<mapping_t> ;
+    using stage_t    = detail::implicit_stage<implicit_t> ;
+    using residual_t = detail::lagged_residual<linearized_residual<stage_t, chebyshev_collocation, grid_t>> ;
+
+    //! Whether an explicit part is integrated
+    static constexpr bool has_explicit = not std::is_same_v<explicit_t, detail::zero_rhs> ;
+
+    /**
+     * @brief Construct the integrator, with a zero initial state.
+     *
+     * @param f_I    Implicit right hand side.
+     * @param map    Coordinate mapping.
+     * @param N      Number of collocation points.
+     * @param scheme Time integration scheme.
+     * @param dt     Time step.
+     * @param f_E    Explicit right hand side.
+     */
+    implicit_integrator( implicit_t const& f_I, mapping_t const& map, size_t N
+                       , time_scheme scheme, SKL_REAL dt, explicit_t const& f_E = explicit_t{} )
+     : _fI(f_I), _fE(f_E), _N(N), _scheme(scheme), _dt(dt)
+     , _tableau(detail::make_imex_tableau(bdf() ? time_scheme::ars443 : scheme))
+     , _cheb(N), _grid(map, _cheb.points())
+     , _h("integrator_h", N)
+     , _res{ linearized_residual<stage_t, chebyshev_collocation, grid_t>(stage_t{f_I, _h, 0., int(N)}, _cheb, _grid) }
+     , _x("integrator_x", N, 2), _x0("integrator_x0", N, 2)
+     , _u("integrator_u", 4, N), _e("integrator_e", 4, N)
+     , _kI("integrator_kI", 5, N), _kE("integrator_kE", 5, N)
+     , _v("integrator_v", N), _ux("integrator_ux", N), _uxx("integrator_uxx", N)
+     , _xold("integrator_xold", N), _dx("integrator_dx", N)
+    {
+        set_krylov(std::min<size_t>(N, 40), 1e-8) ;
+    }
+
+    implicit_integrator(implicit_integrator const&) = delete ;
+    implicit_integrator(implicit_integrator&&) = delete ;
+    implicit_integrator& operator=(implicit_integrator const&) = delete ;
+    implicit_integrator& operator=(implicit_integrator&&) = delete ;
+
+    //! Maximum number of Newton steps per stage and tolerance on the RMS update, relative to 1 + RMS(u)
+    void set_newton(size_t max_iter, SKL_REAL tol) { _max_newton = max_iter ; _newton_tol = tol ; }
+
+    //! Krylov subspace size, relative tolerance and restarts of the linear solves
+    void set_krylov(size_t max_iter, SKL_REAL tol, size_t max_restarts = 20) {
+        _krylov = std::make_unique<gmres>(_N, max_iter, tol, max_restarts) ;
+    }
+
+    //! Maximum number of steps between updates of the Jacobian and of the preconditioner
+    void set_lagging(size_t jacobian_steps, size_t preconditioner_steps) {
+        _jacobian_lag = jacobian_steps ; _preconditioner_lag = preconditioner_steps ;
+    }
+
+    /**
+     * @brief Set the state at the collocation points and the time,
+     *        the BDF history is restarted.
+     */
+    template< typename u_t >
+    void set_state(u_t const& u, SKL_REAL t = 0.) {
+        auto u0 = Kokkos::subview(_u, 0, Kokkos::ALL()) ;
+        Kokkos::parallel_for("implicit_integrator::set_state", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                u0(i) = u(i) ;
+            }) ;
+        _t = t ;
+        _history = 1 ;
+        _refresh = true ;
+        if constexpr ( has_explicit ) {
+            if( bdf() ) {
+                evaluate(_fE, u0, Kokkos::subview(_e, 0, Kokkos::ALL())) ;
+            }
+        }
+    }
+
+    /**
+     * @brief Change the time step, the BDF history is restarted.
+     */
+    void set_time_step(SKL_REAL dt) {
+        if( dt != _dt ) {
+            _dt = dt ;
+            _history = 1 ;
+        }
+    }
+
+    //! Advance by one time step without preconditioner
+    void step() {
+        identity_preconditioner prec ;
+        step(prec) ;
+    }
+
+    /**
+     * @brief Advance by one time step.
+     *
+     * @param prec Right preconditioner of the implicit stages.
+     */
+    template< typename prec_t >
+    void step(prec_t& prec) {
+        _jacobian_age++ ;
+        _preconditioner_age++ ;
+        if( bdf() and _history >= bdf_order() ) {
+            bdf_step(prec) ;
+        } else {
+            runge_kutta_step(prec) ;
+        }
+        push() ;
+        _t += _dt ;
+        _steps++ ;
+    }
+
+    //! Advance to t_end without preconditioner, see advance(t_end, prec)
+    size_t advance(SKL_REAL t_end) {
+        identity_preconditioner prec ;
+        return advance(t_end, prec) ;
+    }
+
+    /**
+     * @brief Advance by the number of time steps closest to
+     *        ( t_end - t ) / dt, the time step is not adjusted.
+     *
+     * @return size_t Number of steps taken.
+     */
+    template< typename prec_t >
+    size_t advance(SKL_REAL t_end, prec_t& prec) {
+        SKL_REAL const n = Kokkos::round( (t_end - _t) / _dt ) ;
+        size_t const steps = n > 0 ? static_cast<size_t>(n) : 0 ;
+        for( size_t s=0; s<steps; ++s) {
+            step(prec) ;
+        }
+        return steps ;
+    }
+
+    SKL_REAL time()      const { return _t  ; }
+    SKL_REAL time_step() const { return _dt ; }
+    size_t   steps()     const { return _steps ; }
+    size_t   size()      const { return _N ; }
+    //! Order of accuracy of the scheme
+    size_t   order()     const { return bdf() ? bdf_order() : _tableau.order ; }
+    //! Solution at the collocation points
+    auto     solution()  const { return Kokkos::subview(_u, 0, Kokkos::ALL()) ; }
+    plain_t  points()    const { return _grid.physical() ; }
+
+    //! Stage residual, the type the preconditioners must be built for
+    residual_t& residual() { return _res ; }
+
+    size_t newton_iterations()      const { return _newton_iterations ; }
+    size_t krylov_iterations()      const { return _krylov_iterations ; }
+    size_t jacobian_updates()       const { return _jacobian_updates ; }
+    size_t preconditioner_updates() const { return _preconditioner_updates ; }
+
+ private:
+    bool   bdf()       const { return _scheme <= time_scheme::bdf4 ; }
+    size_t bdf_order() const { return static_cast<size_t>(_scheme) + 1 ; }
+
+    /*
+     * out = f(u) on the interior rows and 0 on the boundary rows,
+     * for plain u.
+     */
+    template< typename f_t, typename u_t, typename out_t >
+    void evaluate(f_t const& f, u_t const& u, out_t const& out) {
+        _cheb.derivative(_grid, u, _ux) ;
+        _cheb.second_derivative(_grid, u, _uxx) ;
+        auto const fn = f ; auto x = _grid.physical() ; auto ux = _ux ; auto uxx = _uxx ;
+        int const N = _N ;
+        Kokkos::parallel_for("implicit_integrator::evaluate", N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                out(i) = ( i == 0 or i == N-1 ) ? 0. : SKL_REAL(fn(i, x(i), u(i), ux(i), uxx(i))) ;
+            }) ;
+    }
+
+    //! _v = values of _x
+    void stage_values() {
+        auto x = _x ; auto v = _v ;
+        Kokkos::parallel_for("implicit_integrator::values", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                v(i) = x(i).val() ;
+            }) ;
+    }
+
+    template< typename prec_t >
+    void bdf_step(prec_t& prec) {
+        size_t const k = bdf_order() ;
+        size_t const p = std::min(_history, k+1) ;
+        SKL_REAL const beta = detail::bdf_beta[k-1] ;
+        Kokkos::Array<SKL_REAL,4> alpha, e, c ;
+        for( int j=0; j<4; ++j) {
+            alpha[j] = detail::bdf_alpha[k-1][j] ;
+            e[j]     = has_explicit ? beta * _dt * detail::bdf_extrapolation[k-1][j] : 0. ;
+            c[j]     = detail::bdf_extrapolation[p-1][j] ;
+        }
+        auto u = _u ; auto E = _e ; auto h = _h ; auto x = _x ;
+        Kokkos::parallel_for("implicit_integrator::bdf_history", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                SKL_REAL hi { 0. }, xi { 0. } ;
+                for( int j=0; j<4; ++j) {
+                    hi += alpha[j] * u(j,i) + e[j] * E(j,i) ;
+                    xi += c[j] * u(j,i) ;
+                }
+                h(i) = hi ;
+                x(i) = xi ;
+            }) ;
+        solve_stage(1. / ( beta * _dt ), prec) ;
+    }
+
+    template< typename prec_t >
+    void runge_kutta_step(prec_t& prec) {
+        auto const& T = _tableau ;
+        auto u0 = Kokkos::subview(_u, 0, Kokkos::ALL()) ;
+        auto needed = [&] (SKL_REAL const (&a)[5][5], size_t j) {
+            for( size_t s=j+1; s<T.stages; ++s) if( a[s][j] != 0. ) return true ;
+            return false ;
+        } ;
+        if( needed(T.A, 0) ) {
+            evaluate(_fI, u0, Kokkos::subview(_kI, 0, Kokkos::ALL())) ;
+        }
+        if( has_explicit and needed(T.Ah, 0) ) {
+            evaluate(_fE, u0, Kokkos::subview(_kE, 0, Kokkos::ALL())) ;
+        }
+        auto x = _x ;
+        Kokkos::parallel_for("implicit_integrator::rk_guess", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                x(i) = u0(i) ;
+            }) ;
+        auto kI = _kI ; auto kE = _kE ; auto h = _h ;
+        int const N = _N ;
+        for( size_t s=1; s<T.stages; ++s) {
+            Kokkos::Array<SKL_REAL,5> ci, ce ;
+            for( size_t j=0; j<5; ++j) {
+                ci[j] = j < s ? _dt * T.A[s][j] : 0. ;
+                ce[j] = j < s and has_explicit ? _dt * T.Ah[s][j] : 0. ;
+            }
+            Kokkos::parallel_for("implicit_integrator::rk_stage", _N
+                                , KOKKOS_LAMBDA (int i)
+                {
+                    SKL_REAL hi = u0(i) ;
+                    for( int j=0; j<5; ++j) {
+                        hi += ci[j] * kI(j,i) + ce[j] * kE(j,i) ;
+                    }
+                    h(i) = hi ;
+                }) ;
+            SKL_REAL const gamma = 1. / ( _dt * T.A[s][s] ) ;
+            solve_stage(gamma, prec) ;
+            if( needed(T.A, s) ) {
+                Kokkos::parallel_for("implicit_integrator::rk_implicit", _N
+                                    , KOKKOS_LAMBDA (int i)
+                    {
+                        kI(s,i) = ( i == 0 or i == N-1 ) ? 0. : gamma * ( x(i).val() - h(i) ) ;
+                    }) ;
+            }
+            if( has_explicit and needed(T.Ah, s) ) {
+                stage_values() ;
+                evaluate(_fE, _v, Kokkos::subview(_kE, s, Kokkos::ALL())) ;
+            }
+        }
+    }
+
+    /*
+     * Shift the history and store the new solution, with its explicit
+     * part for SBDF. The Runge-Kutta schemes never read _e, f_E is
+     * only evaluated here when the BDF history is in use.
+     */
+    void push() {
+        auto u = _u ; auto x = _x ;
+        bool const shift = bdf() ;
+        Kokkos::parallel_for("implicit_integrator::push", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                if( shift ) {
+                    for( int j=3; j>0; --j) u(j,i) = u(j-1,i) ;
+                }
+                u(0,i) = x(i).val() ;
+            }) ;
+        if constexpr ( has_explicit ) {
+            if( shift ) {
+                auto E = _e ;
+                Kokkos::parallel_for("implicit_integrator::push_explicit", _N
+                                    , KOKKOS_LAMBDA (int i)
+                    {
+                        for( int j=3; j>0; --j) E(j,i) = E(j-1,i) ;
+                    }) ;
+                evaluate(_fE, Kokkos::subview(_u, 0, Kokkos::ALL()), Kokkos::subview(_e, 0, Kokkos::ALL())) ;
+            }
+        }
+        _history = std::min<size_t>(_history + 1, 4) ;
+    }
+
+    /*
+     * Solve gamma ( u - h ) - f_I(u) = 0 starting from _x, with the
+     * lagged Jacobian unless it is out of date.
+     */
+    template< typename prec_t >
+    void solve_stage(SKL_REAL gamma, prec_t& prec) {
+        _res.res.pde().gamma = gamma ;
+        bool const shifted = gamma != _gamma ;
+        if( _refresh or shifted or _jacobian_age >= _jacobian_lag ) {
+            refresh(prec, _refresh or shifted or _preconditioner_age >= _preconditioner_lag) ;
+        }
+        Kokkos::deep_copy(_x0, _x) ;
+        if( newton(prec) ) return ;
+        Kokkos::deep_copy(_x, _x0) ;
+        refresh(prec, true) ;
+        if( newton(prec) ) return ;
+        Kokkos::abort("implicit_integrator: Newton iteration did not converge, reduce the time step.") ;
+    }
+
+    //! Linearize at _x and optionally update the preconditioner
+    template< typename prec_t >
+    void refresh(prec_t& prec, bool with_preconditioner) {
+        _res.stale = true ;
+        _res.linearize(_x) ;
+        _gamma = _res.res.pde().gamma ;
+        _jacobian_age = 0 ;
+        _jacobian_updates++ ;
+        _refresh = false ;
+        if( with_preconditioner ) {
+            if constexpr ( requires { prec.update(_res, _x) ; } ) {
+                prec.update(_res, _x) ;
+                _preconditioner_updates++ ;
+            } else if constexpr ( requires { prec.update(_x) ; } ) {
+                prec.update(_x) ;
+                _preconditioner_updates++ ;
+            }
+            _preconditioner_age = 0 ;
+        }
+    }
+
+    /*
+     * Newton steps on _x until the RMS update drops below the
+     * tolerance. A lagged Jacobian which contracts by less than a half
+     * per step is linearized again at the current iterate.
+     */
+    template< typename prec_t >
+    bool newton(prec_t& prec) {
+        auto x = _x ; auto xo = _xold ; auto d = _dx ;
+        Kokkos::parallel_for("implicit_integrator::newton_start", _N
+                            , KOKKOS_LAMBDA (int i)
+            {
+                xo(i) = x(i).val() ;
+            }) ;
+        SKL_REAL const scale = 1. / Kokkos::sqrt(SKL_REAL(_N)) ;
+        SKL_REAL dx_prev { 0. } ;
+        for( size_t it=0; it<_max_newton; ++it) {
+            _krylov_iterations += _krylov->solve(_res, _x, prec) ;
+            _newton_iterations++ ;
+            Kokkos::parallel_for("implicit_integrator::newton_update", _N
+                                , KOKKOS_LAMBDA (int i)
+                {
+                    d(i)  = x(i).val() - xo(i) ;
+                    xo(i) = x(i).val() ;
+                }) ;
+            SKL_REAL const dx = scale * utils::linalg::nrm2(d) ;
+            if( not Kokkos::isfinite(dx) ) {
+                return false ;
+            }
+            if( dx <= _newton_tol * ( 1. + scale * utils::linalg::nrm2(xo) ) ) {
+                return true ;
+            }
+            if( it > 0 and dx > 0.5 * dx_prev and _jacobian_age > 0 ) {
+                refresh(prec, false) ;
+            }
+            dx_prev = dx ;
+        }
+        return false ;
+    }
+
+    implicit_t  _fI     ; //!< Implicit right hand side
+    explicit_t  _fE     ; //!< Explicit right hand side
+    size_t      _N      ; //!< Number of collocation points
+    time_scheme _scheme ; //!< Time integration scheme
+    SKL_REAL    _dt     ; //!< Time step
+    detail::imex_tableau _tableau ; //!< Runge-Kutta scheme, ARS(4,4,3) for the BDF start-up
+
+    chebyshev_collocation _cheb ; //!< Spectral operator
+    grid_t      _grid   ; //!< Mapped grid
+    plain_t     _h      ; //!< Known part of the current stage
+    residual_t  _res    ; //!< Stage residual with lagged linearization
+    std::unique_ptr<gmres> _krylov ; //!< Krylov solver shared by all stages
+
+    vector_t    _x, _x0 ; //!< Newton iterate and its initial guess
+    history_t   _u, _e  ; //!< Last solutions and their explicit parts, newest first
+    history_t   _kI, _kE ; //!< Implicit and explicit Runge-Kutta stage derivatives
+    plain_t     _v, _ux, _uxx ; //!< Workspace for the explicit evaluations
+    plain_t     _xold, _dx    ; //!< Workspace for the Newton updates
+
+    SKL_REAL _t { 0. }       ; //!< Current time
+    size_t   _steps { 0 }    ; //!< Steps taken
+    size_t   _history { 1 }  ; //!< Number of valid solutions in _u
+    SKL_REAL _gamma { 0. }   ; //!< Shift of the current linearization
+    bool     _refresh { true } ; //!< Whether the next stage must update Jacobian and preconditioner
+
+    size_t   _max_newton { 10 }       ; //!< Maximum Newton steps per stage
+    SKL_REAL _newton_tol { 1e-10 }    ; //!< Tolerance on the relative RMS Newton update
+    size_t   _jacobian_lag { 20 }     ; //!< Maximum steps between linearizations
+    size_t   _preconditioner_lag { 50 } ; //!< Maximum steps between preconditioner updates
+    size_t   _jacobian_age { 0 }      ; //!< Steps since the last linearization
+    size_t   _preconditioner_age { 0 } ; //!< Steps since the last preconditioner update
+
+    size_t   _newton_iterations { 0 }      ; //!< Total Newton steps
+    size_t   _krylov_iterations { 0 }      ; //!< Total Arnoldi iterations
+    size_t   _jacobian_updates { 0 }       ; //!< Total linearizations
+    size_t   _preconditioner_updates { 0 } ; //!< Total preconditioner updates
+} ;
+
+}
+
+#endif /* SKL_SOLVERS_TIME_INTEGRATOR_HH */
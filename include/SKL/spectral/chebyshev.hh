@@ -0,0 +1,252 @@
+/**
+ * @file chebyshev.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Chebyshev-Gauss-Lobatto collocation operators on Kokkos Views.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_SPECTRAL_CHEBYSHEV_HH
+#define SKL_SPECTRAL_CHEBYSHEV_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Sacado.hpp>
+
+namespace skl {
+
+/**
+ * @brief Chebyshev-Gauss-Lobatto collocation on [-1,1].
+ * \ingroup spectral
+ * 
+ * The collocation points are x_i = -cos(pi i/(N-1)), i.e. they
+ * are sorted in ascending order. The first and second derivative
+ * matrices are assembled once on host and kept on device,
+ * together with the table T(j,k) = T_k(x_j) used by the 
+ * transforms between nodal values and Chebyshev coefficients.
+ * All derivative kernels accept Views of Fad types, so that they
+ * can be used inside residual evaluations.
+ */
+class chebyshev_collocation 
+{
+ public:
+    using view_t   = Kokkos::View<SKL_REAL*,  Kokkos::DefaultExecutionSpace> ; 
+    using matrix_t = Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> ; 
+
+    chebyshev_collocation( size_t N ) 
+     : _N(N), _x("chebyshev_x", N), _D("chebyshev_D", N, N), _D2("chebyshev_D2", N, N)
+     , _T("chebyshev_T", N, N)
+    {
+        auto h_x  = Kokkos::create_mirror_view(_x)  ; 
+        auto h_D  = Kokkos::create_mirror_view(_D)  ; 
+        auto h_D2 = Kokkos::create_mirror_view(_D2) ; 
+        auto h_T  = Kokkos::create_mirror_view(_T)  ; 
+        int const n = N-1 ; 
+        for( int i=0; i<=n; ++i) {
+            h_x(i) = -Kokkos::cos(M_PI * i / n) ; 
+        }
+        for( int i=0; i<=n; ++i) {
+            SKL_REAL const ci = (i==0 or i==n) ? 2. : 1. ; 
+            SKL_REAL diag { 0. } ; 
+            for( int j=0; j<=n; ++j) {
+                if( i == j ) continue ; 
+                SKL_REAL const cj = (j==0 or j==n) ? 2. : 1. ; 
+                SKL_REAL const sign = ((i+j)%2 == 0) ? 1. : -1. ; 
+                h_D(i,j) = ci / cj * sign / (h_x(i) - h_x(j)) ; 
+                diag -= h_D(i,j) ; 
+            }
+            // Negative sum trick, exact on constants
+            h_D(i,i) = diag ; 
+        }
+        for( int i=0; i<=n; ++i) for( int j=0; j<=n; ++j) {
+            SKL_REAL sum { 0. } ; 
+            for( int l=0; l<=n; ++l) sum += h_D(i,l) * h_D(l,j) ; 
+            h_D2(i,j) = sum ; 
+        }
+        for( int j=0; j<=n; ++j) for( int k=0; k<=n; ++k) {
+            h_T(j,k) = Kokkos::cos(M_PI * k * (n-j) / n) ; 
+        }
+        Kokkos::deep_copy(_x,  h_x ) ; 
+        Kokkos::deep_copy(_D,  h_D ) ; 
+        Kokkos::deep_copy(_D2, h_D2) ; 
+        Kokkos::deep_copy(_T,  h_T ) ; 
+    }
+
+    size_t size() const { return _N ; }
+    view_t   points() const { return _x  ; }
+    matrix_t D()      const { return _D  ; }
+    matrix_t D2()     const { return _D2 ; }
+    matrix_t T()      const { return _T  ; }
+
+    /**
+     * @brief First derivative with respect to the logical coordinate.
+     * 
+     * @param u  Values at the collocation points.
+     * @param du Derivative at the collocation points (output).
+     */
+    template< typename u_t, typename du_t >
+    void derivative(u_t const& u, du_t const& du) const {
+        using value_t = typename u_t::non_const_value_type ; 
+        auto D = _D ; size_t const N = _N ; 
+        Kokkos::parallel_for("chebyshev::derivative", N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                value_t sum = 0. ; 
+                for( size_t j=0; j<N; ++j) sum += D(i,j) * u(j) ; 
+                du(i) = sum ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Derivative of order 1 or 2 along dimension dim of a 
+     *        rank 2 grid function, with respect to the logical coordinate.
+     * 
+     * Used by tensor products such as tensor_product_2d.
+     */
+    template< typename u_t, typename du_t >
+    void batched_derivative(u_t const& u, du_t const& du, int dim, int order) const {
+        static_assert( u_t::rank() == 2, "batched_derivative needs rank 2 Views." ) ; 
+        using value_t = typename u_t::non_const_value_type ; 
+        auto D = order == 1 ? _D : _D2 ; size_t const N = _N ; 
+        Kokkos::parallel_for("chebyshev::batched_derivative"
+                            , Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0}, {u.extent(0), u.extent(1)})
+                            , KOKKOS_LAMBDA (int p, int q) 
+            {
+                value_t sum = 0. ; 
+                if( dim == 0 ) {
+                    for( size_t j=0; j<N; ++j) sum += D(p,j) * u(j,q) ; 
+                } else {
+                    for( size_t j=0; j<N; ++j) sum += D(q,j) * u(p,j) ; 
+                }
+                du(p,q) = sum ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Chebyshev coefficients of the interpolant through u.
+     * 
+     * c_k = 2/(n cb_k) sum_j T_k(x_j) u_j / cb_j with n = N-1, 
+     * cb_0 = cb_n = 2 and cb_k = 1 otherwise.
+     * 
+     * @param u Values at the collocation points.
+     * @param c Chebyshev coefficients (output).
+     */
+    template< typename u_t, typename c_t >
+    void to_coefficients(u_t const& u, c_t const& c) const {
+        using value_t = typename u_t::non_const_value_type ; 
+        auto T = _T ; size_t const N = _N ; 
+        Kokkos::parallel_for("chebyshev::to_coefficients", N
+                            , KOKKOS_LAMBDA (int k) 
+            {
+                size_t const n = N-1 ; 
+                value_t sum = 0.5 * (T(0,k) * u(0) + T(n,k) * u(n)) ; 
+                for( size_t j=1; j<n; ++j) sum += T(j,k) * u(j) ; 
+                SKL_REAL const ck = (k==0 or k==n) ? 1./n : 2./n ; 
+                c(k) = ck * sum ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Values at the collocation points of a Chebyshev series.
+     * 
+     * @param c Chebyshev coefficients.
+     * @param u Values at the collocation points (output).
+     */
+    template< typename c_t, typename u_t >
+    void from_coefficients(c_t const& c, u_t const& u) const {
+        using value_t = typename c_t::non_const_value_type ; 
+        auto T = _T ; size_t const N = _N ; 
+        Kokkos::parallel_for("chebyshev::from_coefficients", N
+                            , KOKKOS_LAMBDA (int j) 
+            {
+                value_t sum = 0. ; 
+                for( size_t k=0; k<N; ++k) sum += T(j,k) * c(k) ; 
+                u(j) = sum ; 
+            }) ; 
+    }
+
+    /**
+     * @brief First derivative with respect to the physical coordinate.
+     * 
+     * The chain rule factor dxi/dx is read from the grid cache and 
+     * applied inside the derivative kernel.
+     * 
+     * @param grid Mapped grid built on points().
+     * @param u    Values at the collocation points.
+     * @param du   Derivative at the collocation points (output).
+     */
+    template< typename grid_t, typename u_t, typename du_t >
+    void derivative(grid_t const& grid, u_t const& u, du_t const& du) const {
+        using value_t = typename u_t::non_const_value_type ; 
+        auto D = _D ; size_t const N = _N ; auto d1 = grid.dxi_dx() ; 
+        Kokkos::parallel_for("chebyshev::mapped_derivative", N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                value_t sum = 0. ; 
+                for( size_t j=0; j<N; ++j) sum += D(i,j) * u(j) ; 
+                du(i) = d1(i) * sum ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Second derivative with respect to the physical coordinate.
+     * 
+     * Computes (dxi/dx)^2 D2 u + d2xi/dx2 D u in a single kernel.
+     * 
+     * @param grid Mapped grid built on points().
+     * @param u    Values at the collocation points.
+     * @param d2u  Second derivative at the collocation points (output).
+     */
+    template< typename grid_t, typename u_t, typename d2u_t >
+    void second_derivative(grid_t const& grid, u_t const& u, d2u_t const& d2u) const {
+        using value_t = typename u_t::non_const_value_type ; 
+        auto D = _D ; auto D2 = _D2 ; size_t const N = _N ; 
+        auto d1 = grid.dxi_dx() ; auto d2 = grid.d2xi_dx2() ; 
+        Kokkos::parallel_for("chebyshev::mapped_second_derivative", N
+                            , KOKKOS_LAMBDA (int i) 
+            {
+                value_t s1 = 0. ; 
+                value_t s2 = 0. ; 
+                for( size_t j=0; j<N; ++j) {
+                    s1 += D(i,j)  * u(j) ; 
+                    s2 += D2(i,j) * u(j) ; 
+                }
+                d2u(i) = d1(i) * d1(i) * s2 + d2(i) * s1 ; 
+            }) ; 
+    }
+
+ private:
+    size_t _N    ; //!< Number of collocation points
+    view_t _x    ; //!< Collocation points
+    matrix_t _D  ; //!< First derivative matrix
+    matrix_t _D2 ; //!< Second derivative matrix
+    matrix_t _T  ; //!< Chebyshev polynomials at the collocation points
+} ; 
+
+}
+
+#endif /* SKL_SPECTRAL_CHEBYSHEV_HH */
@@ -0,0 +1,278 @@
+/**
+ * @file chebyshev_evaluation.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Evaluation of tensor product Chebyshev series at arbitrary points.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SPECTRAL_CHEBYSHEV_EVALUATION_HH
+#define SKL_SPECTRAL_CHEBYSHEV_EVALUATION_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <array>
+#include <utility>
+
+namespace skl {
+
+namespace detail {
+
+/**
+ * @brief Clenshaw summation of sum_k a_k T_k(xi), k < n, together with
+ *        its first and second derivative with respect to xi.
+ * 
+ * The derivatives follow from differentiating the recurrence 
+ * b_k = a_k + 2 xi b_{k+1} - b_{k+2}, they are only accumulated up to
+ * the requested order. coef(k) is called once per k, in descending 
+ * order, so it may itself be a Clenshaw sum over further dimensions.
+ */
+template< typename coef_t >
+KOKKOS_INLINE_FUNCTION
+void clenshaw(coef_t const& coef, int n, SKL_REAL xi, int order, SKL_REAL (&f)[3]) 
+{
+    SKL_REAL b1 { 0. }, b2 { 0. }, d1 { 0. }, d2 { 0. }, e1 { 0. }, e2 { 0. } ; 
+    for( int k=n-1; k>=1; --k) {
+        SKL_REAL const b = coef(k) + 2. * xi * b1 - b2 ; 
+        if( order > 0 ) {
+            SKL_REAL const d = 2. * b1 + 2. * xi * d1 - d2 ; 
+            if( order > 1 ) {
+                SKL_REAL const e = 4. * d1 + 2. * xi * e1 - e2 ; 
+                e2 = e1 ; e1 = e ; 
+            }
+            d2 = d1 ; d1 = d ; 
+        }
+        b2 = b1 ; b1 = b ; 
+    }
+    f[0] = coef(0) + xi * b1 - b2 ; 
+    f[1] = b1 + xi * d1 - d2 ; 
+    f[2] = 2. * d1 + xi * e1 - e2 ; 
+}
+
+/**
+ * @brief Derivative of the given order with respect to the physical 
+ *        coordinate, from the logical ones and the metric factors.
+ */
+KOKKOS_INLINE_FUNCTION
+SKL_REAL physical_derivative(SKL_REAL const (&f)[3], int order, SKL_REAL dxi_dx, SKL_REAL d2xi_dx2) 
+{
+    if( order == 0 ) return f[0] ; 
+    if( order == 1 ) return f[1] * dxi_dx ; 
+    return f[2] * dxi_dx * dxi_dx + f[1] * d2xi_dx2 ; 
+}
+
+}
+
+/**
+ * @brief Evaluation of tensor product Chebyshev series, and of their
+ *        derivatives, at arbitrary physical points.
+ * \ingroup spectral
+ * 
+ * The series is set either from its coefficients or from nodal values 
+ * on the Chebyshev-Gauss-Lobatto grid of chebyshev_collocation, in 
+ * one to three dimensions. evaluate() runs one kernel over a batch of
+ * points: each point is mapped to logical coordinates with the inverse
+ * coordinate mapping of every dimension, and the series is summed with
+ * nested Clenshaw recurrences, the innermost dimension being the 
+ * contiguous one. Derivatives of order up to two per dimension are 
+ * obtained from the same recurrences and converted to physical ones 
+ * with the metric factors of the mappings. The cost is that of one 
+ * pass over the coefficients per point and no per-point storage is 
+ * needed, so batches of millions of points are cheap compared to 
+ * reconstructing on a fine grid. All dimensions share the mapping 
+ * type, with their own parameters. Points must lie within the mapped
+ * domain, outside of it the series is extrapolated.
+ * 
+ * @tparam dim       Number of dimensions, 1 to 3.
+ * @tparam mapping_t Coordinate mapping of each dimension.
+ */
+template< size_t dim, typename mapping_t >
+class chebyshev_evaluator 
+{
+    static_assert( dim >= 1 and dim <= 3, "chebyshev_evaluator supports one to three dimensions." ) ; 
+
+ public:
+    //! Coefficients, c(k0,k1,k2), unused dimensions have extent 1
+    using coeff_t = Kokkos::View<SKL_REAL***, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace> ; 
+
+    /**
+     * @brief Construct the evaluator.
+     * 
+     * @param N    Number of Chebyshev coefficients per dimension.
+     * @param maps Coordinate mapping of every dimension.
+     */
+    template< typename... maps_t >
+    chebyshev_evaluator( std::array<size_t, dim> const& N, maps_t const& ... maps ) 
+     : _maps{{maps...}}
+    {
+        static_assert( sizeof...(maps_t) == dim, "chebyshev_evaluator needs one mapping per dimension." ) ; 
+        for( size_t a=0; a<3; ++a) _N[a] = a < dim ? N[a] : 1 ; 
+        for( size_t a=0; a<dim; ++a) {
+            if( _N[a] < 2 ) {
+                Kokkos::abort("chebyshev_evaluator: at least 2 points per dimension are needed.") ; 
+            }
+        }
+        _c   = coeff_t("chebyshev_evaluator_c",   _N[0], _N[1], _N[2]) ; 
+        _tmp = coeff_t("chebyshev_evaluator_tmp", _N[0], _N[1], _N[2]) ; 
+    }
+
+    coeff_t coefficients() const { return _c ; }
+
+    /**
+     * @brief Set the series from its coefficients, a View of rank dim.
+     */
+    template< typename c_t >
+    void set_coefficients(c_t const& c) {
+        copy_in(c, _c) ; 
+    }
+
+    /**
+     * @brief Set the series from its values at the Chebyshev-Gauss-Lobatto
+     *        points, a View of rank dim.
+     * 
+     * The transform is applied along one dimension at a time, with the
+     * same normalization as chebyshev_collocation::to_coefficients().
+     */
+    template< typename u_t >
+    void set_values(u_t const& u) {
+        copy_in(u, _tmp) ; 
+        for( size_t a=0; a<dim; ++a) {
+            transform(_tmp, _c, a) ; 
+            std::swap(_tmp, _c) ; 
+        }
+        std::swap(_tmp, _c) ; 
+    }
+
+    /**
+     * @brief Evaluate the series, or one of its derivatives, at a batch 
+     *        of physical points.
+     * 
+     * @param x     Points, x(p) in one dimension and x(p,a) otherwise.
+     * @param f     Values (output), f(p).
+     * @param order Order of the derivative along each dimension, 0 to 2.
+     */
+    template< typename x_t, typename f_t >
+    void evaluate(x_t const& x, f_t const& f, Kokkos::Array<int, dim> const& order = {}) const {
+        evaluate(Kokkos::DefaultExecutionSpace(), x, f, order) ; 
+    }
+
+    /**
+     * @brief Evaluate on an execution space instance.
+     */
+    template< typename exec_t, typename x_t, typename f_t >
+    void evaluate(exec_t const& space, x_t const& x, f_t const& f, Kokkos::Array<int, dim> const& order = {}) const {
+        auto const c = _c ; auto const maps = _maps ; 
+        int const n0 = _N[0], n1 = _N[1], n2 = _N[2] ; 
+        Kokkos::parallel_for("chebyshev_evaluator::evaluate", Kokkos::RangePolicy<exec_t>(space, 0, f.extent(0))
+                            , KOKKOS_LAMBDA (int p) 
+            {
+                SKL_REAL xi[dim], m1[dim], m2[dim] ; 
+                for( size_t a=0; a<dim; ++a) {
+                    SKL_REAL xp ; 
+                    if constexpr ( x_t::rank() == 1 ) {
+                        xp = x(p) ; 
+                    } else {
+                        xp = x(p,a) ; 
+                    }
+                    xi[a] = maps[a].template phys_to_log<SKL_REAL>(xp) ; 
+                    m1[a] = 1. ; m2[a] = 0. ; 
+                    if( order[a] > 0 ) {
+                        maps[a].metric_logical(xi[a], m1[a], m2[a]) ; 
+                    }
+                }
+                SKL_REAL s[3] ; 
+                if constexpr ( dim == 1 ) {
+                    detail::clenshaw([&] (int k0) { return c(k0,0,0) ; }, n0, xi[0], order[0], s) ; 
+                } else if constexpr ( dim == 2 ) {
+                    detail::clenshaw([&] (int k0) {
+                        SKL_REAL s1[3] ; 
+                        detail::clenshaw([&] (int k1) { return c(k0,k1,0) ; }, n1, xi[1], order[1], s1) ; 
+                        return detail::physical_derivative(s1, order[1], m1[1], m2[1]) ; 
+                    }, n0, xi[0], order[0], s) ; 
+                } else {
+                    detail::clenshaw([&] (int k0) {
+                        SKL_REAL s1[3] ; 
+                        detail::clenshaw([&] (int k1) {
+                            SKL_REAL s2[3] ; 
+                            detail::clenshaw([&] (int k2) { return c(k0,k1,k2) ; }, n2, xi[2], order[2], s2) ; 
+                            return detail::physical_derivative(s2, order[2], m1[2], m2[2]) ; 
+                        }, n1, xi[1], order[1], s1) ; 
+                        return detail::physical_derivative(s1, order[1], m1[1], m2[1]) ; 
+                    }, n0, xi[0], order[0], s) ; 
+                }
+                f(p) = detail::physical_derivative(s, order[0], m1[0], m2[0]) ; 
+            }) ; 
+    }
+
+ private:
+    //! Copy a View of rank dim into rank 3 storage
+    template< typename in_t >
+    void copy_in(in_t const& in, coeff_t const& out) const {
+        static_assert( in_t::rank() == dim, "chebyshev_evaluator: the View must have rank dim." ) ; 
+        Kokkos::parallel_for("chebyshev_evaluator::copy"
+                            , Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0,0,0}, {_N[0], _N[1], _N[2]})
+                            , KOKKOS_LAMBDA (int i, int j, int k) 
+            {
+                if constexpr ( dim == 1 ) {
+                    out(i,j,k) = in(i) ; 
+                } else if constexpr ( dim == 2 ) {
+                    out(i,j,k) = in(i,j) ; 
+                } else {
+                    out(i,j,k) = in(i,j,k) ; 
+                }
+            }) ; 
+    }
+
+    //! Nodal values to Chebyshev coefficients along one axis
+    void transform(coeff_t const& in, coeff_t const& out, size_t axis) const {
+        int const n = _N[axis] - 1 ; 
+        Kokkos::parallel_for("chebyshev_evaluator::transform"
+                            , Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0,0,0}, {_N[0], _N[1], _N[2]})
+                            , KOKKOS_LAMBDA (int i0, int i1, int i2) 
+            {
+                int idx[3] = { i0, i1, i2 } ; 
+                int const k = idx[axis] ; 
+                SKL_REAL sum { 0. } ; 
+                for( int j=0; j<=n; ++j) {
+                    idx[axis] = j ; 
+                    SKL_REAL const w = (j == 0 or j == n) ? 0.5 : 1. ; 
+                    sum += w * Kokkos::cos(M_PI * k * (n-j) / n) * in(idx[0], idx[1], idx[2]) ; 
+                }
+                out(i0,i1,i2) = ( (k == 0 or k == n) ? 1. / n : 2. / n ) * sum ; 
+            }) ; 
+    }
+
+    Kokkos::Array<mapping_t, dim> _maps ; //!< Coordinate mapping of each dimension
+    size_t _N[3] ;     //!< Number of coefficients per dimension, 1 if unused
+    coeff_t _c, _tmp ; //!< Coefficients and transform workspace
+} ; 
+
+}
+
+#endif /* SKL_SPECTRAL_CHEBYSHEV_EVALUATION_HH */
@@ -0,0 +1,492 @@
+/**
+ * @file chebyshev_fixed.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Chebyshev collocation kernels specialised on the number of points.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_SPECTRAL_CHEBYSHEV_FIXED_HH
+#define SKL_SPECTRAL_CHEBYSHEV_FIXED_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/spectral/chebyshev.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Sacado.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace skl {
+
+namespace detail {
+
+/**
+ * @brief Compile time sine, valid for |x| <= pi/2.
+ */
+constexpr SKL_REAL ct_sin(SKL_REAL const x) {
+    SKL_REAL const x2 = x * x ; 
+    SKL_REAL term = x ; 
+    SKL_REAL sum  = x ; 
+    for( int k=1; k<24; ++k) {
+        term *= - x2 / ((2*k) * (2*k+1)) ; 
+        sum  += term ; 
+    }
+    return sum ; 
+}
+
+/**
+ * @brief Compile time cos(pi p/q).
+ * 
+ * The angle is reduced to [0,pi] and evaluated as 
+ * sin(pi (q-2p)/(2q)), which keeps the Taylor series argument 
+ * below pi/2 and makes the result exactly antisymmetric 
+ * around pi/2.
+ */
+constexpr SKL_REAL ct_cos_pi(long p, long q) {
+    p %= 2*q ; 
+    if( p < 0 ) p += 2*q ; 
+    if( p > q ) p = 2*q - p ; 
+    return ct_sin( M_PI * (q - 2*p) / (2. * q) ) ; 
+}
+
+template< typename F, size_t ... I >
+SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+constexpr void static_for_impl(F&& f, std::index_sequence<I...>) {
+    ( f(std::integral_constant<size_t,I>{}), ... ) ; 
+}
+
+/**
+ * @brief Fully unrolled loop over [0,N). The index is passed to 
+ *        the body as a std::integral_constant.
+ */
+template< size_t N, typename F >
+SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+constexpr void static_for(F&& f) {
+    static_for_impl(std::forward<F>(f), std::make_index_sequence<N>{}) ; 
+}
+
+}
+
+/**
+ * @brief Chebyshev-Gauss-Lobatto tables for N points, built at 
+ *        compile time.
+ * \ingroup spectral
+ * 
+ * Same conventions as chebyshev_collocation: ascending points
+ * x_i = -cos(pi i/(N-1)), negative sum diagonal of D, D2 = D D and 
+ * T[j][k] = T_k(x_j).
+ */
+template< size_t N >
+struct chebyshev_table 
+{
+    static_assert( N >= 2, "At least two collocation points are needed." ) ; 
+
+    SKL_REAL x[N]     ; //!< Collocation points
+    SKL_REAL D[N][N]  ; //!< First derivative matrix
+    SKL_REAL D2[N][N] ; //!< Second derivative matrix
+    SKL_REAL T[N][N]  ; //!< Chebyshev polynomials at the points
+
+    constexpr chebyshev_table() : x{}, D{}, D2{}, T{} 
+    {
+        long const n = N-1 ; 
+        for( long i=0; i<=n; ++i) {
+            x[i] = detail::ct_cos_pi(n-i, n) ; 
+        }
+        for( long i=0; i<=n; ++i) {
+            SKL_REAL const ci = (i==0 or i==n) ? 2. : 1. ; 
+            SKL_REAL diag { 0. } ; 
+            for( long j=0; j<=n; ++j) {
+                if( i == j ) continue ; 
+                SKL_REAL const cj = (j==0 or j==n) ? 2. : 1. ; 
+                SKL_REAL const sign = ((i+j)%2 == 0) ? 1. : -1. ; 
+                D[i][j] = ci / cj * sign / (x[i] - x[j]) ; 
+                diag -= D[i][j] ; 
+            }
+            D[i][i] = diag ; 
+        }
+        for( long i=0; i<=n; ++i) for( long j=0; j<=n; ++j) {
+            SKL_REAL sum { 0. } ; 
+            for( long l=0; l<=n; ++l) sum += D[i][l] * D[l][j] ; 
+            D2[i][j] = sum ; 
+        }
+        for( long j=0; j<=n; ++j) for( long k=0; k<=n; ++k) {
+            T[j][k] = detail::ct_cos_pi(k*(n-j), n) ; 
+        }
+    }
+} ; 
+
+/**
+ * @brief Chebyshev collocation kernels for a fixed number of points.
+ * \ingroup spectral
+ * 
+ * All operator entries are compile time constants and every loop 
+ * is unrolled, so that for small N the compiler keeps a whole line
+ * of values in registers and vectorizes the operator application.
+ * The kernels act on lines: a rank 1 View is a single line, a 
+ * rank 2 View of extent (n_lines, N) is a batch of lines. Each 
+ * line is processed by one thread, a single line is therefore 
+ * a launch of one thread; test/bench_chebyshev_fixed.cc compares
+ * both cases with chebyshev_collocation. The value type of the Views 
+ * is propagated, Views of sfad_t<n_der> yield derivatives of 
+ * sfad_t<n_der> with the same number of tangent directions.
+ * 
+ * @tparam N Number of collocation points.
+ */
+template< size_t N >
+class chebyshev_fixed 
+{
+ public:
+    static constexpr chebyshev_table<N> table {} ; 
+
+    static constexpr size_t size() { return N ; }
+
+    /**
+     * @brief Row i of the first logical derivative, du(i) = sum_j D_ij u(j).
+     * 
+     * The row index is a std::integral_constant, so that the operator 
+     * entries are compile time constants. u may be any accessor u(j).
+     */
+    template< typename row_t, typename in_t, typename out_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void row_D(row_t i, in_t const& u, out_t const& du) {
+        using value_t = std::remove_cv_t<std::remove_reference_t<decltype(u(0))>> ; 
+        value_t sum = 0. ; 
+        detail::static_for<N>([&] (auto j) {
+            constexpr SKL_REAL d = table.D[i][j] ; 
+            sum += d * u(j) ; 
+        }) ; 
+        du(i) = sum ; 
+    }
+
+    //! Row i of the first derivative on a mapped grid
+    template< typename row_t, typename in_t, typename out_t, typename metric_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void row_mapped_D(row_t i, in_t const& u, out_t const& du, metric_t const& d1) {
+        using value_t = std::remove_cv_t<std::remove_reference_t<decltype(u(0))>> ; 
+        value_t sum = 0. ; 
+        detail::static_for<N>([&] (auto j) {
+            constexpr SKL_REAL d = table.D[i][j] ; 
+            sum += d * u(j) ; 
+        }) ; 
+        du(i) = d1(i) * sum ; 
+    }
+
+    //! Row i of the second derivative on a mapped grid
+    template< typename row_t, typename in_t, typename out_t, typename metric_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void row_mapped_D2(row_t i, in_t const& u, out_t const& d2u, metric_t const& d1, metric_t const& d2) {
+        using value_t = std::remove_cv_t<std::remove_reference_t<decltype(u(0))>> ; 
+        value_t s1 = 0. ; 
+        value_t s2 = 0. ; 
+        detail::static_for<N>([&] (auto j) {
+            constexpr SKL_REAL a = table.D[i][j]  ; 
+            constexpr SKL_REAL b = table.D2[i][j] ; 
+            s1 += a * u(j) ; 
+            s2 += b * u(j) ; 
+        }) ; 
+        d2u(i) = d1(i) * d1(i) * s2 + d2(i) * s1 ; 
+    }
+
+    //! Chebyshev coefficient k of a line of values
+    template< typename row_t, typename in_t, typename out_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void row_forward(row_t k, in_t const& u, out_t const& c) {
+        using value_t = std::remove_cv_t<std::remove_reference_t<decltype(u(0))>> ; 
+        constexpr SKL_REAL n = N-1 ; 
+        value_t sum = 0. ; 
+        detail::static_for<N>([&] (auto j) {
+            constexpr SKL_REAL t = ( (j==0 or j==N-1) ? 0.5 : 1. ) * table.T[j][k] ; 
+            sum += t * u(j) ; 
+        }) ; 
+        constexpr SKL_REAL ck = (k==0 or k==N-1) ? 1./n : 2./n ; 
+        c(k) = ck * sum ; 
+    }
+
+    //! Value at point j of a line of Chebyshev coefficients
+    template< typename row_t, typename in_t, typename out_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void row_backward(row_t j, in_t const& c, out_t const& u) {
+        using value_t = std::remove_cv_t<std::remove_reference_t<decltype(c(0))>> ; 
+        value_t sum = 0. ; 
+        detail::static_for<N>([&] (auto k) {
+            constexpr SKL_REAL t = table.T[j][k] ; 
+            sum += t * c(k) ; 
+        }) ; 
+        u(j) = sum ; 
+    }
+
+    /**
+     * @brief First logical derivative of a line.
+     * 
+     * The line is loaded once and kept in registers for all rows.
+     * 
+     * @param u   Input line.
+     * @param du  Output line.
+     */
+    template< typename in_t, typename out_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void apply_D(in_t const& u, out_t const& du) {
+        for_each_row(u, [&] (auto i, auto const& ul) { row_D(i, ul, du) ; }) ; 
+    }
+
+    /**
+     * @brief First and second logical derivatives of a line, 
+     *        combined with the metric factors of a mapped grid.
+     */
+    template< typename in_t, typename out_t, typename metric_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void apply_mapped_D(in_t const& u, out_t const& du, metric_t const& d1) {
+        for_each_row(u, [&] (auto i, auto const& ul) { row_mapped_D(i, ul, du, d1) ; }) ; 
+    }
+
+    template< typename in_t, typename out_t, typename metric_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void apply_mapped_D2(in_t const& u, out_t const& d2u, metric_t const& d1, metric_t const& d2) {
+        for_each_row(u, [&] (auto i, auto const& ul) { row_mapped_D2(i, ul, d2u, d1, d2) ; }) ; 
+    }
+
+    template< typename in_t, typename out_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void apply_forward(in_t const& u, out_t const& c) {
+        for_each_row(u, [&] (auto k, auto const& ul) { row_forward(k, ul, c) ; }) ; 
+    }
+
+    template< typename in_t, typename out_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void apply_backward(in_t const& c, out_t const& u) {
+        for_each_row(c, [&] (auto j, auto const& cl) { row_backward(j, cl, u) ; }) ; 
+    }
+
+    /**
+     * @brief First derivative with respect to the logical coordinate.
+     * 
+     * @param u  Values, rank 1 or (n_lines, N).
+     * @param du Derivative (output), same shape as u.
+     */
+    template< typename u_t, typename du_t >
+    static void derivative(u_t const& u, du_t const& du) {
+        for_each_line("chebyshev_fixed::derivative", u
+            , KOKKOS_LAMBDA (auto const& ul, size_t l) {
+                apply_D(ul, line(du, l)) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief First derivative with respect to the physical coordinate.
+     * 
+     * @param grid Mapped grid with N points.
+     * @param u    Values, rank 1 or (n_lines, N).
+     * @param du   Derivative (output), same shape as u.
+     */
+    template< typename grid_t, typename u_t, typename du_t >
+    static void derivative(grid_t const& grid, u_t const& u, du_t const& du) {
+        auto d1 = grid.dxi_dx() ; 
+        for_each_line("chebyshev_fixed::mapped_derivative", u
+            , KOKKOS_LAMBDA (auto const& ul, size_t l) {
+                apply_mapped_D(ul, line(du, l), d1) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Second derivative with respect to the physical coordinate.
+     * 
+     * @param grid Mapped grid with N points.
+     * @param u    Values, rank 1 or (n_lines, N).
+     * @param d2u  Second derivative (output), same shape as u.
+     */
+    template< typename grid_t, typename u_t, typename d2u_t >
+    static void second_derivative(grid_t const& grid, u_t const& u, d2u_t const& d2u) {
+        auto d1 = grid.dxi_dx() ; auto d2 = grid.d2xi_dx2() ; 
+        for_each_line("chebyshev_fixed::mapped_second_derivative", u
+            , KOKKOS_LAMBDA (auto const& ul, size_t l) {
+                apply_mapped_D2(ul, line(d2u, l), d1, d2) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Chebyshev coefficients of each line.
+     */
+    template< typename u_t, typename c_t >
+    static void to_coefficients(u_t const& u, c_t const& c) {
+        for_each_line("chebyshev_fixed::to_coefficients", u
+            , KOKKOS_LAMBDA (auto const& ul, size_t l) {
+                apply_forward(ul, line(c, l)) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Values at the collocation points of each line of 
+     *        Chebyshev coefficients.
+     */
+    template< typename c_t, typename u_t >
+    static void from_coefficients(c_t const& c, u_t const& u) {
+        for_each_line("chebyshev_fixed::from_coefficients", c
+            , KOKKOS_LAMBDA (auto const& cl, size_t l) {
+                apply_backward(cl, line(u, l)) ; 
+            }) ; 
+    }
+
+    /**
+     * @brief Line l of a rank 1 or rank 2 View.
+     */
+    template< typename view_t >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    auto line(view_t const& v, size_t l) {
+        if constexpr ( view_t::rank() == 1 ) {
+            return v ; 
+        } else {
+            return Kokkos::subview(v, l, Kokkos::ALL()) ; 
+        }
+    }
+
+ private:
+
+    /*
+     * Load a line into registers and call f(i, ul) for every row i,
+     * with ul(j) returning the loaded values.
+     */
+    template< typename in_t, typename F >
+    static SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+    void for_each_row(in_t const& u, F const& f) {
+        using value_t = std::remove_cv_t<std::remove_reference_t<decltype(u(0))>> ; 
+        value_t ul[N] ; 
+        detail::static_for<N>([&] (auto j) { ul[j] = u(j) ; }) ; 
+        auto const values = [&] (size_t j) -> value_t const& { return ul[j] ; } ; 
+        detail::static_for<N>([&] (auto i) { f(i, values) ; }) ; 
+    }
+
+    /*
+     * Calls f(line, l) with one thread per line, which keeps the 
+     * line in registers. A rank 1 View is a batch of one line: the
+     * rows are unrolled within the thread and no row index has to 
+     * be matched against the compile time rows at run time.
+     */
+    template< typename view_t, typename F >
+    static void for_each_line(std::string const& name, view_t const& v, F const& f) {
+        static_assert( view_t::rank() == 1 or view_t::rank() == 2, "Expected a line or a batch of lines." ) ; 
+        size_t const n_lines = view_t::rank() == 1 ? 1 : v.extent(0) ; 
+        Kokkos::parallel_for(name, n_lines
+                            , KOKKOS_LAMBDA (int l) 
+            {
+                f(line(v, l), l) ; 
+            }) ; 
+    }
+} ; 
+
+/**
+ * @brief Invoke f with the compile time order matching N.
+ * \ingroup spectral
+ * 
+ * f receives std::integral_constant<size_t,N> for the specialised 
+ * orders 8, 12, 16, 24 and 32, and std::integral_constant<size_t,0> 
+ * otherwise, which callers use to select the dynamic path.
+ */
+template< typename F >
+decltype(auto) dispatch_fixed_order(size_t N, F&& f) {
+    switch(N) {
+        case 8:  return f(std::integral_constant<size_t,8>{})  ; 
+        case 12: return f(std::integral_constant<size_t,12>{}) ; 
+        case 16: return f(std::integral_constant<size_t,16>{}) ; 
+        case 24: return f(std::integral_constant<size_t,24>{}) ; 
+        case 32: return f(std::integral_constant<size_t,32>{}) ; 
+        default: return f(std::integral_constant<size_t,0>{})  ; 
+    }
+}
+
+/**
+ * @brief Chebyshev collocation operators with runtime order.
+ * \ingroup spectral
+ * 
+ * Same interface as chebyshev_collocation, acting on rank 1 Views. 
+ * Calls are forwarded to chebyshev_fixed when N is one of the 
+ * specialised orders and to the matrix based chebyshev_collocation
+ * otherwise.
+ */
+class chebyshev_operator 
+{
+ public:
+    using view_t   = chebyshev_collocation::view_t   ; 
+    using matrix_t = chebyshev_collocation::matrix_t ; 
+
+    chebyshev_operator( size_t N ) : _dyn(N) {} 
+
+    size_t size() const { return _dyn.size() ; }
+    view_t   points() const { return _dyn.points() ; }
+    matrix_t D()      const { return _dyn.D()  ; }
+    matrix_t D2()     const { return _dyn.D2() ; }
+    chebyshev_collocation const& dynamic() const { return _dyn ; }
+
+    template< typename u_t, typename du_t >
+    void derivative(u_t const& u, du_t const& du) const {
+        dispatch_fixed_order(size(), [&] (auto n) {
+            if constexpr ( n == 0 ) _dyn.derivative(u, du) ; 
+            else chebyshev_fixed<n>::derivative(u, du) ; 
+        }) ; 
+    }
+
+    template< typename grid_t, typename u_t, typename du_t >
+    void derivative(grid_t const& grid, u_t const& u, du_t const& du) const {
+        dispatch_fixed_order(size(), [&] (auto n) {
+            if constexpr ( n == 0 ) _dyn.derivative(grid, u, du) ; 
+            else chebyshev_fixed<n>::derivative(grid, u, du) ; 
+        }) ; 
+    }
+
+    template< typename grid_t, typename u_t, typename d2u_t >
+    void second_derivative(grid_t const& grid, u_t const& u, d2u_t const& d2u) const {
+        dispatch_fixed_order(size(), [&] (auto n) {
+            if constexpr ( n == 0 ) _dyn.second_derivative(grid, u, d2u) ; 
+            else chebyshev_fixed<n>::second_derivative(grid, u, d2u) ; 
+        }) ; 
+    }
+
+    template< typename u_t, typename c_t >
+    void to_coefficients(u_t const& u, c_t const& c) const {
+        dispatch_fixed_order(size(), [&] (auto n) {
+            if constexpr ( n == 0 ) _dyn.to_coefficients(u, c) ; 
+            else chebyshev_fixed<n>::to_coefficients(u, c) ; 
+        }) ; 
+    }
+
+    template< typename c_t, typename u_t >
+    void from_coefficients(c_t const& c, u_t const& u) const {
+        dispatch_fixed_order(size(), [&] (auto n) {
+            if constexpr ( n == 0 ) _dyn.from_coefficients(c, u) ; 
+            else chebyshev_fixed<n>::from_coefficients(c, u) ; 
+        }) ; 
+    }
+
+ private:
+    chebyshev_collocation _dyn ; //!< Dynamic fallback, also owns the device tables
+} ; 
+
+}
+
+#endif /* SKL_SPECTRAL_CHEBYSHEV_FIXED_HH */
@@ -0,0 +1,104 @@
+/**
+ * @file chebyshev_transfer.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Spectral transfer between Chebyshev grids of different order.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SPECTRAL_CHEBYSHEV_TRANSFER_HH
+#define SKL_SPECTRAL_CHEBYSHEV_TRANSFER_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+#include <SKL/spectral/chebyshev.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Restriction and prolongation between two Chebyshev-Gauss-Lobatto
+ *        grids through the Chebyshev coefficients.
+ * \ingroup spectral
+ *
+ * to_fine() interpolates a coarse grid function exactly: its 
+ * coefficients are zero-padded and evaluated on the fine points. 
+ * to_coarse() truncates the coefficients of a fine grid function to 
+ * the coarse order. The end points are shared by both grids and are
+ * injected, so that boundary rows of a residual carry over unchanged.
+ * Transfers operate on plain SKL_REAL Views.
+ */
+class chebyshev_transfer
+{
+ public:
+    using view_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ;
+
+    chebyshev_transfer( chebyshev_collocation const& fine, chebyshev_collocation const& coarse )
+     : _fine(fine), _coarse(coarse), _c("chebyshev_transfer_c", fine.size())
+    {}
+
+    /**
+     * @brief Fine to coarse by coefficient truncation.
+     *
+     * @param f Values at the fine collocation points.
+     * @param c Values at the coarse collocation points (output).
+     */
+    template< typename f_t, typename c_t >
+    void to_coarse(f_t const& f, c_t const& c) const {
+        size_t const Nf = _fine.size(), Nc = _coarse.size() ;
+        _fine.to_coefficients(f, _c) ;
+        _coarse.from_coefficients(Kokkos::subview(_c, std::make_pair(size_t{0}, Nc)), c) ;
+        Kokkos::parallel_for("chebyshev_transfer::inject", 1
+                            , KOKKOS_LAMBDA (int)
+            {
+                c(0)    = f(0) ;
+                c(Nc-1) = f(Nf-1) ;
+            }) ;
+    }
+
+    /**
+     * @brief Coarse to fine by zero-padding of the coefficients.
+     *
+     * @param c Values at the coarse collocation points.
+     * @param f Values at the fine collocation points (output).
+     */
+    template< typename c_t, typename f_t >
+    void to_fine(c_t const& c, f_t const& f) const {
+        size_t const Nc = _coarse.size() ;
+        Kokkos::deep_copy(_c, 0.) ;
+        _coarse.to_coefficients(c, Kokkos::subview(_c, std::make_pair(size_t{0}, Nc))) ;
+        _fine.from_coefficients(_c, f) ;
+    }
+
+ private:
+    chebyshev_collocation _fine, _coarse ; //!< Grids of the two levels
+    view_t _c ; //!< Coefficient workspace, fine length
+} ;
+
+}
+
+#endif /* SKL_SPECTRAL_CHEBYSHEV_TRANSFER_HH */
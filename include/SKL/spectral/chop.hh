@@ -0,0 +1,114 @@
+/**
+ * @file chop.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Plateau detection on Chebyshev coefficients.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SPECTRAL_CHOP_HH
+#define SKL_SPECTRAL_CHOP_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace skl {
+
+//! Shortest series chop() can consider resolved
+inline constexpr size_t chop_min_size = 17 ; 
+
+/**
+ * @brief Number of Chebyshev coefficients needed to resolve a function
+ *        to a relative tolerance.
+ * \ingroup spectral
+ * 
+ * Implements the plateau detection of Aurentz & Trefethen, "Chopping 
+ * a Chebyshev series" (ACM TOMS 43, 2017), as used by Chebfun. The 
+ * monotone envelope of |c_k| / max |c| is searched for a plateau, i.e.
+ * a stretch from k to 1.25 k + 5 over which the envelope decreases by
+ * less than a factor that depends on how close it is to tol. The 
+ * cutoff is the point before the plateau where the envelope, tilted by
+ * a linear function in log scale, is smallest.
+ * 
+ * @param c   Chebyshev coefficients, host.
+ * @param tol Relative tolerance.
+ * @return size_t The number of coefficients to keep, or c.size() if no
+ *                plateau was found, i.e. the series is not resolved. 
+ *                Series with fewer than 17 coefficients are never 
+ *                considered resolved.
+ */
+inline size_t chop(std::vector<SKL_REAL> const& c, SKL_REAL tol) 
+{
+    size_t const n = c.size() ; 
+    if( n < chop_min_size ) return n ; 
+    // Monotone envelope, normalized
+    std::vector<SKL_REAL> env(n) ; 
+    env[n-1] = Kokkos::abs(c[n-1]) ; 
+    for( size_t j=n-1; j-->0; ) env[j] = std::max(Kokkos::abs(c[j]), env[j+1]) ; 
+    if( env[0] == 0. ) return 1 ; 
+    SKL_REAL const e0 = env[0] ; 
+    for( auto& e: env ) e /= e0 ; 
+
+    // Indices below are 1-based as in the reference implementation
+    size_t plateau_point { 0 }, j2 { 0 } ; 
+    for( size_t j=2; j<=n; ++j) {
+        j2 = static_cast<size_t>(std::round(1.25 * j + 5.)) ; 
+        if( j2 > n ) return n ; 
+        SKL_REAL const e1 = env[j-1], e2 = env[j2-1] ; 
+        SKL_REAL const r  = 3. * (1. - std::log(e1) / std::log(tol)) ; 
+        if( e1 == 0. or e2 / e1 > r ) {
+            plateau_point = j - 1 ; 
+            break ; 
+        }
+    }
+    if( plateau_point == 0 ) return n ; 
+    if( env[plateau_point-1] == 0. ) return plateau_point ; 
+
+    SKL_REAL const floor = std::pow(tol, 7./6.) ; 
+    size_t const j3 = std::count_if(env.begin(), env.end(), [&] (SKL_REAL e) { return e >= floor ; }) ; 
+    if( j3 < j2 ) {
+        j2 = j3 + 1 ; 
+        env[j2-1] = floor ; 
+    }
+    size_t d { 1 } ; 
+    SKL_REAL cmin { 0. } ; 
+    for( size_t k=1; k<=j2; ++k) {
+        SKL_REAL const cc = std::log10(env[k-1]) - (1./3.) * std::log10(tol) * (k-1) / (j2 > 1 ? j2-1 : 1) ; 
+        if( k == 1 or cc < cmin ) {
+            cmin = cc ; 
+            d = k ; 
+        }
+    }
+    return std::max<size_t>(d-1, 1) ; 
+}
+
+}
+
+#endif /* SKL_SPECTRAL_CHOP_HH */
@@ -0,0 +1,370 @@
+/**
+ * @file fourier.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Fourier collocation for periodic directions.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SPECTRAL_FOURIER_HH
+#define SKL_SPECTRAL_FOURIER_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Complex.hpp>
+#include <Sacado.hpp>
+
+namespace skl {
+
+/**
+ * @brief Fourier collocation on a periodic interval.
+ * \ingroup spectral
+ *
+ * The N collocation points are x_j = origin + L j / N, j = 0..N-1,
+ * with period L. Derivatives are computed in O(N log N) through an
+ * in-house real-to-complex FFT: the real samples are packed into a 
+ * complex sequence of length N/2, transformed with an iterative 
+ * radix-2 FFT and unpacked into the N/2+1 non-negative wave numbers.
+ * N must be a power of two. Every stage is a single kernel over all
+ * butterflies of all transformed lines, so batches of lines ( the 
+ * rows or columns of a rank 2 View ) are transformed together.
+ *
+ * Differentiation is linear, so Views of Fad types are handled 
+ * component by component: the value and each derivative component 
+ * go through the same transform. The kernels therefore accept the
+ * same argument types as chebyshev_collocation and can be used 
+ * inside residual evaluations. For odd derivatives the Nyquist mode
+ * is dropped, as usual. The Laplacian is diagonal in this basis, 
+ * see solve_helmholtz().
+ *
+ * The coefficients returned by to_coefficients() are normalized such
+ * that u(x) = sum_k c_k exp(i kappa_k (x - origin)), with 
+ * kappa_k = 2 pi k / L and c_{-k} = conj(c_k).
+ */
+class fourier_collocation
+{
+ public:
+    using complex_t  = Kokkos::complex<SKL_REAL> ;
+    using view_t     = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ;
+    using spectrum_t = Kokkos::View<complex_t*, Kokkos::DefaultExecutionSpace> ;
+
+    fourier_collocation( size_t N, SKL_REAL period = 2. * M_PI, SKL_REAL origin = 0. )
+     : _N(N), _M(N/2), _L(period), _x0(origin), _x("fourier_x", N)
+     , _rev("fourier_bit_reverse", N/2), _tw("fourier_twiddle", N/2 > 1 ? N/2 / 2 : 1)
+     , _twN("fourier_twiddle_N", N/2 + 1)
+    {
+        if( N < 4 or (N & (N-1)) != 0 ) {
+            Kokkos::abort("fourier_collocation: N must be a power of two larger than 2.") ;
+        }
+        auto h_x   = Kokkos::create_mirror_view(_x) ;
+        auto h_rev = Kokkos::create_mirror_view(_rev) ;
+        auto h_tw  = Kokkos::create_mirror_view(_tw) ;
+        auto h_twN = Kokkos::create_mirror_view(_twN) ;
+        for( size_t j=0; j<_N; ++j) {
+            h_x(j) = _x0 + _L * j / _N ;
+        }
+        size_t bits { 0 } ;
+        while( (size_t{1} << bits) < _M ) ++bits ;
+        for( size_t i=0; i<_M; ++i) {
+            size_t r { 0 } ;
+            for( size_t b=0; b<bits; ++b) {
+                if( i & (size_t{1} << b) ) r |= size_t{1} << (bits-1-b) ;
+            }
+            h_rev(i) = r ;
+        }
+        for( size_t k=0; k<h_tw.extent(0); ++k) {
+            h_tw(k) = complex_t(Kokkos::cos(2. * M_PI * k / _M), -Kokkos::sin(2. * M_PI * k / _M)) ;
+        }
+        for( size_t k=0; k<=_M; ++k) {
+            h_twN(k) = complex_t(Kokkos::cos(2. * M_PI * k / _N), -Kokkos::sin(2. * M_PI * k / _N)) ;
+        }
+        Kokkos::deep_copy(_x,   h_x  ) ;
+        Kokkos::deep_copy(_rev, h_rev) ;
+        Kokkos::deep_copy(_tw,  h_tw ) ;
+        Kokkos::deep_copy(_twN, h_twN) ;
+    }
+
+    size_t size()     const { return _N ; }
+    SKL_REAL period() const { return _L ; }
+    view_t points()   const { return _x ; }
+
+    //! Angular wave number of mode k
+    KOKKOS_INLINE_FUNCTION
+    SKL_REAL wavenumber(size_t k) const { return 2. * M_PI * k / _L ; }
+
+    /**
+     * @brief First derivative of a ( rank 1 ) grid function.
+     */
+    template< typename u_t, typename du_t >
+    void derivative(u_t const& u, du_t const& du) const {
+        differentiate(u, du, 0, 1) ;
+    }
+
+    /**
+     * @brief Second derivative of a ( rank 1 ) grid function.
+     */
+    template< typename u_t, typename d2u_t >
+    void second_derivative(u_t const& u, d2u_t const& d2u) const {
+        differentiate(u, d2u, 0, 2) ;
+    }
+
+    /**
+     * @brief Derivative of order 1 or 2 along dimension dim of a 
+     *        rank 2 grid function, all lines in one batch.
+     */
+    template< typename u_t, typename du_t >
+    void batched_derivative(u_t const& u, du_t const& du, int dim, int order) const {
+        static_assert( u_t::rank() == 2, "batched_derivative needs rank 2 Views." ) ;
+        differentiate(u, du, dim, order) ;
+    }
+
+    /**
+     * @brief Normalized Fourier coefficients c_k, k = 0..N/2, of 
+     *        plain SKL_REAL samples.
+     */
+    template< typename u_t, typename c_t >
+    void to_coefficients(u_t const& u, c_t const& c) const {
+        using namespace Kokkos ;
+        prepare(1) ;
+        auto buf = _buf ; auto X = _X ; SKL_REAL const inv = 1. / _N ;
+        parallel_for("fourier::gather", _N, KOKKOS_LAMBDA (int j) { buf(j,0) = u(j) ; }) ;
+        forward() ;
+        parallel_for("fourier::normalize", _M+1, KOKKOS_LAMBDA (int k) { c(k) = inv * X(k,0) ; }) ;
+    }
+
+    /**
+     * @brief Samples of the real series with coefficients c_k, k = 0..N/2.
+     */
+    template< typename c_t, typename u_t >
+    void from_coefficients(c_t const& c, u_t const& u) const {
+        using namespace Kokkos ;
+        prepare(1) ;
+        auto buf = _buf ; auto X = _X ; SKL_REAL const n = _N ;
+        parallel_for("fourier::scale", _M+1, KOKKOS_LAMBDA (int k) { X(k,0) = n * c(k) ; }) ;
+        inverse() ;
+        parallel_for("fourier::scatter", _N, KOKKOS_LAMBDA (int j) { u(j) = buf(j,0) ; }) ;
+    }
+
+    /**
+     * @brief Solve u'' - sigma u = f for plain SKL_REAL samples.
+     * 
+     * The operator is diagonal in Fourier space. For sigma = 0 the 
+     * mean of f must vanish and the solution with zero mean is returned.
+     */
+    template< typename f_t, typename u_t >
+    void solve_helmholtz(f_t const& f, u_t const& u, SKL_REAL sigma) const {
+        using namespace Kokkos ;
+        prepare(1) ;
+        auto buf = _buf ; auto X = _X ; auto const self = *this ;
+        parallel_for("fourier::gather", _N, KOKKOS_LAMBDA (int j) { buf(j,0) = f(j) ; }) ;
+        forward() ;
+        parallel_for("fourier::helmholtz", _M+1, KOKKOS_LAMBDA (int k)
+            {
+                SKL_REAL const kk = self.wavenumber(k) ;
+                SKL_REAL const symbol = - kk * kk - sigma ;
+                X(k,0) = symbol == 0 ? complex_t(0.) : X(k,0) / symbol ;
+            }) ;
+        inverse() ;
+        parallel_for("fourier::scatter", _N, KOKKOS_LAMBDA (int j) { u(j) = buf(j,0) ; }) ;
+    }
+
+ private:
+    using buffer_t  = Kokkos::View<SKL_REAL**,  Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+    using cbuffer_t = Kokkos::View<complex_t**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    /**
+     * @brief Differentiate u along dim, component by component for Fad types.
+     */
+    template< typename u_t, typename du_t >
+    void differentiate(u_t const& u, du_t const& du, int dim, int order) const {
+        using namespace Kokkos ;
+        using value_t     = typename u_t::non_const_value_type ;
+        using out_value_t = typename du_t::non_const_value_type ;
+        constexpr size_t rank = u_t::rank() ;
+        size_t const n_lines = rank == 1 ? 1 : u.extent(1-dim) ;
+        size_t n_comp { 1 } ;
+        if constexpr ( Sacado::IsFad<value_t>::value ) {
+            n_comp = Kokkos::dimension_scalar(u) ;
+        }
+        prepare(n_lines) ;
+        auto buf = _buf ; auto X = _X ; auto const self = *this ;
+        size_t const N = _N, M = _M ;
+        MDRangePolicy<Rank<2>> points({0,0}, {N, n_lines}) ;
+        for( size_t comp=0; comp<n_comp; ++comp) {
+            parallel_for("fourier::gather", points, KOKKOS_LAMBDA (int j, int l)
+                {
+                    buf(j,l) = component(element<rank>(u, j, l, dim), comp) ;
+                }) ;
+            forward() ;
+            parallel_for("fourier::multiply", MDRangePolicy<Rank<2>>({0,0}, {M+1, n_lines})
+                        , KOKKOS_LAMBDA (int k, int l)
+                {
+                    SKL_REAL const kk = self.wavenumber(k) ;
+                    if( order % 2 == 1 and k == static_cast<int>(M) ) {
+                        X(k,l) = 0. ;
+                    } else if( order == 1 ) {
+                        X(k,l) = complex_t(0., kk) * X(k,l) ;
+                    } else {
+                        X(k,l) = - kk * kk * X(k,l) ;
+                    }
+                }) ;
+            inverse() ;
+            parallel_for("fourier::scatter", points, KOKKOS_LAMBDA (int j, int l)
+                {
+                    if constexpr ( Sacado::IsFad<out_value_t>::value ) {
+                        auto&& out = element<rank>(du, j, l, dim) ;
+                        if( comp == 0 ) out.val() = buf(j,l) ;
+                        else            out.fastAccessDx(comp-1) = buf(j,l) ;
+                    } else {
+                        element<rank>(du, j, l, dim) = buf(j,l) ;
+                    }
+                }) ;
+        }
+    }
+
+    //! Element j of line l along dim
+    template< size_t rank, typename v_t >
+    KOKKOS_INLINE_FUNCTION
+    static decltype(auto) element(v_t const& v, int j, int l, int dim) {
+        if constexpr ( rank == 1 ) {
+            return v(j) ;
+        } else {
+            return dim == 0 ? v(j,l) : v(l,j) ;
+        }
+    }
+
+    //! Value ( comp = 0 ) or derivative component comp-1 of a scalar
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    static SKL_REAL component(T const& x, size_t comp) {
+        if constexpr ( Sacado::IsFad<std::remove_cvref_t<T>>::value ) {
+            return comp == 0 ? x.val() : x.fastAccessDx(comp-1) ;
+        } else {
+            return x ;
+        }
+    }
+
+    //! Size the work buffers for n_lines lines
+    void prepare(size_t n_lines) const {
+        if( _buf.extent(1) != n_lines ) {
+            Kokkos::realloc(_buf, _N, n_lines) ;
+            Kokkos::realloc(_Z, _M, n_lines) ;
+            Kokkos::realloc(_X, _M+1, n_lines) ;
+        }
+    }
+
+    //! _buf -> _X, unnormalized real-to-complex transform of all lines
+    void forward() const {
+        using namespace Kokkos ;
+        auto buf = _buf ; auto Z = _Z ; auto X = _X ; auto twN = _twN ;
+        size_t const M = _M, n_lines = _buf.extent(1) ;
+        parallel_for("fourier::pack", MDRangePolicy<Rank<2>>({0,0}, {M, n_lines})
+                    , KOKKOS_LAMBDA (int j, int l) { Z(j,l) = complex_t(buf(2*j,l), buf(2*j+1,l)) ; }) ;
+        fft(false) ;
+        parallel_for("fourier::unpack", MDRangePolicy<Rank<2>>({0,0}, {M+1, n_lines})
+                    , KOKKOS_LAMBDA (int k, int l)
+            {
+                complex_t const zk = Z(k % M, l) ;
+                complex_t const zc = Kokkos::conj(Z((M-k) % M, l)) ;
+                complex_t const E = 0.5 * (zk + zc) ;
+                complex_t const O = complex_t(0., -0.5) * (zk - zc) ;
+                X(k,l) = E + twN(k) * O ;
+            }) ;
+    }
+
+    //! _X -> _buf, normalized complex-to-real transform of all lines
+    void inverse() const {
+        using namespace Kokkos ;
+        auto buf = _buf ; auto Z = _Z ; auto X = _X ; auto twN = _twN ;
+        size_t const M = _M, n_lines = _buf.extent(1) ;
+        parallel_for("fourier::pack_inverse", MDRangePolicy<Rank<2>>({0,0}, {M, n_lines})
+                    , KOKKOS_LAMBDA (int k, int l)
+            {
+                complex_t const xk = X(k,l) ;
+                complex_t const xc = Kokkos::conj(X(M-k,l)) ;
+                complex_t const E = 0.5 * (xk + xc) ;
+                complex_t const O = 0.5 * (xk - xc) * Kokkos::conj(twN(k)) ;
+                Z(k,l) = E + complex_t(0., 1.) * O ;
+            }) ;
+        fft(true) ;
+        SKL_REAL const inv = 1. / M ;
+        parallel_for("fourier::unpack_inverse", MDRangePolicy<Rank<2>>({0,0}, {M, n_lines})
+                    , KOKKOS_LAMBDA (int j, int l)
+            {
+                buf(2*j,  l) = inv * Z(j,l).real() ;
+                buf(2*j+1,l) = inv * Z(j,l).imag() ;
+            }) ;
+    }
+
+    //! In place radix-2 FFT of length N/2 of all columns of _Z
+    void fft(bool inverse) const {
+        using namespace Kokkos ;
+        auto Z = _Z ; auto rev = _rev ; auto tw = _tw ;
+        size_t const M = _M, n_lines = _Z.extent(1) ;
+        parallel_for("fourier::bit_reverse", MDRangePolicy<Rank<2>>({0,0}, {M, n_lines})
+                    , KOKKOS_LAMBDA (int i, int l)
+            {
+                int const j = rev(i) ;
+                if( i < j ) {
+                    complex_t const t = Z(i,l) ;
+                    Z(i,l) = Z(j,l) ;
+                    Z(j,l) = t ;
+                }
+            }) ;
+        for( size_t len=2; len<=M; len*=2) {
+            size_t const half = len / 2, stride = M / len ;
+            parallel_for("fourier::butterfly", MDRangePolicy<Rank<2>>({0,0}, {M/2, n_lines})
+                        , KOKKOS_LAMBDA (int b, int l)
+                {
+                    size_t const pos = b % half ;
+                    size_t const i = (b / half) * len + pos ;
+                    size_t const j = i + half ;
+                    complex_t const w = inverse ? Kokkos::conj(tw(pos*stride)) : tw(pos*stride) ;
+                    complex_t const t = w * Z(j,l) ;
+                    Z(j,l) = Z(i,l) - t ;
+                    Z(i,l) = Z(i,l) + t ;
+                }) ;
+        }
+    }
+
+    size_t _N      ; //!< Number of collocation points
+    size_t _M      ; //!< Length of the complex transform, N/2
+    SKL_REAL _L    ; //!< Period
+    SKL_REAL _x0   ; //!< Origin
+    view_t _x      ; //!< Collocation points
+    Kokkos::View<int*, Kokkos::DefaultExecutionSpace> _rev ; //!< Bit reversal permutation
+    spectrum_t _tw  ; //!< Twiddle factors of the length N/2 transform
+    spectrum_t _twN ; //!< exp(-2 pi i k / N), k = 0..N/2, for packing and unpacking
+    mutable buffer_t  _buf ; //!< Real samples of the transformed lines
+    mutable cbuffer_t _Z   ; //!< Packed complex sequences
+    mutable cbuffer_t _X   ; //!< Spectra, N/2+1 modes per line
+} ;
+
+}
+
+#endif /* SKL_SPECTRAL_FOURIER_HH */
@@ -0,0 +1,116 @@
+/**
+ * @file tensor_product.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Two dimensional tensor products of one dimensional bases.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SPECTRAL_TENSOR_PRODUCT_HH
+#define SKL_SPECTRAL_TENSOR_PRODUCT_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+
+namespace skl {
+
+/**
+ * @brief Tensor product of two one dimensional collocation bases.
+ * \ingroup spectral
+ *
+ * Grid functions are rank 2 Views u(i,j) with i running over the 
+ * points of the first basis and j over those of the second. Each
+ * basis provides <code>batched_derivative(u, du, dim, order)</code>,
+ * so that e.g. a fourier_collocation in a periodic direction can be
+ * combined with a chebyshev_collocation in a bounded one. Views of 
+ * Fad types are accepted as by the underlying bases.
+ *
+ * @tparam basis0_t Basis of the first dimension.
+ * @tparam basis1_t Basis of the second dimension.
+ */
+template< typename basis0_t, typename basis1_t >
+class tensor_product_2d
+{
+ public:
+    tensor_product_2d( basis0_t const& b0, basis1_t const& b1 )
+     : _b0(b0), _b1(b1)
+    {}
+
+    basis0_t const& basis0() const { return _b0 ; }
+    basis1_t const& basis1() const { return _b1 ; }
+
+    /**
+     * @brief First derivative along dimension dim.
+     */
+    template< typename u_t, typename du_t >
+    void derivative(u_t const& u, du_t const& du, int dim) const {
+        apply(u, du, dim, 1) ;
+    }
+
+    /**
+     * @brief Second derivative along dimension dim.
+     */
+    template< typename u_t, typename d2u_t >
+    void second_derivative(u_t const& u, d2u_t const& d2u, int dim) const {
+        apply(u, d2u, dim, 2) ;
+    }
+
+    /**
+     * @brief Laplacian, lu = d2u/dx0^2 + d2u/dx1^2.
+     * 
+     * @param u   Grid function.
+     * @param lu  Laplacian (output).
+     * @param tmp Workspace of the same type and extents as lu.
+     */
+    template< typename u_t, typename lu_t >
+    void laplacian(u_t const& u, lu_t const& lu, lu_t const& tmp) const {
+        apply(u, lu,  0, 2) ;
+        apply(u, tmp, 1, 2) ;
+        Kokkos::parallel_for("tensor_product::laplacian"
+                            , Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0}, {lu.extent(0), lu.extent(1)})
+                            , KOKKOS_LAMBDA (int i, int j) { lu(i,j) += tmp(i,j) ; }) ;
+    }
+
+ private:
+    template< typename u_t, typename du_t >
+    void apply(u_t const& u, du_t const& du, int dim, int order) const {
+        static_assert( u_t::rank() == 2, "tensor_product_2d needs rank 2 Views." ) ;
+        if( dim == 0 ) {
+            _b0.batched_derivative(u, du, 0, order) ;
+        } else {
+            _b1.batched_derivative(u, du, 1, order) ;
+        }
+    }
+
+    basis0_t _b0 ; //!< Basis of the first dimension
+    basis1_t _b1 ; //!< Basis of the second dimension
+} ;
+
+}
+
+#endif /* SKL_SPECTRAL_TENSOR_PRODUCT_HH */
@@ -0,0 +1,395 @@
+/**
+ * @file ultraspherical.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Ultraspherical (Olver-Townsend) spectral discretization with a bordered banded solver.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_SPECTRAL_ULTRASPHERICAL_HH
+#define SKL_SPECTRAL_ULTRASPHERICAL_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace skl {
+
+namespace detail {
+
+/**
+ * @brief Square banded matrix on host, used to assemble the 
+ *        ultraspherical operators.
+ * 
+ * Entry (i,j) is stored for i - lower <= j <= i + upper, rows are
+ * contiguous. Products and sums widen the band as needed.
+ */
+struct banded_matrix {
+    size_t n  ; //!< Number of rows and columns
+    int lower ; //!< Lower bandwidth
+    int upper ; //!< Upper bandwidth
+    std::vector<SKL_REAL> data ; //!< Band, row by row
+
+    banded_matrix( size_t _n, int _lower, int _upper ) 
+     : n(_n), lower(_lower), upper(_upper), data(_n * (_lower + _upper + 1), 0.)
+    {}
+
+    bool in_band(size_t i, size_t j) const {
+        long const d = long(j) - long(i) ; 
+        return i < n and j < n and d >= -lower and d <= upper ; 
+    }
+    SKL_REAL operator() (size_t i, size_t j) const {
+        return in_band(i,j) ? data[i * (lower + upper + 1) + (long(j) - long(i) + lower)] : 0. ; 
+    }
+    SKL_REAL& at(size_t i, size_t j) {
+        return data[i * (lower + upper + 1) + (long(j) - long(i) + lower)] ; 
+    }
+    //! First column in the band of row i
+    size_t first(size_t i) const { return i > size_t(lower) ? i - lower : 0 ; }
+    //! One past the last column in the band of row i
+    size_t last(size_t i)  const { return std::min(n, i + upper + 1) ; }
+} ; 
+
+inline banded_matrix operator* (banded_matrix const& A, banded_matrix const& B) {
+    banded_matrix C(A.n, A.lower + B.lower, A.upper + B.upper) ; 
+    for( size_t i=0; i<A.n; ++i) for( size_t l=A.first(i); l<A.last(i); ++l) {
+        SKL_REAL const a = A(i,l) ; 
+        if( a == 0. ) continue ; 
+        for( size_t j=B.first(l); j<B.last(l); ++j) C.at(i,j) += a * B(l,j) ; 
+    }
+    return C ; 
+}
+
+//! alpha A + beta B
+inline banded_matrix add(SKL_REAL alpha, banded_matrix const& A, SKL_REAL beta, banded_matrix const& B) {
+    banded_matrix C(A.n, std::max(A.lower, B.lower), std::max(A.upper, B.upper)) ; 
+    for( size_t i=0; i<A.n; ++i) {
+        for( size_t j=A.first(i); j<A.last(i); ++j) C.at(i,j) += alpha * A(i,j) ; 
+        for( size_t j=B.first(i); j<B.last(i); ++j) C.at(i,j) += beta  * B(i,j) ; 
+    }
+    return C ; 
+}
+
+}
+
+/**
+ * @brief Ultraspherical spectral method for linear second order 
+ *        boundary value problems.
+ * \ingroup spectral
+ * 
+ * Solves a(x) u'' + b(x) u' + c(x) u = f(x) on [xmin, xmax] with two
+ * boundary conditions of the form alpha u + beta u' = value, following
+ * Olver & Townsend (SIAM Review 55, 2013). The unknowns are the N 
+ * Chebyshev coefficients of u. Differentiation maps T_k to the 
+ * ultraspherical bases C^(1), C^(2) and is a shifted diagonal, 
+ * conversion C^(l) -> C^(l+1) is upper bidiagonal and multiplication 
+ * by a variable coefficient is banded, with bandwidth the number of
+ * Chebyshev coefficients of that coefficient. The equation is imposed
+ * in C^(2):
+ * 
+ *    ( M_2[a] D_2 + S_1 M_1[b] D_1 + S_1 S_0 M_0[c] ) u = S_1 S_0 f ,
+ * 
+ * and the last two rows are replaced by the boundary conditions ( tau
+ * method ). The resulting matrix is banded up to two dense rows. 
+ * Instead of the almost-banded QR of the paper, the system is solved 
+ * as a bordered banded system: the first two coefficients are moved 
+ * to the border, the remaining square block is factored with banded 
+ * LU (LAPACK GBTRF) and the border is eliminated through a 2x2 Schur 
+ * complement. setup() costs O(N m^2) and solve() O(N m), with m the 
+ * bandwidth, so N in the tens of thousands is cheap, and the matrices
+ * stay well conditioned. 
+ * 
+ * Assembly and factorization run on host, like direct_solver. 
+ * Coefficient functions are passed as host callables of the physical
+ * coordinate and resolved with coefficients().
+ */
+class ultraspherical 
+{
+ public:
+    using view_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ; 
+    using banded_matrix = detail::banded_matrix ; 
+
+    //! alpha u(x) + beta u'(x) = value at x = xmin or x = xmax
+    struct boundary_condition {
+        SKL_REAL x     ; //!< Boundary, xmin or xmax
+        SKL_REAL alpha ; //!< Coefficient of u
+        SKL_REAL beta  ; //!< Coefficient of du/dx
+        SKL_REAL value ; //!< Boundary value
+    } ; 
+
+    ultraspherical( size_t N, SKL_REAL xmin = -1., SKL_REAL xmax = 1. ) 
+     : _N(N), _xmin(xmin), _xmax(xmax), _scale(2. / (xmax - xmin))
+     , _convert(conversion(N, 1) * conversion(N, 0)), _kl(0), _ku(0), _factored(false)
+    {
+        if( N < 4 ) {
+            Kokkos::abort("ultraspherical: at least 4 coefficients are needed.") ; 
+        }
+    }
+
+    size_t size() const { return _N ; }
+    int lower_bandwidth() const { return _kl ; }
+    int upper_bandwidth() const { return _ku ; }
+    bool factored() const { return _factored ; }
+
+    /**
+     * @brief Conversion C^(lambda) -> C^(lambda+1) on n coefficients,
+     *        lambda = 0 being the Chebyshev basis T.
+     */
+    static banded_matrix conversion(size_t n, int lambda) {
+        banded_matrix S(n, 0, 2) ; 
+        for( size_t k=0; k<n; ++k) {
+            SKL_REAL const s = lambda == 0 ? ( k == 0 ? 1. : 0.5 ) : SKL_REAL(lambda) / (k + lambda) ; 
+            S.at(k,k) = s ; 
+            if( k >= 2 ) S.at(k-2,k) = -s ; 
+        }
+        return S ; 
+    }
+
+    /**
+     * @brief Differentiation of order 1 or 2 from T to C^(order) on
+     *        n coefficients, d T_k = k U_{k-1}, d^2 T_k = 2 k C^(2)_{k-2}.
+     */
+    static banded_matrix differentiation(size_t n, int order) {
+        banded_matrix D(n, 0, order) ; 
+        for( size_t k=order; k<n; ++k) {
+            D.at(k-order,k) = order == 1 ? SKL_REAL(k) : 2. * k ; 
+        }
+        return D ; 
+    }
+
+    /**
+     * @brief Multiplication by sum_j a_j T_j(x) in C^(lambda) on n 
+     *        coefficients.
+     * 
+     * Built from the three term recurrence 
+     * M[T_{j+1}] = 2 M[x] M[T_j] - M[T_{j-1}], where M[x] is the
+     * tridiagonal Jacobi operator of C^(lambda). The last rows are 
+     * affected by truncation, callers pad n by the length of a.
+     */
+    static banded_matrix multiplication(size_t n, int lambda, std::vector<SKL_REAL> const& a) {
+        banded_matrix M(n, 0, 0) ; 
+        if( a.empty() ) return M ; 
+        banded_matrix X(n, 1, 1) ; 
+        for( size_t k=0; k<n; ++k) {
+            if( lambda == 0 ) {
+                if( k+1 < n ) X.at(k+1,k) = k == 0 ? 1. : 0.5 ; 
+                if( k > 0 )   X.at(k-1,k) = 0.5 ; 
+            } else {
+                SKL_REAL const den = 2. * (k + lambda) ; 
+                if( k+1 < n ) X.at(k+1,k) = (k + 1.) / den ; 
+                if( k > 0 )   X.at(k-1,k) = (k + 2. * lambda - 1.) / den ; 
+            }
+        }
+        banded_matrix Tm(n, 0, 0), Tj(n, 0, 0) ; 
+        for( size_t k=0; k<n; ++k) Tj.at(k,k) = 1. ; 
+        M = add(0., M, a[0], Tj) ; 
+        for( size_t j=1; j<a.size(); ++j) {
+            banded_matrix Tp = j == 1 ? X : add(2., X * Tj, -1., Tm) ; 
+            M  = add(1., M, a[j], Tp) ; 
+            Tm = std::move(Tj) ; 
+            Tj = std::move(Tp) ; 
+        }
+        return M ; 
+    }
+
+    /**
+     * @brief Chebyshev coefficients of a host callable of the physical
+     *        coordinate, interpolated at m Chebyshev-Gauss-Lobatto points.
+     * 
+     * Trailing coefficients below tol times the largest one are dropped,
+     * the default is above the rounding noise of the O(m) sums.
+     * The cost is O(m^2), this is meant for the variable coefficients 
+     * of the equation and for moderate right hand sides.
+     */
+    template< typename f_t >
+    std::vector<SKL_REAL> coefficients(f_t const& f, size_t m, SKL_REAL tol = 64 * std::numeric_limits<SKL_REAL>::epsilon()) const {
+        int const n = m-1 ; 
+        std::vector<SKL_REAL> fj(m), c(m, 0.) ; 
+        for( int j=0; j<=n; ++j) {
+            SKL_REAL const xi = -Kokkos::cos(M_PI * j / n) ; 
+            fj[j] = f(_xmin + 0.5 * (xi + 1.) * (_xmax - _xmin)) ; 
+        }
+        SKL_REAL cmax { 0. } ; 
+        for( int k=0; k<=n; ++k) {
+            SKL_REAL sum = 0.5 * ( fj[0] * Kokkos::cos(M_PI * k) + fj[n] ) ; 
+            for( int j=1; j<n; ++j) sum += fj[j] * Kokkos::cos(M_PI * k * (n-j) / n) ; 
+            c[k] = ( (k==0 or k==n) ? 1. : 2. ) / n * sum ; 
+            cmax = std::max(cmax, Kokkos::abs(c[k])) ; 
+        }
+        while( c.size() > 1 and Kokkos::abs(c.back()) <= tol * cmax ) c.pop_back() ; 
+        return c ; 
+    }
+
+    /**
+     * @brief Assemble and factor the operator.
+     * 
+     * @param a, b, c Host callables of the physical coordinate, the 
+     *                coefficients of u'', u' and u.
+     * @param bcs     Boundary conditions at xmin and xmax.
+     * @param m       Number of points used to resolve the coefficients.
+     */
+    template< typename a_t, typename b_t, typename c_t >
+    void setup( a_t const& a, b_t const& b, c_t const& c
+              , std::array<boundary_condition, 2> const& bcs, size_t m = 65 ) 
+    {
+        // Chain rule of the affine map to [-1,1]
+        auto ca = coefficients(a, m) ; for( auto& v: ca ) v *= _scale * _scale ; 
+        auto cb = coefficients(b, m) ; for( auto& v: cb ) v *= _scale ; 
+        auto cc = coefficients(c, m) ; 
+        size_t const P = _N + std::max({ca.size(), cb.size(), cc.size()}) + 4 ; 
+
+        auto const S0 = conversion(P, 0), S1 = conversion(P, 1) ; 
+        auto const L = add( 1., multiplication(P, 2, ca) * differentiation(P, 2)
+                          , 1., add( 1., S1 * (multiplication(P, 1, cb) * differentiation(P, 1))
+                                   , 1., S1 * (S0 * multiplication(P, 0, cc)) ) ) ; 
+
+        // Square block on coefficients 2..N-1 of the first N-2 rows
+        size_t const n = _N - 2 ; 
+        _kl = L.lower + 2 ; 
+        _ku = std::max(L.upper - 2, 0) ; 
+        int const ldab = 2 * _kl + _ku + 1 ; 
+        _ab.assign(ldab * n, 0.) ; 
+        _X.assign(2 * n, 0.) ; 
+        for( size_t i=0; i<n; ++i) for( size_t j=L.first(i); j<std::min(L.last(i), _N); ++j) {
+            if( j < 2 ) {
+                _X[i + j * n] = L(i,j) ; 
+            } else {
+                _ab[(_kl + _ku + i - (j-2)) + (j-2) * ldab] = L(i,j) ; 
+            }
+        }
+
+        // Boundary rows
+        _B.assign(2 * _N, 0.) ; 
+        for( int r=0; r<2; ++r) {
+            auto const& bc = bcs[r] ; 
+            SKL_REAL side { 0. } ; 
+            if( Kokkos::abs(bc.x - _xmin) <= 1e-12 * (_xmax - _xmin) ) {
+                side = -1. ; 
+            } else if( Kokkos::abs(bc.x - _xmax) <= 1e-12 * (_xmax - _xmin) ) {
+                side = 1. ; 
+            } else {
+                Kokkos::abort("ultraspherical: boundary conditions must be imposed at xmin or xmax.") ; 
+            }
+            SKL_REAL sk = 1. ; 
+            for( size_t k=0; k<_N; ++k) {
+                _B[r * _N + k] = bc.alpha * sk + bc.beta * _scale * sk * side * k * k ; 
+                sk *= side ; 
+            }
+            _bvals[r] = bc.value ; 
+        }
+
+        Teuchos::LAPACK<int, SKL_REAL> lapack ; 
+        int info { 0 } ; 
+        _ipiv.assign(n, 0) ; 
+        lapack.GBTRF(n, n, _kl, _ku, _ab.data(), ldab, _ipiv.data(), &info) ; 
+        if( info != 0 ) {
+            Kokkos::abort("ultraspherical: singular banded block.") ; 
+        }
+        // X = A^-1 E, Schur complement of the border
+        lapack.GBTRS('N', n, _kl, _ku, 2, _ab.data(), ldab, _ipiv.data(), _X.data(), n, &info) ; 
+        for( int r=0; r<2; ++r) for( int s=0; s<2; ++s) {
+            SKL_REAL sum = _B[r * _N + s] ; 
+            for( size_t i=0; i<n; ++i) sum -= _B[r * _N + i + 2] * _X[i + s * n] ; 
+            _schur[r + 2 * s] = sum ; 
+        }
+        lapack.GETRF(2, 2, _schur.data(), 2, _schur_ipiv.data(), &info) ; 
+        if( info != 0 ) {
+            Kokkos::abort("ultraspherical: boundary conditions are not independent.") ; 
+        }
+        _factored = true ; 
+    }
+
+    /**
+     * @brief Solve for the Chebyshev coefficients of u on host.
+     * 
+     * @param f Chebyshev coefficients of the right hand side, at most N.
+     * @return  The N Chebyshev coefficients of u.
+     */
+    std::vector<SKL_REAL> solve(std::vector<SKL_REAL> const& f) const {
+        if( not _factored ) {
+            Kokkos::abort("ultraspherical: setup() must be called before solve().") ; 
+        }
+        size_t const n = _N - 2 ; 
+        int const ldab = 2 * _kl + _ku + 1 ; 
+        std::vector<SKL_REAL> y(n, 0.), u(_N) ; 
+        for( size_t i=0; i<n; ++i) for( size_t j=_convert.first(i); j<std::min(_convert.last(i), f.size()); ++j) {
+            y[i] += _convert(i,j) * f[j] ; 
+        }
+        Teuchos::LAPACK<int, SKL_REAL> lapack ; 
+        int info { 0 } ; 
+        lapack.GBTRS('N', n, _kl, _ku, 1, _ab.data(), ldab, _ipiv.data(), y.data(), n, &info) ; 
+        std::array<SKL_REAL, 2> t { _bvals[0], _bvals[1] } ; 
+        for( int r=0; r<2; ++r) for( size_t i=0; i<n; ++i) t[r] -= _B[r * _N + i + 2] * y[i] ; 
+        lapack.GETRS('N', 2, 1, _schur.data(), 2, _schur_ipiv.data(), t.data(), 2, &info) ; 
+        u[0] = t[0] ; u[1] = t[1] ; 
+        for( size_t i=0; i<n; ++i) u[i+2] = y[i] - _X[i] * t[0] - _X[i + n] * t[1] ; 
+        return u ; 
+    }
+
+    /**
+     * @brief Solve for the Chebyshev coefficients of u, with Views.
+     * 
+     * @param f Chebyshev coefficients of the right hand side.
+     * @param u Chebyshev coefficients of the solution (output), N entries.
+     */
+    template< typename f_t, typename u_t >
+    void solve(f_t const& f, u_t const& u) const {
+        auto h_f = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f) ; 
+        std::vector<SKL_REAL> fv(h_f.extent(0)) ; 
+        for( size_t k=0; k<fv.size(); ++k) fv[k] = h_f(k) ; 
+        auto const uv = solve(fv) ; 
+        auto h_u = Kokkos::create_mirror_view(u) ; 
+        for( size_t k=0; k<_N; ++k) h_u(k) = uv[k] ; 
+        Kokkos::deep_copy(u, h_u) ; 
+    }
+
+ private:
+    size_t _N        ; //!< Number of Chebyshev coefficients
+    SKL_REAL _xmin   ; //!< Left end of the interval
+    SKL_REAL _xmax   ; //!< Right end of the interval
+    SKL_REAL _scale  ; //!< dxi/dx of the affine map
+    banded_matrix _convert ; //!< S_1 S_0, right hand side to C^(2)
+    int _kl, _ku     ; //!< Bandwidths of the square block
+    std::vector<SKL_REAL> _ab ; //!< Banded LU of the square block ( LAPACK band storage )
+    std::vector<int> _ipiv    ; //!< Pivots of the banded LU
+    std::vector<SKL_REAL> _X  ; //!< A^-1 E, column major
+    std::vector<SKL_REAL> _B  ; //!< Boundary rows, row major
+    std::array<SKL_REAL, 4> _schur {}      ; //!< LU of the 2x2 Schur complement
+    std::array<int, 2> _schur_ipiv {}      ; //!< Pivots of the Schur complement
+    std::array<SKL_REAL, 2> _bvals {}      ; //!< Boundary values
+    bool _factored   ; //!< Whether setup() was called
+} ; 
+
+}
+
+#endif /* SKL_SPECTRAL_ULTRASPHERICAL_HH */
@@ -34,7 +34,7 @@
 
 #include <SKL/utils/inline.h>
 #include <SKL/utils/types.hh>
-#include <SKL/utils/blas/grace_blas_1_impl.hh>
+#include <SKL/utils/blas/SKL_blas_1_impl.hh>
 
 #include <Kokkos_Core.hpp>
 #include <KokkosBlas1_nrm2.hpp> 
@@ -48,6 +48,76 @@
 
 namespace utils { namespace linalg {
 
+/**
+ * @brief Compute 2-norm of a vector on an execution space instance.
+ * 
+ * \ingroup blas
+ * 
+ * The kernel is enqueued on <code>space</code> and only that 
+ * instance is fenced to return the result. On host execution spaces
+ * plain, Fad and dual Views are reduced with explicit SIMD kernels 
+ * ( see impl::simd_dot_functor ), on device Fad and dual Views use 
+ * the custom implementation and plain Views KokkosBlas.
+ * 
+ * @tparam exec_t Execution space type.
+ * @tparam view_t Type of View representing the vector. 
+ * @param space   Execution space instance.
+ * @param view    View representing the vector.
+ * @return SKL_REAL The 2-norm of the input vector.
+ */
+template< typename exec_t
+        , typename view_t >
+requires Kokkos::is_execution_space<exec_t>::value
+SKL_REAL SKL_ALWAYS_INLINE 
+nrm2(exec_t const& space, view_t const & view )
+{
+    static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
+    using scalar_t = typename view_t::non_const_value_type ; 
+    if constexpr( impl::simd_reducible_v<exec_t, view_t> ) {
+        return impl::_nrm2_simd(space, view) ; 
+    } else if constexpr( impl::is_ad_v<scalar_t> ) {
+        return impl::_nrm2(space, view) ; 
+    } else {
+        return KokkosBlas::nrm2(space, view) ; 
+    }
+}
+
+/**
+ * @brief Compute 2-norm of a vector into a device resident scalar.
+ * 
+ * \ingroup blas
+ * 
+ * The result is written to a rank 0 View, so that nothing is copied
+ * back to host and <code>space</code> is not fenced. The value can 
+ * be consumed by subsequent kernels on the same instance, e.g. by 
+ * rscal() or axpy() with a View-valued alpha.
+ * 
+ * @tparam exec_t   Execution space type.
+ * @tparam view_t   Type of View representing the vector. 
+ * @tparam result_t Type of rank 0 View receiving the norm.
+ * @param space   Execution space instance.
+ * @param view    View representing the vector.
+ * @param result  Rank 0 View receiving the 2-norm.
+ */
+template< typename exec_t
+        , typename view_t 
+        , typename result_t >
+requires ( Kokkos::is_execution_space<exec_t>::value and Kokkos::is_view<result_t>::value )
+void SKL_ALWAYS_INLINE 
+nrm2(exec_t const& space, view_t const & view, result_t const& result )
+{
+    static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
+    static_assert( result_t::rank() == 0, "The result of nrm2 must be a rank 0 View.");
+    using scalar_t = typename view_t::non_const_value_type ; 
+    if constexpr( impl::simd_reducible_v<exec_t, view_t> ) {
+        impl::_nrm2_simd(space, view, result) ; 
+    } else if constexpr( impl::is_ad_v<scalar_t> ) {
+        impl::_nrm2(space, view, result) ; 
+    } else {
+        KokkosBlas::nrm2(space, result, view) ; 
+    }
+}
+
 /**
  * @brief Compute 2-norm of a vector.
  * 
@@ -59,19 +129,13 @@ namespace utils { namespace linalg {
  * 
  * @tparam view_t Type of View representing the vector. 
  * @param view    View representing the vector.
- * @return GRACE_REAL The 2-norm of the input vector.
+ * @return SKL_REAL The 2-norm of the input vector.
  */
 template< typename view_t >
-GRACE_REAL GRACE_ALWAYS_INLINE 
+SKL_REAL SKL_ALWAYS_INLINE 
 nrm2(view_t const & view )
 {
-    static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
-    using scalar_t = typename view_t::non_const_value_type ; 
-    if constexpr( Sacado::IsFad<scalar_t>::value ) {
-        return impl::_nrm2(view) ; 
-    } else {
-        return KokkosBlas::nrm2(view) ; 
-    }
+    return nrm2(Kokkos::DefaultExecutionSpace(), view) ; 
 }
 
 /**
@@ -87,15 +151,16 @@ nrm2(view_t const & view )
  * @tparam view_t Type of View representing the vector. 
  * @param team    Thread team.
  * @param view    View representing the vector.
- * @return GRACE_REAL The 2-norm of the input vector.
+ * @return SKL_REAL The 2-norm of the input vector.
  */
 template< typename team_t
         , typename view_t  >
-GRACE_REAL GRACE_ALWAYS_INLINE GRACE_HOST_DEVICE
+requires ( not Kokkos::is_execution_space<team_t>::value )
+SKL_REAL SKL_ALWAYS_INLINE SKL_HOST_DEVICE
 nrm2(team_t team, view_t const & view ) {
     static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
     using scalar_t = typename view_t::non_const_value_type ; 
-    if constexpr( Sacado::IsFad<scalar_t>::value ) {
+    if constexpr( impl::is_ad_v<scalar_t> ) {
         return impl::_nrm2(team,view) ; 
     } else {
         return KokkosBlas::Experimental::nrm2(team, view) ; 
@@ -103,34 +168,97 @@ nrm2(team_t team, view_t const & view ) {
 }
 
 /**
- * @brief Compute dot product of two vectors.
+ * @brief Compute dot product of two vectors on an execution space instance.
  * \ingroup blas
  * 
- * This function will call the KokkosBlas implementation 
- * if the underlying type allows to do so, otherwise it
- * will call a custom implementation.
+ * The implementation is selected as in nrm2(space, view).
+ * 
+ * @tparam exec_t   Execution space type.
  * @tparam view_a_t Type of View representing vector A.
  * @tparam view_b_t Type of View representing vector B. 
+ * @param space Execution space instance.
  * @param v Vector A.
  * @param w Vector B.
- * @return GRACE_REAL The dot product of the two vectors.
+ * @return SKL_REAL The dot product of the two vectors.
  */
-template< typename view_a_t 
+template< typename exec_t
+        , typename view_a_t 
         , typename view_b_t >
-GRACE_REAL GRACE_ALWAYS_INLINE 
-dot(view_a_t const & v,  view_b_t const & w) {
+requires Kokkos::is_execution_space<exec_t>::value
+SKL_REAL SKL_ALWAYS_INLINE 
+dot(exec_t const& space, view_a_t const & v,  view_b_t const & w) {
     static_assert( Kokkos::is_view<view_a_t>::value, "view_a_t must be a Kokkos::View.");
     static_assert( Kokkos::is_view<view_b_t>::value, "view_b_t must be a Kokkos::View.");
     using scalar_a_t = typename view_a_t::non_const_value_type ; 
     using scalar_b_t = typename view_b_t::non_const_value_type ; 
 
-    if constexpr ( Sacado::IsFad<scalar_a_t>::value or Sacado::IsFad<scalar_b_t>::value ) {
-        return impl::_dot(v,w) ; 
+    if constexpr ( impl::simd_reducible_v<exec_t, view_a_t> and impl::simd_reducible_v<exec_t, view_b_t> ) {
+        return impl::_dot_simd(space,v,w) ; 
+    } else if constexpr ( impl::is_ad_v<scalar_a_t> or impl::is_ad_v<scalar_b_t> ) {
+        return impl::_dot(space,v,w) ; 
     } else {
-        return KokkosBlas::dot(v,w) ; 
+        return KokkosBlas::dot(space,v,w) ; 
     }
 }
 
+/**
+ * @brief Compute dot product of two vectors into a device resident scalar.
+ * \ingroup blas
+ * 
+ * As nrm2(space, view, result), the reduction result stays on 
+ * device and <code>space</code> is not fenced.
+ * 
+ * @tparam exec_t   Execution space type.
+ * @tparam view_a_t Type of View representing vector A.
+ * @tparam view_b_t Type of View representing vector B. 
+ * @tparam result_t Type of rank 0 View receiving the product.
+ * @param space  Execution space instance.
+ * @param v      Vector A.
+ * @param w      Vector B.
+ * @param result Rank 0 View receiving the dot product.
+ */
+template< typename exec_t
+        , typename view_a_t 
+        , typename view_b_t 
+        , typename result_t >
+requires ( Kokkos::is_execution_space<exec_t>::value and Kokkos::is_view<result_t>::value )
+void SKL_ALWAYS_INLINE 
+dot(exec_t const& space, view_a_t const & v,  view_b_t const & w, result_t const& result) {
+    static_assert( Kokkos::is_view<view_a_t>::value, "view_a_t must be a Kokkos::View.");
+    static_assert( Kokkos::is_view<view_b_t>::value, "view_b_t must be a Kokkos::View.");
+    static_assert( result_t::rank() == 0, "The result of dot must be a rank 0 View.");
+    using scalar_a_t = typename view_a_t::non_const_value_type ; 
+    using scalar_b_t = typename view_b_t::non_const_value_type ; 
+
+    if constexpr ( impl::simd_reducible_v<exec_t, view_a_t> and impl::simd_reducible_v<exec_t, view_b_t> ) {
+        impl::_dot_simd(space,v,w,result) ; 
+    } else if constexpr ( impl::is_ad_v<scalar_a_t> or impl::is_ad_v<scalar_b_t> ) {
+        impl::_dot(space,v,w,result) ; 
+    } else {
+        KokkosBlas::dot(space,result,v,w) ; 
+    }
+}
+
+/**
+ * @brief Compute dot product of two vectors.
+ * \ingroup blas
+ * 
+ * This function will call the KokkosBlas implementation 
+ * if the underlying type allows to do so, otherwise it
+ * will call a custom implementation.
+ * @tparam view_a_t Type of View representing vector A.
+ * @tparam view_b_t Type of View representing vector B. 
+ * @param v Vector A.
+ * @param w Vector B.
+ * @return SKL_REAL The dot product of the two vectors.
+ */
+template< typename view_a_t 
+        , typename view_b_t >
+SKL_REAL SKL_ALWAYS_INLINE 
+dot(view_a_t const & v,  view_b_t const & w) {
+    return dot(Kokkos::DefaultExecutionSpace(), v, w) ; 
+}
+
 /**
  * @brief Compute dot product of two vectors in a ThreadTeam parallel environment.
  * \ingroup blas
@@ -145,30 +273,82 @@ dot(view_a_t const & v,  view_b_t const & w) {
  * @param team Thread team member.
  * @param v Vector A.
  * @param w Vector B.
- * @return GRACE_REAL The dot product of the two vectors.
+ * @return SKL_REAL The dot product of the two vectors.
  */
 template< typename team_t 
         , typename view_a_t 
         , typename view_b_t >
-GRACE_REAL GRACE_ALWAYS_INLINE GRACE_HOST_DEVICE 
+requires ( not Kokkos::is_execution_space<team_t>::value )
+SKL_REAL SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
 dot(team_t team, view_a_t const & v,  view_b_t const & w) {
     static_assert( Kokkos::is_view<view_a_t>::value, "view_a_t must be a Kokkos::View.");
     static_assert( Kokkos::is_view<view_b_t>::value, "view_b_t must be a Kokkos::View.");
     using scalar_a_t = typename view_a_t::non_const_value_type ; 
     using scalar_b_t = typename view_b_t::non_const_value_type ; 
 
-    if constexpr ( Sacado::IsFad<scalar_a_t>::value or Sacado::IsFad<scalar_b_t>::value ) {
+    if constexpr ( impl::is_ad_v<scalar_a_t> or impl::is_ad_v<scalar_b_t> ) {
         return impl::_dot(team,v,w) ; 
     } else {
-        return KokkosBlas::dot(team,v,w) ; 
+        return KokkosBlas::Experimental::dot(team,v,w) ; 
     }
 }
 
-template< typename out_view_t 
+/**
+ * @brief Compute several dot products with a single reduction.
+ * \ingroup blas
+ * 
+ * The views are given pairwise, <code>dots(space, {a, b, c, d})</code>
+ * returns { (a,b), (c,d) }. All products are accumulated in one 
+ * kernel, so that Krylov methods which need several inner products 
+ * per iteration pay for one global reduction and one synchronization 
+ * instead of one each.
+ * 
+ * @tparam exec_t  Execution space type.
+ * @tparam view_t  Type of the (rank 1) Views.
+ * @tparam n_views Number of Views, must be even.
+ * @param space Execution space instance.
+ * @param views Views, pairwise.
+ * @return std::array<SKL_REAL, n_views/2> The dot products.
+ */
+template< typename exec_t
+        , typename view_t
+        , size_t n_views >
+requires Kokkos::is_execution_space<exec_t>::value
+std::array<SKL_REAL, n_views/2> SKL_ALWAYS_INLINE 
+dots(exec_t const& space, view_t const (&views)[n_views]) {
+    static_assert( Kokkos::is_view<view_t>::value, "view_t must be a Kokkos::View.");
+    static_assert( view_t::rank() == 1, "dots needs rank 1 Views.");
+    static_assert( n_views > 0 and n_views % 2 == 0, "dots needs pairs of Views.");
+    return impl::_dots(space, views) ; 
+}
+
+/**
+ * @brief Compute several dot products with a single reduction 
+ *        on the default execution space instance.
+ * \ingroup blas
+ */
+template< typename view_t
+        , size_t n_views >
+std::array<SKL_REAL, n_views/2> SKL_ALWAYS_INLINE 
+dots(view_t const (&views)[n_views]) {
+    return dots(Kokkos::DefaultExecutionSpace(), views) ; 
+}
+
+/**
+ * @brief y = alpha x, enqueued on an execution space instance.
+ * \ingroup blas
+ * 
+ * For rank 1 Views alpha is a scalar or a rank 0 View, which is read 
+ * inside the kernel ( see nrm2(space, view, result) ). For rank 2 
+ * Views alpha is a rank 1 View with one entry per column.
+ */
+template< typename exec_t
+        , typename out_view_t 
         , typename scalar_t 
         , typename in_view_t >
-void GRACE_ALWAYS_INLINE
-scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x) 
+requires Kokkos::is_execution_space<exec_t>::value
+void SKL_ALWAYS_INLINE
+scal(exec_t const& space, out_view_t const& y, scalar_t const& alpha, in_view_t const& x) 
 {
     /* Let's do some checks on the inputs! */
     static_assert( Kokkos::is_view<out_view_t>::value, "out_view_t must be a Kokkos::View.");
@@ -185,34 +365,93 @@ scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
     if constexpr ( rank_in == 1 ) {
         // If the views are rank 1 then alpha is a true scalar 
         using non_const_scalar_t = typename std::remove_cvref_t<scalar_t > ; 
-        if constexpr (   Sacado::IsFad<scalar_out_t>::value
-                    or   Sacado::IsFad<scalar_in_t>::value
-                    or   Sacado::IsFad<non_const_scalar_t>::value ) { 
-            impl::_scal(y,alpha,x) ; 
+        if constexpr (   impl::is_ad_v<scalar_out_t>
+                    or   impl::is_ad_v<scalar_in_t>
+                    or   impl::is_ad_v<non_const_scalar_t> 
+                    or   Kokkos::is_view<non_const_scalar_t>::value ) { 
+            impl::_scal(space,y,alpha,x) ; 
         } else {
-            KokkosBlas::scal(y,alpha,x) ; 
+            KokkosBlas::scal(space,y,alpha,x) ; 
         }  
     } else {
         // otherwise alpha is a rank 1 view itself 
         static_assert(Kokkos::is_view<scalar_t>::value, "If x and y are rank 2 then alpha must be a Kokkos::View.") ; 
         static_assert(scalar_t::rank() == 1, "If x and y are rank 2 then alpha must be rank 1.") ; 
         using non_const_scalar_t = typename scalar_t::non_const_value_type ; 
-        if constexpr (   Sacado::IsFad<scalar_out_t>::value
-                    or   Sacado::IsFad<scalar_in_t>::value
-                    or   Sacado::IsFad<non_const_scalar_t>::value ) { 
-            impl::_scal(y,alpha,x) ; 
+        if constexpr (   impl::is_ad_v<scalar_out_t>
+                    or   impl::is_ad_v<scalar_in_t>
+                    or   impl::is_ad_v<non_const_scalar_t> ) { 
+            impl::_scal(space,y,alpha,x) ; 
         } else {
-            KokkosBlas::scal(y,alpha,x) ; 
+            KokkosBlas::scal(space,y,alpha,x) ; 
         }  
     }
     
 }
 
+/**
+ * @brief y = alpha x, enqueued on the default execution space instance.
+ * \ingroup blas
+ */
 template< typename out_view_t 
         , typename scalar_t 
         , typename in_view_t >
-void GRACE_ALWAYS_INLINE
-axpy(scalar_t const& alpha, in_view_t const& x, out_view_t const& y) 
+void SKL_ALWAYS_INLINE
+scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x) 
+{
+    scal(Kokkos::DefaultExecutionSpace(), y, alpha, x) ; 
+}
+
+/**
+ * @brief y = x / alpha, enqueued on an execution space instance.
+ * \ingroup blas
+ * 
+ * Reciprocal scaling of rank 1 Views, alpha is a scalar or a rank 0
+ * View. Together with nrm2(space, view, result) this normalizes a 
+ * vector without reading the norm back to host.
+ */
+template< typename exec_t
+        , typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+requires Kokkos::is_execution_space<exec_t>::value
+void SKL_ALWAYS_INLINE
+rscal(exec_t const& space, out_view_t const& y, scalar_t const& alpha, in_view_t const& x) 
+{
+    static_assert( Kokkos::is_view<out_view_t>::value, "out_view_t must be a Kokkos::View.");
+    static_assert( Kokkos::is_view<in_view_t>::value, "in_view_t must be a Kokkos::View.");
+    static_assert( out_view_t::rank() == 1 and in_view_t::rank() == 1, "rscal is only implemented for rank 1 Views.") ; 
+    impl::_rscal(space,y,alpha,x) ; 
+}
+
+/**
+ * @brief y = x / alpha, enqueued on the default execution space instance.
+ * \ingroup blas
+ */
+template< typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+void SKL_ALWAYS_INLINE
+rscal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x) 
+{
+    rscal(Kokkos::DefaultExecutionSpace(), y, alpha, x) ; 
+}
+
+/**
+ * @brief y = y + alpha x, enqueued on an execution space instance.
+ * \ingroup blas
+ * 
+ * For rank 1 Views alpha is a scalar or a rank 0 View, which is read 
+ * inside the kernel. For rank 2 Views alpha is a rank 1 View with 
+ * one entry per column.
+ */
+template< typename exec_t
+        , typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+requires Kokkos::is_execution_space<exec_t>::value
+void SKL_ALWAYS_INLINE
+axpy(exec_t const& space, scalar_t const& alpha, in_view_t const& x, out_view_t const& y) 
 {
     /* Let's do some checks on the inputs! */
     static_assert( Kokkos::is_view<out_view_t>::value, "out_view_t must be a Kokkos::View.");
@@ -230,29 +469,66 @@ axpy(scalar_t const& alpha, in_view_t const& x, out_view_t const& y)
     if constexpr ( rank_in == 1 ) {
         // If the views are rank 1 then alpha is a true scalar 
         using non_const_scalar_t = typename std::remove_cvref_t<scalar_t > ; 
-        if constexpr (   Sacado::IsFad<scalar_out_t>::value
-                    or   Sacado::IsFad<scalar_in_t>::value
-                    or   Sacado::IsFad<non_const_scalar_t>::value ) { 
-            impl::_axpy(alpha,x,y) ; 
+        if constexpr (   impl::is_ad_v<scalar_out_t>
+                    or   impl::is_ad_v<scalar_in_t>
+                    or   impl::is_ad_v<non_const_scalar_t> 
+                    or   Kokkos::is_view<non_const_scalar_t>::value ) { 
+            impl::_axpy(space,alpha,x,y) ; 
         } else {
-            KokkosBlas::axpy(alpha,x,y) ; 
+            KokkosBlas::axpy(space,alpha,x,y) ; 
         }  
     } else {
         // otherwise alpha is a rank 1 view itself 
         static_assert(Kokkos::is_view<scalar_t>::value, "If x and y are rank 2 then alpha must be a Kokkos::View.") ; 
         static_assert(scalar_t::rank() == 1, "If x and y are rank 2 then alpha must be rank 1.") ; 
         using non_const_scalar_t = typename scalar_t::non_const_value_type ; 
-        if constexpr (   Sacado::IsFad<scalar_out_t>::value
-                    or   Sacado::IsFad<scalar_in_t>::value
-                    or   Sacado::IsFad<non_const_scalar_t>::value ) { 
-            impl::_axpy(alpha,x,y) ; 
+        if constexpr (   impl::is_ad_v<scalar_out_t>
+                    or   impl::is_ad_v<scalar_in_t>
+                    or   impl::is_ad_v<non_const_scalar_t> ) { 
+            impl::_axpy(space,alpha,x,y) ; 
         } else {
-            KokkosBlas::axpy(alpha,x,y) ; 
+            KokkosBlas::axpy(space,alpha,x,y) ; 
         }  
     }
     
 }
 
+/**
+ * @brief y = y + alpha x, enqueued on the default execution space instance.
+ * \ingroup blas
+ */
+template< typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+void SKL_ALWAYS_INLINE
+axpy(scalar_t const& alpha, in_view_t const& x, out_view_t const& y) 
+{
+    axpy(Kokkos::DefaultExecutionSpace(), alpha, x, y) ; 
+}
+
+/**
+ * @brief y = y + c alpha x, with alpha a rank 0 View.
+ * \ingroup blas
+ * 
+ * The host scalar c allows e.g. to subtract a projection whose 
+ * coefficient was computed by dot(space, v, w, result) without an
+ * additional kernel to negate it.
+ */
+template< typename exec_t
+        , typename out_view_t 
+        , typename alpha_view_t 
+        , typename in_view_t >
+requires ( Kokkos::is_execution_space<exec_t>::value and Kokkos::is_view<alpha_view_t>::value )
+void SKL_ALWAYS_INLINE
+axpy(exec_t const& space, SKL_REAL c, alpha_view_t const& alpha, in_view_t const& x, out_view_t const& y) 
+{
+    static_assert( Kokkos::is_view<out_view_t>::value, "out_view_t must be a Kokkos::View.");
+    static_assert( Kokkos::is_view<in_view_t>::value, "in_view_t must be a Kokkos::View.");
+    static_assert( alpha_view_t::rank() == 0, "alpha must be a rank 0 View.") ; 
+    static_assert( out_view_t::rank() == 1 and in_view_t::rank() == 1, "Scaled axpy is only implemented for rank 1 Views.") ; 
+    impl::_axpy(space,alpha,x,y,c) ; 
+}
+
 }} 
 
 #endif /* SKL_UTILS_LINALG_HH */
\ No newline at end of file
@@ -35,92 +35,399 @@
 #include <SKL/utils/types.hh>
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
 #include <Sacado.hpp> 
 
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
 namespace utils { namespace linalg {
 
 namespace impl {
 
 template < typename T >
-typename std::enable_if<std::is_scalar_v<T>, GRACE_REAL>::type 
-GRACE_ALWAYS_INLINE GRACE_HOST_DEVICE 
+typename std::enable_if<std::is_scalar_v<T>, SKL_REAL>::type 
+SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
 scalarize(T const& x) 
 { return x ; }; 
 
 template < typename T >
-typename std::enable_if<Sacado::IsFad<T>::value, GRACE_REAL>::type 
-GRACE_ALWAYS_INLINE GRACE_HOST_DEVICE 
+typename std::enable_if<Sacado::IsFad<T>::value, SKL_REAL>::type 
+SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
 scalarize(T const& x) 
 { return x.val() ; };
 
+template < typename T >
+typename std::enable_if<skl::is_dual_v<T>, SKL_REAL>::type 
+SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+scalarize(T const& x) 
+{ return x.val() ; };
 
-template< typename view_t >
-GRACE_REAL GRACE_ALWAYS_INLINE 
-_nrm2(view_t const & view )
+/**
+ * @brief Value of a scaling factor passed either as a scalar or as 
+ *        a rank 0 View, read inside the kernel.
+ */
+template < typename T >
+SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
+auto read_alpha(T const& alpha) 
+{
+    if constexpr ( Kokkos::is_view<T>::value ) {
+        return alpha() ; 
+    } else {
+        return alpha ; 
+    }
+}
+
+
+//! Whether values of type T need scalarize() before reaching KokkosBlas
+template < typename T >
+constexpr bool is_ad_v = Sacado::IsFad<T>::value or skl::is_dual_v<T> ; 
+
+/**
+ * @brief Address of the value of entry i, the entry itself for plain 
+ *        types and its val() for Fad and dual types.
+ */
+template < typename view_t >
+SKL_ALWAYS_INLINE 
+auto value_pointer(view_t const& view, size_t i) 
 {
     using scalar_t = typename view_t::non_const_value_type ; 
-    GRACE_REAL res { 0. } ; 
-    Kokkos::parallel_reduce("linalg::nrm2", view.extent(0)
-                           , KOKKOS_LAMBDA (int i, GRACE_REAL& val)
+    if constexpr ( std::is_scalar_v<scalar_t> ) {
+        return &view(i) ; 
+    } else {
+        return &view(i).val() ; 
+    }
+}
+
+/**
+ * @brief Whether reductions over view_t on exec_t may use simd_dot_functor,
+ *        i.e. exec_t runs on host and the values are SKL_REAL.
+ */
+template < typename exec_t, typename view_t >
+constexpr bool simd_reducible_v = 
+        Kokkos::SpaceAccessibility<exec_t, Kokkos::HostSpace>::accessible
+    and view_t::rank() == 1 
+    and std::is_same_v< std::remove_cvref_t<decltype(*value_pointer(std::declval<view_t const&>(), 0))>
+                      , SKL_REAL > ; 
+
+/**
+ * @brief Strided value array of a rank 1 View, with the values at 
+ *        ptr[i*stride].
+ * 
+ * For Fad and dual Views the values are interleaved with the 
+ * derivatives, e.g. the stride of a sfad_view_t<1> is 2 and the 
+ * stride of a plain contiguous View is 1. The stride is measured 
+ * from the addresses of the first two entries, and the array is 
+ * only valid if the last entry sits where the stride predicts it.
+ */
+struct strided_values {
+    SKL_REAL const* ptr ; //!< Value of entry 0
+    std::ptrdiff_t stride ; //!< Distance between consecutive values
+    bool valid ; //!< Whether all values are at ptr[i*stride]
+
+    template< typename view_t >
+    static strided_values from(view_t const& view) {
+        size_t const N = view.extent(0) ; 
+        if( N == 0 ) return { nullptr, 1, false } ; 
+        SKL_REAL const* p0 = value_pointer(view, 0) ; 
+        std::ptrdiff_t const stride = N > 1 ? value_pointer(view, 1) - p0 : 1 ; 
+        bool const valid = stride > 0 and value_pointer(view, N-1) == p0 + (N-1) * stride ; 
+        return { p0, stride, valid } ; 
+    }
+} ; 
+
+/**
+ * @brief SIMD dot product of two strided value arrays.
+ * 
+ * Every work item reduces one block of contiguous indices. Within 
+ * a block n_acc independent simd accumulators are updated in turn, 
+ * so that consecutive fused multiply adds do not wait on each other.
+ * Unit stride values are loaded with copy_from(), other strides are 
+ * gathered lane by lane through the generator constructor of simd.
+ * The lanes of the accumulators and the remainder of the block are 
+ * summed in scalar arithmetic.
+ */
+struct simd_dot_functor {
+    using simd_t = Kokkos::Experimental::native_simd<SKL_REAL> ; 
+    static constexpr size_t width = simd_t::size() ; 
+    static constexpr size_t n_acc = 4 ; 
+    static constexpr size_t block = 64 * n_acc * width ; 
+
+    strided_values a, b ; 
+    size_t N ; 
+
+    static size_t league_size(size_t N) { return (N + block - 1) / block ; }
+
+    static simd_t load(strided_values const& x, size_t i) {
+        if( x.stride == 1 ) {
+            simd_t r ; 
+            r.copy_from(x.ptr + i, Kokkos::Experimental::element_aligned_tag()) ; 
+            return r ; 
+        }
+        SKL_REAL const* p = x.ptr + i * x.stride ; std::ptrdiff_t const s = x.stride ; 
+        return simd_t([=] (auto lane) { return p[static_cast<std::ptrdiff_t>(lane) * s] ; }) ; 
+    }
+
+    void operator() (size_t k, SKL_REAL& sum) const {
+        size_t const begin = k * block ; 
+        size_t const end   = begin + block < N ? begin + block : N ; 
+        simd_t acc[n_acc] ; 
+        for( size_t u=0; u<n_acc; ++u) acc[u] = simd_t(0.) ; 
+        size_t i = begin ; 
+        for( ; i + n_acc * width <= end; i += n_acc * width) {
+            for( size_t u=0; u<n_acc; ++u) {
+                acc[u] += load(a, i + u * width) * load(b, i + u * width) ; 
+            }
+        }
+        for( ; i + width <= end; i += width) {
+            acc[0] += load(a, i) * load(b, i) ; 
+        }
+        for( size_t u=1; u<n_acc; ++u) acc[0] += acc[u] ; 
+        SKL_REAL lanes[width] ; 
+        acc[0].copy_to(lanes, Kokkos::Experimental::element_aligned_tag()) ; 
+        SKL_REAL val { 0. } ; 
+        for( size_t l=0; l<width; ++l) val += lanes[l] ; 
+        for( ; i < end; ++i) val += a.ptr[i * a.stride] * b.ptr[i * b.stride] ; 
+        sum += val ; 
+    }
+} ; 
+
+template< typename exec_t
+        , typename view_t >
+requires Kokkos::is_execution_space<exec_t>::value
+SKL_REAL SKL_ALWAYS_INLINE 
+_nrm2(exec_t const& space, view_t const & view )
+{
+    using scalar_t = typename view_t::non_const_value_type ; 
+    SKL_REAL res { 0. } ; 
+    Kokkos::parallel_reduce("linalg::nrm2", Kokkos::RangePolicy<exec_t>(space, 0, view.extent(0))
+                           , KOKKOS_LAMBDA (int i, SKL_REAL& val)
             {
                 val += scalarize<scalar_t>(view(i)) * scalarize<scalar_t>(view(i)) ; 
-            }, Kokkos::Sum<GRACE_REAL>(res)) ; 
+            }, Kokkos::Sum<SKL_REAL>(res)) ; 
     return Kokkos::sqrt(res) ; 
 }
 
+template< typename exec_t
+        , typename view_t
+        , typename result_t >
+requires Kokkos::is_execution_space<exec_t>::value
+void SKL_ALWAYS_INLINE 
+_nrm2(exec_t const& space, view_t const & view, result_t const& result )
+{
+    using scalar_t = typename view_t::non_const_value_type ; 
+    Kokkos::parallel_reduce("linalg::nrm2", Kokkos::RangePolicy<exec_t>(space, 0, view.extent(0))
+                           , KOKKOS_LAMBDA (int i, SKL_REAL& val)
+            {
+                val += scalarize<scalar_t>(view(i)) * scalarize<scalar_t>(view(i)) ; 
+            }, result) ; 
+    Kokkos::parallel_for("linalg::nrm2_sqrt", Kokkos::RangePolicy<exec_t>(space, 0, 1)
+                        , KOKKOS_LAMBDA (int)
+            {
+                result() = Kokkos::sqrt(result()) ; 
+            }) ; 
+}
+
+template< typename view_t >
+SKL_REAL SKL_ALWAYS_INLINE 
+_nrm2(view_t const & view )
+{
+    return _nrm2(Kokkos::DefaultExecutionSpace(), view) ; 
+}
+
 template< typename team_t
         , typename view_t  >
-GRACE_REAL GRACE_ALWAYS_INLINE GRACE_HOST_DEVICE 
+requires ( not Kokkos::is_execution_space<team_t>::value )
+SKL_REAL SKL_ALWAYS_INLINE SKL_HOST_DEVICE 
 _nrm2(team_t team, view_t const & view )
 {
     using scalar_t = typename view_t::non_const_value_type ; 
-    GRACE_REAL res { 0. } ; 
+    SKL_REAL res { 0. } ; 
     Kokkos::parallel_reduce("linalg::nrm2", Kokkos::TeamThreadRange(team, 0, view.extent(0))
-                           , KOKKOS_LAMBDA (int i, GRACE_REAL& val)
+                           , KOKKOS_LAMBDA (int i, SKL_REAL& val)
             {
                 val += scalarize<scalar_t>(view(i)) * scalarize<scalar_t>(view(i)) ; 
-            }, Kokkos::Sum<GRACE_REAL>(res)) ; 
+            }, Kokkos::Sum<SKL_REAL>(res)) ; 
     return Kokkos::sqrt(res) ; 
 }
 
-template< typename view_a_t 
+template< typename exec_t
+        , typename view_a_t 
         , typename view_b_t >
-GRACE_REAL GRACE_ALWAYS_INLINE 
-_dot(view_a_t const & v,  view_b_t const & w)
+requires Kokkos::is_execution_space<exec_t>::value
+SKL_REAL SKL_ALWAYS_INLINE 
+_dot(exec_t const& space, view_a_t const & v,  view_b_t const & w)
 {
     using scalar_a_t = typename view_a_t::non_const_value_type ; 
     using scalar_b_t = typename view_b_t::non_const_value_type ; 
-    GRACE_REAL res { 0. } ; 
-    Kokkos::parallel_reduce("linalg::dot", v.extent(0)
-                           , KOKKOS_LAMBDA (int i, GRACE_REAL& val)
+    SKL_REAL res { 0. } ; 
+    Kokkos::parallel_reduce("linalg::dot", Kokkos::RangePolicy<exec_t>(space, 0, v.extent(0))
+                           , KOKKOS_LAMBDA (int i, SKL_REAL& val)
             {
                 val += scalarize<scalar_a_t>(v(i)) * scalarize<scalar_b_t>(w(i)) ; 
-            }, Kokkos::Sum<GRACE_REAL>(res)) ; 
+            }, Kokkos::Sum<SKL_REAL>(res)) ; 
     return res ; 
 }
 
+template< typename exec_t
+        , typename view_a_t 
+        , typename view_b_t 
+        , typename result_t >
+requires Kokkos::is_execution_space<exec_t>::value
+void SKL_ALWAYS_INLINE 
+_dot(exec_t const& space, view_a_t const & v,  view_b_t const & w, result_t const& result)
+{
+    using scalar_a_t = typename view_a_t::non_const_value_type ; 
+    using scalar_b_t = typename view_b_t::non_const_value_type ; 
+    Kokkos::parallel_reduce("linalg::dot", Kokkos::RangePolicy<exec_t>(space, 0, v.extent(0))
+                           , KOKKOS_LAMBDA (int i, SKL_REAL& val)
+            {
+                val += scalarize<scalar_a_t>(v(i)) * scalarize<scalar_b_t>(w(i)) ; 
+            }, result) ; 
+}
+
+template< typename view_a_t 
+        , typename view_b_t >
+SKL_REAL SKL_ALWAYS_INLINE 
+_dot(view_a_t const & v,  view_b_t const & w)
+{
+    return _dot(Kokkos::DefaultExecutionSpace(), v, w) ; 
+}
+
 template< typename team_t 
         , typename view_a_t 
         , typename view_b_t >
-GRACE_REAL GRACE_ALWAYS_INLINE GRACE_HOST_DEVICE
+requires ( not Kokkos::is_execution_space<team_t>::value )
+SKL_REAL SKL_ALWAYS_INLINE SKL_HOST_DEVICE
 _dot(team_t team, view_a_t const & v,  view_b_t const & w)
 {
     using scalar_a_t = typename view_a_t::non_const_value_type ; 
     using scalar_b_t = typename view_b_t::non_const_value_type ;
-    GRACE_REAL res { 0. } ; 
+    SKL_REAL res { 0. } ; 
     Kokkos::parallel_reduce("linalg::dot", Kokkos::TeamThreadRange(team, 0, v.extent(0))
-                           , KOKKOS_LAMBDA (int i, GRACE_REAL& val)
+                           , KOKKOS_LAMBDA (int i, SKL_REAL& val)
             {
                 val += scalarize<scalar_a_t>(v(i)) * scalarize<scalar_b_t>(w(i)) ; 
-            }, Kokkos::Sum<GRACE_REAL>(res)) ; 
+            }, Kokkos::Sum<SKL_REAL>(res)) ; 
     return res ; 
 }
 
-template< typename out_view_t 
+/**
+ * @brief Dot product through simd_dot_functor, falls back to _dot()
+ *        if a value array is not strided.
+ */
+template< typename exec_t
+        , typename view_a_t 
+        , typename view_b_t >
+requires Kokkos::is_execution_space<exec_t>::value
+SKL_REAL 
+_dot_simd(exec_t const& space, view_a_t const & v,  view_b_t const & w)
+{
+    simd_dot_functor f { strided_values::from(v), strided_values::from(w), v.extent(0) } ; 
+    if( not f.a.valid or not f.b.valid ) {
+        return f.N == 0 ? SKL_REAL(0.) : _dot(space, v, w) ; 
+    }
+    SKL_REAL res { 0. } ; 
+    Kokkos::parallel_reduce("linalg::dot_simd", Kokkos::RangePolicy<exec_t>(space, 0, simd_dot_functor::league_size(f.N))
+                           , f, Kokkos::Sum<SKL_REAL>(res)) ; 
+    return res ; 
+}
+
+template< typename exec_t
+        , typename view_a_t 
+        , typename view_b_t 
+        , typename result_t >
+requires Kokkos::is_execution_space<exec_t>::value
+void 
+_dot_simd(exec_t const& space, view_a_t const & v,  view_b_t const & w, result_t const& result)
+{
+    simd_dot_functor f { strided_values::from(v), strided_values::from(w), v.extent(0) } ; 
+    if( not f.a.valid or not f.b.valid ) {
+        _dot(space, v, w, result) ; 
+        return ; 
+    }
+    Kokkos::parallel_reduce("linalg::dot_simd", Kokkos::RangePolicy<exec_t>(space, 0, simd_dot_functor::league_size(f.N))
+                           , f, result) ; 
+}
+
+template< typename exec_t
+        , typename view_t >
+requires Kokkos::is_execution_space<exec_t>::value
+SKL_REAL 
+_nrm2_simd(exec_t const& space, view_t const & view)
+{
+    return Kokkos::sqrt(_dot_simd(space, view, view)) ; 
+}
+
+template< typename exec_t
+        , typename view_t 
+        , typename result_t >
+requires Kokkos::is_execution_space<exec_t>::value
+void 
+_nrm2_simd(exec_t const& space, view_t const & view, result_t const& result)
+{
+    _dot_simd(space, view, view, result) ; 
+    Kokkos::parallel_for("linalg::nrm2_sqrt", Kokkos::RangePolicy<exec_t>(space, 0, 1)
+                        , KOKKOS_LAMBDA (int)
+            {
+                result() = Kokkos::sqrt(result()) ; 
+            }) ; 
+}
+
+/**
+ * @brief Array reduction computing n dot products in one pass.
+ * 
+ * The views are stored pairwise, the k-th product is 
+ * ( views[2k], views[2k+1] ).
+ */
+template< typename view_t, size_t n >
+struct fused_dot_functor {
+    using value_type = SKL_REAL[] ; 
+    using size_type  = size_t ; 
+    using scalar_t   = typename view_t::non_const_value_type ; 
+
+    size_type value_count { n } ; 
+    Kokkos::Array<view_t, 2*n> views ; 
+
+    KOKKOS_INLINE_FUNCTION 
+    void operator() (int i, value_type sum) const {
+        for( size_t k=0; k<n; ++k) {
+            sum[k] += scalarize<scalar_t>(views[2*k](i)) * scalarize<scalar_t>(views[2*k+1](i)) ; 
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION 
+    void init(value_type sum) const {
+        for( size_t k=0; k<n; ++k) sum[k] = 0. ; 
+    }
+
+    KOKKOS_INLINE_FUNCTION 
+    void join(value_type dst, value_type const src) const {
+        for( size_t k=0; k<n; ++k) dst[k] += src[k] ; 
+    }
+} ; 
+
+template< typename exec_t
+        , typename view_t
+        , size_t n_views >
+std::array<SKL_REAL, n_views/2> 
+_dots(exec_t const& space, view_t const (&views)[n_views])
+{
+    fused_dot_functor<view_t, n_views/2> f ; 
+    for( size_t k=0; k<n_views; ++k) f.views[k] = views[k] ; 
+    std::array<SKL_REAL, n_views/2> res ; 
+    Kokkos::parallel_reduce("linalg::dots", Kokkos::RangePolicy<exec_t>(space, 0, views[0].extent(0))
+                           , f, res.data()) ; 
+    return res ; 
+}
+
+template< typename exec_t
+        , typename out_view_t 
         , typename scalar_t 
         , typename in_view_t >
 void  
-_scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
+_scal(exec_t const& space, out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
 {
     size_t constexpr rank_out = out_view_t::rank() ; 
     size_t constexpr rank_in  = in_view_t::rank()  ; 
@@ -128,17 +435,18 @@ _scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
     if constexpr ( rank_in == 1 ) {
         using out_scal_t = typename out_view_t::non_const_value_type ; 
         // ASSERT(x.extent(0) == y.extent(0)    ) ; 
-        if constexpr ( Sacado::IsFad<out_scal_t>::value ) {
-            Kokkos::parallel_for("linalg::scal", x.extent(0), 
+        Kokkos::RangePolicy<exec_t> policy(space, 0, x.extent(0)) ; 
+        if constexpr ( is_ad_v<out_scal_t> ) {
+            Kokkos::parallel_for("linalg::scal", policy, 
             KOKKOS_LAMBDA(int i) 
             {
-                y(i) = alpha * x(i) ; 
+                y(i) = read_alpha(alpha) * x(i) ; 
             }) ;
         } else {
-            Kokkos::parallel_for("linalg::scal", x.extent(0), 
+            Kokkos::parallel_for("linalg::scal", policy, 
             KOKKOS_LAMBDA(int i) 
             {
-                y(i) = scalarize(alpha) * scalarize(x(i)) ; 
+                y(i) = scalarize(read_alpha(alpha)) * scalarize(x(i)) ; 
             }) ;
         }
         
@@ -148,9 +456,9 @@ _scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
         // ASSERT(x.extent(0) == y.extent(0)    ) ;
         using out_scal_t = typename out_view_t::non_const_value_type ; 
 
-        Kokkos::MDRangePolicy<Kokkos::Rank<2>, Kokkos::DefaultExecutionSpace> 
-            policy( {0,0}, {x.extent(0), x.extent(1)} ) ;
-        if constexpr ( Sacado::IsFad<out_scal_t>::value ) {
+        Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t> 
+            policy( space, {0,0}, {x.extent(0), x.extent(1)} ) ;
+        if constexpr ( is_ad_v<out_scal_t> ) {
             Kokkos::parallel_for( "linalg::scal", policy, 
                 KOKKOS_LAMBDA( int i, int j) 
             {
@@ -171,7 +479,41 @@ template< typename out_view_t
         , typename scalar_t 
         , typename in_view_t >
 void  
-_axpy(scalar_t const& alpha, in_view_t const& x, out_view_t const& y) 
+_scal(out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
+{
+    _scal(Kokkos::DefaultExecutionSpace(), y, alpha, x) ; 
+}
+
+template< typename exec_t
+        , typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+void  
+_rscal(exec_t const& space, out_view_t const& y, scalar_t const& alpha, in_view_t const& x)
+{
+    using out_scal_t = typename out_view_t::non_const_value_type ; 
+    Kokkos::RangePolicy<exec_t> policy(space, 0, x.extent(0)) ; 
+    if constexpr ( is_ad_v<out_scal_t> ) {
+        Kokkos::parallel_for("linalg::rscal", policy, 
+        KOKKOS_LAMBDA(int i) 
+        {
+            y(i) = x(i) / read_alpha(alpha) ; 
+        }) ;
+    } else {
+        Kokkos::parallel_for("linalg::rscal", policy, 
+        KOKKOS_LAMBDA(int i) 
+        {
+            y(i) = scalarize(x(i)) / scalarize(read_alpha(alpha)) ; 
+        }) ;
+    }
+}
+
+template< typename exec_t
+        , typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+void  
+_axpy(exec_t const& space, scalar_t const& alpha, in_view_t const& x, out_view_t const& y, SKL_REAL c = 1.) 
 {
     size_t constexpr rank_out = out_view_t::rank() ; 
     size_t constexpr rank_in  = in_view_t::rank()  ; 
@@ -179,42 +521,52 @@ _axpy(scalar_t const& alpha, in_view_t const& x, out_view_t const& y)
     if constexpr ( rank_in == 1 ) {
         // ASSERT(x.extent(0) == y.extent(0)    ) ; 
         using out_scal_t = typename out_view_t::non_const_value_type ; 
-        if constexpr ( Sacado::IsFad<out_scal_t>::value ) {
-            Kokkos::parallel_for("linalg::axpy", x.extent(0), 
+        Kokkos::RangePolicy<exec_t> policy(space, 0, x.extent(0)) ; 
+        if constexpr ( is_ad_v<out_scal_t> ) {
+            Kokkos::parallel_for("linalg::axpy", policy, 
                     KOKKOS_LAMBDA(int i) 
             {
-                y(i) += alpha * x(i) ; 
+                y(i) += c * read_alpha(alpha) * x(i) ; 
             }) ; 
         } else {
-            Kokkos::parallel_for("linalg::axpy", x.extent(0), 
+            Kokkos::parallel_for("linalg::axpy", policy, 
                     KOKKOS_LAMBDA(int i) 
             {
-                y(i) += scalarize(alpha) * scalarize(x(i)) ; 
+                y(i) += c * scalarize(read_alpha(alpha)) * scalarize(x(i)) ; 
             }) ; 
         }
     } else {
         // ASSERT(x.extent(1) == alpha.extent(0)) ; 
         // ASSERT(x.extent(0) == y.extent(0)    ) ; 
         using out_scal_t = typename out_view_t::non_const_value_type ;
-        Kokkos::MDRangePolicy<Kokkos::Rank<2>, Kokkos::DefaultExecutionSpace> 
-            policy( {0,0}, {x.extent(0), x.extent(1)} ) ; 
-        if constexpr ( Sacado::IsFad<out_scal_t>::value ) {
+        Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t> 
+            policy( space, {0,0}, {x.extent(0), x.extent(1)} ) ; 
+        if constexpr ( is_ad_v<out_scal_t> ) {
             Kokkos::parallel_for( "linalg::axpy", policy, 
                 KOKKOS_LAMBDA( int i, int j) 
             {
-                y(i,j) += alpha(j) * x(i,j)  ;
+                y(i,j) += c * alpha(j) * x(i,j)  ;
             }) ; 
         } else {
             Kokkos::parallel_for( "linalg::axpy", policy, 
                 KOKKOS_LAMBDA( int i, int j) 
             {
-                y(i,j) += scalarize(alpha(j)) * scalarize(x(i,j))  ;
+                y(i,j) += c * scalarize(alpha(j)) * scalarize(x(i,j))  ;
             }) ;
         }
     }
     
 }
 
+template< typename out_view_t 
+        , typename scalar_t 
+        , typename in_view_t >
+void  
+_axpy(scalar_t const& alpha, in_view_t const& x, out_view_t const& y) 
+{
+    _axpy(Kokkos::DefaultExecutionSpace(), alpha, x, y) ; 
+}
+
 
 } /* namespace impl */
 
@@ -32,25 +32,40 @@
 
 #include <SKL/utils/inline.h>
 #include <SKL/utils/types.hh>
+#include <SKL/utils/workspace.hh>
+#include <SKL/utils/blas/SKL_blas_3_impl.hh>
 
 #include <Kokkos_Core.hpp>
 #include <KokkosBlas3_trsm.hpp> 
+#include <KokkosBlas3_gemm.hpp> 
 
 #include <Sacado.hpp>
 
 
 namespace utils { namespace linalg {
 
-template< typename view_a_t 
+/**
+ * @brief Triangular solve op(A) X = alpha B or X op(A) = alpha B on an
+ *        execution space instance.
+ * \ingroup blas
+ * 
+ * B is overwritten by X. Views of Fad types are copied to plain 
+ * temporaries, taken from <code>ws</code> if one is given.
+ */
+template< typename exec_t
+        , typename view_a_t 
         , typename view_b_t > 
+requires Kokkos::is_execution_space<exec_t>::value
 void trsm(
+    exec_t const& space,
     const char side[],
     const char uplo[],
     const char trans[],
     const char diag[],
     typename view_b_t::const_value_type& alpha,
     const view_a_t & A,
-    const view_b_t & B ) 
+    const view_b_t & B,
+    skl::workspace<>* ws = nullptr ) 
 {
     using scalar_a_t = typename view_a_t::const_value_type ; 
     using scalar_b_t = typename view_b_t::const_value_type ;
@@ -59,48 +74,55 @@ void trsm(
     constexpr size_t rank_b = view_b_t::rank() ; 
     static_assert( rank_a == 2 
              and ( rank_b == 2 or rank_b == 1), "trsm only supports rank-2 or 1 Views.") ; 
+
+    // Temporaries come from the workspace if one is given
+    using tmp_t = Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> ; 
+    size_t const ws_mark = ws != nullptr ? ws->mark() : 0 ; 
+    auto make_tmp = [ws, &space] (const char label[], size_t n0, size_t n1) {
+        if( ws != nullptr ) {
+            return tmp_t(ws->template view<tmp_t>(n0, n1)) ; 
+        }
+        return tmp_t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, label), n0, n1) ; 
+    } ; 
     
 
 
     if constexpr (  Sacado::IsFad<scalar_a_t>::value 
                 and Sacado::IsFad<scalar_b_t>::value ) 
     {
-        Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-            _A("trsm_A", A.extent(0), A.extent(1) ) ; 
-        Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{A.extent(0),A.extent(1)})
+        tmp_t const _A = make_tmp("trsm_A", A.extent(0), A.extent(1)) ; 
+        Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0,0},{A.extent(0),A.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _A(i,j) = A(i,j).val() ;                 
             }) ;
-        const GRACE_REAL _alpha = alpha.val() ; 
+        const SKL_REAL _alpha = alpha.val() ; 
 
         if constexpr( rank_b == 1) {
-            Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-                _B("trsm_B", B.extent(0), 1 ) ; 
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),1UL})
+            tmp_t const _B = make_tmp("trsm_B", B.extent(0), 1) ; 
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),1UL})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _B(i,j) = B(i).val() ;                 
             }) ; 
-            KokkosBlas::trsm(side,uplo,trans,diag,_alpha,_A,_B) ; 
+            KokkosBlas::trsm(space,side,uplo,trans,diag,_alpha,_A,_B) ; 
             // copy data back
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 B(i) = _B(i,j) ;                 
             }) ;
         } else {
-            Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-                _B("trsm_B", B.extent(0), B.extent(1) ) ;
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            tmp_t const _B = make_tmp("trsm_B", B.extent(0), B.extent(1)) ;
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _B(i,j) = B(i,j).val() ;                 
             }) ; 
-            KokkosBlas::trsm(side,uplo,trans,diag,_alpha,_A,_B) ;
+            KokkosBlas::trsm(space,side,uplo,trans,diag,_alpha,_A,_B) ;
             #if 1
             // copy data back
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 B(i,j) = _B(i,j) ;                 
@@ -108,60 +130,56 @@ void trsm(
             #endif 
         }
     } else if constexpr ( Sacado::IsFad<scalar_a_t>::value  ) {
-        Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-            _A("trsm_A", A.extent(0), A.extent(1) ) ; 
-        Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{A.extent(0),A.extent(1)})
+        tmp_t const _A = make_tmp("trsm_A", A.extent(0), A.extent(1)) ; 
+        Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0,0},{A.extent(0),A.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _A(i,j) = A(i,j).val() ;                 
             }) ;
         if constexpr( rank_b == 1) {
-            Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-                _B("trsm_B", B.extent(0), 1 ) ; 
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),1UL})
+            tmp_t const _B = make_tmp("trsm_B", B.extent(0), 1) ; 
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),1UL})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _B(i,j) = B(i) ;                 
             }) ; 
-            KokkosBlas::trsm(side,uplo,trans,diag,alpha,_A,_B) ; 
+            KokkosBlas::trsm(space,side,uplo,trans,diag,alpha,_A,_B) ; 
             // copy data back
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 B(i) = _B(i,j) ;                 
             }) ;
         } else {
-            KokkosBlas::trsm(side,uplo,trans,diag,alpha,_A,B) ; 
+            KokkosBlas::trsm(space,side,uplo,trans,diag,alpha,_A,B) ; 
         }
     } else if constexpr ( Sacado::IsFad<scalar_b_t>::value ) {
-        GRACE_REAL const _alpha = alpha.val() ; 
+        SKL_REAL const _alpha = alpha.val() ; 
         if constexpr( rank_b == 1) {
-            Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-                _B("trsm_B", B.extent(0), 1 ) ; 
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),1UL})
+            tmp_t const _B = make_tmp("trsm_B", B.extent(0), 1) ; 
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),1UL})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _B(i,j) = B(i).val() ;                 
             }) ; 
-            KokkosBlas::trsm(side,uplo,trans,diag,_alpha,A,_B) ;
+            KokkosBlas::trsm(space,side,uplo,trans,diag,_alpha,A,_B) ;
             // copy data back
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 B(i) = _B(i,j) ;                 
             }) ; 
 
         } else {
-            Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-                _B("trsm_B", B.extent(0), B.extent(1) ) ;
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            tmp_t const _B = make_tmp("trsm_B", B.extent(0), B.extent(1)) ;
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _B(i,j) = B(i,j).val() ;                 
             }) ;
-            KokkosBlas::trsm(side,uplo,trans,diag,_alpha,A,_B) ; 
+            KokkosBlas::trsm(space,side,uplo,trans,diag,_alpha,A,_B) ; 
             // copy data back
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 B(i,j) = _B(i,j) ;                 
@@ -169,25 +187,112 @@ void trsm(
         }
     } else {
         if constexpr( rank_b == 1) {
-            Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace>
-                _B("trsm_B", B.extent(0), 1 ) ; 
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),1UL})
+            tmp_t const _B = make_tmp("trsm_B", B.extent(0), 1) ; 
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),1UL})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 _B(i,j) = B(i) ;                 
             }) ; 
-            KokkosBlas::trsm(side,uplo,trans,diag,alpha,A,_B) ; 
+            KokkosBlas::trsm(space,side,uplo,trans,diag,alpha,A,_B) ; 
             // copy data back
-            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{B.extent(0),B.extent(1)})
+            Kokkos::parallel_for("trsm_fill_matrices", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{B.extent(0),B.extent(1)})
                             , KOKKOS_LAMBDA( int i, int j) 
             {
                 B(i) = _B(i,j) ;                 
             }) ; 
         } else {
-            KokkosBlas::trsm(side,uplo,trans,diag,alpha,A,B) ; 
+            KokkosBlas::trsm(space,side,uplo,trans,diag,alpha,A,B) ; 
         }
     }
+    if( ws != nullptr ) {
+        ws->release(ws_mark) ; 
+    }
+}
 
+/**
+ * @brief Triangular solve on the default execution space instance.
+ * \ingroup blas
+ */
+template< typename view_a_t 
+        , typename view_b_t > 
+void trsm(
+    const char side[],
+    const char uplo[],
+    const char trans[],
+    const char diag[],
+    typename view_b_t::const_value_type& alpha,
+    const view_a_t & A,
+    const view_b_t & B,
+    skl::workspace<>* ws = nullptr ) 
+{
+    trsm(Kokkos::DefaultExecutionSpace(), side, uplo, trans, diag, alpha, A, B, ws) ; 
+}
+
+/**
+ * @brief General matrix-matrix product C = beta C + alpha op(A) op(B).
+ * \ingroup blas
+ * 
+ * This function will call the KokkosBlas implementation 
+ * if the underlying types allow to do so, otherwise it
+ * will call a custom implementation operating on the 
+ * values of the Fad entries.
+ * 
+ * @tparam exec_t   Execution space type.
+ * @tparam view_a_t Type of View representing A.
+ * @tparam view_b_t Type of View representing B.
+ * @tparam view_c_t Type of View representing C.
+ * @param space  Execution space instance.
+ * @param transA "N" or "T".
+ * @param transB "N" or "T".
+ * @param alpha  Scaling of the product.
+ * @param A      Matrix A.
+ * @param B      Matrix B.
+ * @param beta   Scaling of C.
+ * @param C      Output matrix.
+ */
+template< typename exec_t
+        , typename view_a_t 
+        , typename view_b_t 
+        , typename view_c_t > 
+requires Kokkos::is_execution_space<exec_t>::value
+void SKL_ALWAYS_INLINE
+gemm( exec_t const& space, const char transA[], const char transB[]
+    , SKL_REAL alpha, view_a_t const& A, view_b_t const& B
+    , SKL_REAL beta, view_c_t const& C ) 
+{
+    static_assert( Kokkos::is_view<view_a_t>::value, "view_a_t must be a Kokkos::View.");
+    static_assert( Kokkos::is_view<view_b_t>::value, "view_b_t must be a Kokkos::View.");
+    static_assert( Kokkos::is_view<view_c_t>::value, "view_c_t must be a Kokkos::View.");
+    static_assert( view_a_t::rank() == 2 and view_b_t::rank() == 2 and view_c_t::rank() == 2
+                 , "gemm only supports rank-2 Views." ) ; 
+
+    using scalar_a_t = typename view_a_t::non_const_value_type ; 
+    using scalar_b_t = typename view_b_t::non_const_value_type ; 
+    using scalar_c_t = typename view_c_t::non_const_value_type ; 
+
+    if constexpr (   Sacado::IsFad<scalar_a_t>::value 
+                  or Sacado::IsFad<scalar_b_t>::value 
+                  or Sacado::IsFad<scalar_c_t>::value ) {
+        impl::_gemm(space, transA, transB, alpha, A, B, beta, C) ; 
+    } else {
+        KokkosBlas::gemm(space, transA, transB, alpha, A, B, beta, C) ; 
+    }
+}
+
+/**
+ * @brief General matrix-matrix product on the default execution 
+ *        space instance.
+ * \ingroup blas
+ */
+template< typename view_a_t 
+        , typename view_b_t 
+        , typename view_c_t > 
+void SKL_ALWAYS_INLINE
+gemm( const char transA[], const char transB[]
+    , SKL_REAL alpha, view_a_t const& A, view_b_t const& B
+    , SKL_REAL beta, view_c_t const& C ) 
+{
+    gemm(Kokkos::DefaultExecutionSpace(), transA, transB, alpha, A, B, beta, C) ; 
 }
 
 }} /* namespace utils::linalg */
@@ -0,0 +1,127 @@
+/**
+ * @file SKL_blas_3_impl.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Some BLAS-3 routines for views of FadTypes.
+ * @date 2026-10-19
+ * 
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * GRACE is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *                                    
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *   
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *   
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef SKL_UTILS_BLAS_3_IMPL_HH
+#define SKL_UTILS_BLAS_3_IMPL_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/inline.h>
+#include <SKL/utils/device.h>
+#include <SKL/utils/types.hh>
+#include <SKL/utils/blas/SKL_blas_1_impl.hh>
+
+#include <Kokkos_Core.hpp>
+#include <Sacado.hpp> 
+
+namespace utils { namespace linalg {
+
+namespace impl {
+
+/**
+ * @brief C = beta C + alpha op(A) op(B) for views of FadTypes.
+ * 
+ * Only the values of the Fad entries take part in the product.
+ * Products with a long inner dimension (e.g. A^T B for two
+ * blocks of vectors) are computed with one thread team per
+ * entry of C, products with a short inner dimension (e.g. a block 
+ * of vectors times a small matrix) with one thread per entry.
+ */
+template< typename exec_t
+        , typename view_a_t 
+        , typename view_b_t 
+        , typename view_c_t >
+void 
+_gemm( exec_t const& space, const char transA[], const char transB[]
+     , SKL_REAL alpha, view_a_t const& A, view_b_t const& B
+     , SKL_REAL beta, view_c_t const& C ) 
+{
+    using scalar_a_t = typename view_a_t::non_const_value_type ; 
+    using scalar_b_t = typename view_b_t::non_const_value_type ; 
+    using scalar_c_t = typename view_c_t::non_const_value_type ; 
+
+    bool const ta = (transA[0] == 'T' or transA[0] == 't') ; 
+    bool const tb = (transB[0] == 'T' or transB[0] == 't') ; 
+    size_t const n_inner = ta ? A.extent(0) : A.extent(1) ; 
+    size_t const m = C.extent(0) ; 
+    size_t const n = C.extent(1) ; 
+
+    static constexpr size_t team_threshold = 64 ; 
+
+    if ( n_inner >= team_threshold ) {
+        using team_t = typename Kokkos::TeamPolicy<exec_t>::member_type ; 
+        Kokkos::parallel_for("linalg::gemm", Kokkos::TeamPolicy<exec_t>(space, m*n, Kokkos::AUTO())
+                            , KOKKOS_LAMBDA (team_t const& team)
+            {
+                int const i = team.league_rank() % m ; 
+                int const j = team.league_rank() / m ; 
+                SKL_REAL sum { 0. } ; 
+                Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, n_inner)
+                                       , [&] (int l, SKL_REAL& lsum) 
+                    {
+                        SKL_REAL const a = ta ? scalarize<scalar_a_t>(A(l,i)) : scalarize<scalar_a_t>(A(i,l)) ; 
+                        SKL_REAL const b = tb ? scalarize<scalar_b_t>(B(j,l)) : scalarize<scalar_b_t>(B(l,j)) ; 
+                        lsum += a * b ; 
+                    }, sum) ; 
+                Kokkos::single(Kokkos::PerTeam(team), [&] () 
+                    {
+                        SKL_REAL const c = (beta == 0) ? 0 : beta * scalarize<scalar_c_t>(C(i,j)) ; 
+                        C(i,j) = c + alpha * sum ; 
+                    }) ; 
+            }) ; 
+    } else {
+        Kokkos::parallel_for("linalg::gemm", Kokkos::MDRangePolicy<Kokkos::Rank<2>, exec_t>(space, {0UL,0UL},{m,n})
+                            , KOKKOS_LAMBDA (int i, int j) 
+            {
+                SKL_REAL sum { 0. } ; 
+                for( size_t l=0; l<n_inner; ++l) {
+                    SKL_REAL const a = ta ? scalarize<scalar_a_t>(A(l,i)) : scalarize<scalar_a_t>(A(i,l)) ; 
+                    SKL_REAL const b = tb ? scalarize<scalar_b_t>(B(j,l)) : scalarize<scalar_b_t>(B(l,j)) ; 
+                    sum += a * b ; 
+                }
+                SKL_REAL const c = (beta == 0) ? 0 : beta * scalarize<scalar_c_t>(C(i,j)) ; 
+                C(i,j) = c + alpha * sum ; 
+            }) ; 
+    }
+}
+
+template< typename view_a_t 
+        , typename view_b_t 
+        , typename view_c_t >
+void 
+_gemm( const char transA[], const char transB[]
+     , SKL_REAL alpha, view_a_t const& A, view_b_t const& B
+     , SKL_REAL beta, view_c_t const& C ) 
+{
+    _gemm(Kokkos::DefaultExecutionSpace(), transA, transB, alpha, A, B, beta, C) ; 
+}
+
+} /* namespace impl */
+
+}}
+
+#endif /* SKL_UTILS_BLAS_3_IMPL_HH */
@@ -0,0 +1,321 @@
+/**
+ * @file dual.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Dual numbers for single direction forward mode differentiation.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SKL_UTILS_DUAL_HH
+#define SKL_UTILS_DUAL_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/device.h>
+#include <SKL/utils/inline.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+#include <Sacado.hpp>
+
+#include <type_traits>
+
+namespace skl {
+
+/**
+ * @brief Dual number x + dx eps, eps^2 = 0, for Jacobian-vector 
+ *        products along a single direction.
+ * \ingroup utils
+ * 
+ * The layout is the trivial pair {val, dx}, without the expression 
+ * templates and the generic derivative storage of 
+ * Sacado::Fad::SFad<T,1>, so that a View of duals is a plain array of
+ * structs and every operation is a handful of fused multiply adds. 
+ * The interface mirrors the parts of Sacado used in SKL: val(), dx(), 
+ * fastAccessDx(), the seeding constructor dual(n, i, x) and 
+ * Sacado::ScalarValue. The math functions are found through argument
+ * dependent lookup, i.e. point-wise functions written as 
+ * <code>using Kokkos::exp ; exp(u)</code> work unchanged, while 
+ * explicitly qualified calls such as <code>Kokkos::exp(u)</code> do 
+ * not.
+ * 
+ * T may be a Kokkos::Experimental::simd type, in which case one dual
+ * carries the values and directions of several grid points, see 
+ * simd_dual_t and pointwise_jvp().
+ * 
+ * The default constructor leaves the members uninitialized, as for 
+ * built-in types, which keeps the type trivial.
+ * 
+ * @tparam T Scalar type.
+ */
+template< typename T >
+struct dual 
+{
+    using value_type = T ; 
+
+    T v ; //!< Value
+    T d ; //!< Directional derivative
+
+    KOKKOS_DEFAULTED_FUNCTION dual() = default ; 
+
+    KOKKOS_INLINE_FUNCTION 
+    dual(T const& x) : v(x), d(0.) {}
+
+    template< typename S >
+    requires std::is_arithmetic_v<S> and (not std::is_same_v<S, T>)
+    KOKKOS_INLINE_FUNCTION 
+    dual(S const& x) : v(x), d(0.) {}
+
+    KOKKOS_INLINE_FUNCTION 
+    dual(T const& x, T const& dx) : v(x), d(dx) {}
+
+    //! Sacado style seeding, derivative 1 if i == 0
+    KOKKOS_INLINE_FUNCTION 
+    dual(int, int i, T const& x) : v(x), d(i == 0 ? 1. : 0.) {}
+
+    KOKKOS_INLINE_FUNCTION T const& val() const { return v ; }
+    KOKKOS_INLINE_FUNCTION T&       val()       { return v ; }
+    KOKKOS_INLINE_FUNCTION T const& dx(int = 0) const { return d ; }
+    KOKKOS_INLINE_FUNCTION T const& fastAccessDx(int = 0) const { return d ; }
+    KOKKOS_INLINE_FUNCTION T&       fastAccessDx(int = 0)       { return d ; }
+    KOKKOS_INLINE_FUNCTION static constexpr int size() { return 1 ; }
+
+    KOKKOS_INLINE_FUNCTION dual& operator+= (dual const& b) { v += b.v ; d += b.d ; return *this ; }
+    KOKKOS_INLINE_FUNCTION dual& operator-= (dual const& b) { v -= b.v ; d -= b.d ; return *this ; }
+    KOKKOS_INLINE_FUNCTION dual& operator*= (dual const& b) { d = d * b.v + v * b.d ; v *= b.v ; return *this ; }
+    KOKKOS_INLINE_FUNCTION dual& operator/= (dual const& b) { T const inv = T(1.) / b.v ; v *= inv ; d = (d - v * b.d) * inv ; return *this ; }
+} ; 
+
+template< typename T >
+struct is_dual : std::false_type {} ; 
+
+template< typename T >
+struct is_dual<dual<T>> : std::true_type {} ; 
+
+template< typename T >
+constexpr bool is_dual_v = is_dual<std::remove_cv_t<T>>::value ; 
+
+//! Dual number carrying one SIMD lane per grid point
+using simd_dual_t = dual<Kokkos::Experimental::native_simd<SKL_REAL>> ; 
+
+/* Arithmetic, the scalar overloads accept any arithmetic type */
+
+#define SKL_DUAL_SCALAR_T template< typename T, typename S > requires std::is_arithmetic_v<S>
+
+template< typename T > KOKKOS_INLINE_FUNCTION dual<T> operator+ (dual<T> const& a) { return a ; }
+template< typename T > KOKKOS_INLINE_FUNCTION dual<T> operator- (dual<T> const& a) { return { -a.v, -a.d } ; }
+
+template< typename T > KOKKOS_INLINE_FUNCTION dual<T> operator+ (dual<T> const& a, dual<T> const& b) { return { a.v + b.v, a.d + b.d } ; }
+template< typename T > KOKKOS_INLINE_FUNCTION dual<T> operator- (dual<T> const& a, dual<T> const& b) { return { a.v - b.v, a.d - b.d } ; }
+template< typename T > KOKKOS_INLINE_FUNCTION dual<T> operator* (dual<T> const& a, dual<T> const& b) { return { a.v * b.v, a.d * b.v + a.v * b.d } ; }
+template< typename T > KOKKOS_INLINE_FUNCTION dual<T> operator/ (dual<T> const& a, dual<T> const& b) {
+    T const inv = T(1.) / b.v ; T const q = a.v * inv ; 
+    return { q, (a.d - q * b.d) * inv } ; 
+}
+
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator+ (dual<T> const& a, S const& s) { return { a.v + T(s), a.d } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator+ (S const& s, dual<T> const& a) { return { T(s) + a.v, a.d } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator- (dual<T> const& a, S const& s) { return { a.v - T(s), a.d } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator- (S const& s, dual<T> const& a) { return { T(s) - a.v, -a.d } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator* (dual<T> const& a, S const& s) { return { a.v * T(s), a.d * T(s) } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator* (S const& s, dual<T> const& a) { return { T(s) * a.v, T(s) * a.d } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator/ (dual<T> const& a, S const& s) { T const inv = T(1.) / T(s) ; return { a.v * inv, a.d * inv } ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> operator/ (S const& s, dual<T> const& a) {
+    T const inv = T(1.) / a.v ; T const q = T(s) * inv ; 
+    return { q, -q * a.d * inv } ; 
+}
+
+/* Comparisons act on the values */
+
+template< typename T > KOKKOS_INLINE_FUNCTION auto operator<  (dual<T> const& a, dual<T> const& b) { return a.v <  b.v ; }
+template< typename T > KOKKOS_INLINE_FUNCTION auto operator<= (dual<T> const& a, dual<T> const& b) { return a.v <= b.v ; }
+template< typename T > KOKKOS_INLINE_FUNCTION auto operator>  (dual<T> const& a, dual<T> const& b) { return a.v >  b.v ; }
+template< typename T > KOKKOS_INLINE_FUNCTION auto operator>= (dual<T> const& a, dual<T> const& b) { return a.v >= b.v ; }
+template< typename T > KOKKOS_INLINE_FUNCTION auto operator== (dual<T> const& a, dual<T> const& b) { return a.v == b.v ; }
+template< typename T > KOKKOS_INLINE_FUNCTION auto operator!= (dual<T> const& a, dual<T> const& b) { return a.v != b.v ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator<  (dual<T> const& a, S const& s) { return a.v <  T(s) ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator<= (dual<T> const& a, S const& s) { return a.v <= T(s) ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator>  (dual<T> const& a, S const& s) { return a.v >  T(s) ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator>= (dual<T> const& a, S const& s) { return a.v >= T(s) ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator<  (S const& s, dual<T> const& a) { return T(s) <  a.v ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator<= (S const& s, dual<T> const& a) { return T(s) <= a.v ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator>  (S const& s, dual<T> const& a) { return T(s) >  a.v ; }
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION auto operator>= (S const& s, dual<T> const& a) { return T(s) >= a.v ; }
+
+/* 
+ * Math functions, f(x + dx eps) = f(x) + f'(x) dx eps. The functions
+ * of the value type are brought in with block scope using declarations,
+ * which hide the dual overloads below, SIMD types are found by ADL.
+ */
+
+#define SKL_DUAL_USING_MATH                                                   \
+    using Kokkos::exp   ; using Kokkos::expm1 ; using Kokkos::log   ;        \
+    using Kokkos::log1p ; using Kokkos::log10 ; using Kokkos::sqrt  ;        \
+    using Kokkos::cbrt  ; using Kokkos::sin   ; using Kokkos::cos   ;        \
+    using Kokkos::tan   ; using Kokkos::asin  ; using Kokkos::acos  ;        \
+    using Kokkos::atan  ; using Kokkos::sinh  ; using Kokkos::cosh  ;        \
+    using Kokkos::tanh  ; using Kokkos::asinh ; using Kokkos::acosh ;        \
+    using Kokkos::atanh ; using Kokkos::abs   ; using Kokkos::copysign ;     \
+    using Kokkos::erf   ; using Kokkos::pow   ; using Kokkos::atan2 ;        \
+    using Kokkos::hypot ; 
+
+#define SKL_DUAL_UNARY(name, value, derivative)                  \
+template< typename T >                                           \
+KOKKOS_INLINE_FUNCTION dual<T> name (dual<T> const& a) {         \
+    SKL_DUAL_USING_MATH                                          \
+    T const x = a.v ; T const f = value ;                        \
+    return { f, (derivative) * a.d } ;                           \
+}
+
+SKL_DUAL_UNARY(exp,   exp(x),   f)
+SKL_DUAL_UNARY(expm1, expm1(x), f + T(1.))
+SKL_DUAL_UNARY(log,   log(x),   T(1.) / x)
+SKL_DUAL_UNARY(log1p, log1p(x), T(1.) / (T(1.) + x))
+SKL_DUAL_UNARY(log10, log10(x), T(1.) / (x * T(M_LN10)))
+SKL_DUAL_UNARY(sqrt,  sqrt(x),  T(0.5) / f)
+SKL_DUAL_UNARY(cbrt,  cbrt(x),  T(1.) / (T(3.) * f * f))
+SKL_DUAL_UNARY(sin,   sin(x),   cos(x))
+SKL_DUAL_UNARY(cos,   cos(x),   -sin(x))
+SKL_DUAL_UNARY(tan,   tan(x),   T(1.) + f * f)
+SKL_DUAL_UNARY(asin,  asin(x),  T(1.) / sqrt(T(1.) - x * x))
+SKL_DUAL_UNARY(acos,  acos(x),  T(-1.) / sqrt(T(1.) - x * x))
+SKL_DUAL_UNARY(atan,  atan(x),  T(1.) / (T(1.) + x * x))
+SKL_DUAL_UNARY(sinh,  sinh(x),  cosh(x))
+SKL_DUAL_UNARY(cosh,  cosh(x),  sinh(x))
+SKL_DUAL_UNARY(tanh,  tanh(x),  T(1.) - f * f)
+SKL_DUAL_UNARY(asinh, asinh(x), T(1.) / sqrt(x * x + T(1.)))
+SKL_DUAL_UNARY(acosh, acosh(x), T(1.) / sqrt(x * x - T(1.)))
+SKL_DUAL_UNARY(atanh, atanh(x), T(1.) / (T(1.) - x * x))
+SKL_DUAL_UNARY(abs,   abs(x),   copysign(T(1.), x))
+SKL_DUAL_UNARY(fabs,  abs(x),   copysign(T(1.), x))
+SKL_DUAL_UNARY(erf,   erf(x),   T(M_2_SQRTPI) * exp(-x * x))
+
+#undef SKL_DUAL_UNARY
+
+template< typename T >
+KOKKOS_INLINE_FUNCTION dual<T> pow(dual<T> const& a, dual<T> const& b) {
+    SKL_DUAL_USING_MATH
+    T const f = pow(a.v, b.v) ; 
+    return { f, f * (b.d * log(a.v) + b.v * a.d / a.v) } ; 
+}
+
+// The value does not go through pow(x, s-1), which is infinite at x = 0 for s < 1
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> pow(dual<T> const& a, S const& s) {
+    SKL_DUAL_USING_MATH
+    T const f  = pow(a.v, T(s)) ; 
+    T const df = ( s == 0 or a.d == 0 ) ? T(0.) : T(s) * pow(a.v, T(s) - T(1.)) * a.d ; 
+    return { f, df } ; 
+}
+
+SKL_DUAL_SCALAR_T KOKKOS_INLINE_FUNCTION dual<T> pow(S const& s, dual<T> const& a) {
+    SKL_DUAL_USING_MATH
+    T const f = pow(T(s), a.v) ; 
+    return { f, f * T(Kokkos::log(s)) * a.d } ; 
+}
+
+template< typename T >
+KOKKOS_INLINE_FUNCTION dual<T> atan2(dual<T> const& y, dual<T> const& x) {
+    SKL_DUAL_USING_MATH
+    T const inv = T(1.) / (x.v * x.v + y.v * y.v) ; 
+    return { atan2(y.v, x.v), (x.v * y.d - y.v * x.d) * inv } ; 
+}
+
+template< typename T >
+KOKKOS_INLINE_FUNCTION dual<T> hypot(dual<T> const& a, dual<T> const& b) {
+    SKL_DUAL_USING_MATH
+    T const f = hypot(a.v, b.v) ; 
+    return { f, (a.v * a.d + b.v * b.d) / f } ; 
+}
+
+//! Scalar types only
+template< typename T >
+KOKKOS_INLINE_FUNCTION dual<T> min(dual<T> const& a, dual<T> const& b) { return a.v <= b.v ? a : b ; }
+template< typename T >
+KOKKOS_INLINE_FUNCTION dual<T> max(dual<T> const& a, dual<T> const& b) { return a.v >= b.v ? a : b ; }
+
+#undef SKL_DUAL_SCALAR_T
+#undef SKL_DUAL_USING_MATH
+
+/**
+ * @brief Values and directional derivatives of a point-wise function,
+ *        fu(i) = f(u(i)) and jv(i) = f'(u(i)) v(i), vectorized across 
+ *        grid points.
+ * 
+ * Chunks of simd_dual_t::size() points are loaded from the contiguous
+ * plain Views u and v into one simd_dual_t, so that f runs once per 
+ * chunk on SIMD registers, the remaining points go through 
+ * dual<SKL_REAL>. On backends without SIMD support the native width 
+ * is one and this is a plain loop over dual<SKL_REAL>. f may only use
+ * math functions which Kokkos provides for SIMD types.
+ * 
+ * @param f  Point-wise function, templated on the scalar type.
+ * @param u  Values of the state.
+ * @param v  Direction.
+ * @param fu Values of f (output).
+ * @param jv Directional derivative of f (output).
+ */
+template< typename func_t, typename u_t, typename v_t, typename fu_t, typename jv_t >
+void pointwise_jvp(func_t const& f, u_t const& u, v_t const& v, fu_t const& fu, jv_t const& jv) 
+{
+    using simd_t = typename simd_dual_t::value_type ; 
+    size_t const N = u.extent(0) ; 
+    size_t const W = simd_t::size() ; 
+    bool const contiguous = u.span_is_contiguous() and v.span_is_contiguous() 
+                        and fu.span_is_contiguous() and jv.span_is_contiguous() ; 
+    size_t const n_chunks = contiguous ? N / W : 0 ; 
+    if( n_chunks > 0 ) {
+        Kokkos::parallel_for("skl::pointwise_jvp_simd", n_chunks
+                            , KOKKOS_LAMBDA (int c) 
+            {
+                using tag_t = Kokkos::Experimental::element_aligned_tag ; 
+                simd_dual_t x ; 
+                x.v.copy_from(u.data() + c * W, tag_t()) ; 
+                x.d.copy_from(v.data() + c * W, tag_t()) ; 
+                simd_dual_t const y = f(x) ; 
+                y.v.copy_to(fu.data() + c * W, tag_t()) ; 
+                y.d.copy_to(jv.data() + c * W, tag_t()) ; 
+            }) ; 
+    }
+    Kokkos::parallel_for("skl::pointwise_jvp", Kokkos::RangePolicy<>(n_chunks * W, N)
+                        , KOKKOS_LAMBDA (int i) 
+        {
+            dual<SKL_REAL> const y = f(dual<SKL_REAL>(u(i), v(i))) ; 
+            fu(i) = y.v ; 
+            jv(i) = y.d ; 
+        }) ; 
+}
+
+}
+
+namespace Sacado {
+
+template< typename T >
+struct ScalarValue<skl::dual<T>> {
+    using type = typename ScalarValue<T>::type ; 
+    KOKKOS_INLINE_FUNCTION 
+    static type const& eval(skl::dual<T> const& x) { return ScalarValue<T>::eval(x.val()) ; }
+} ; 
+
+}
+
+#endif /* SKL_UTILS_DUAL_HH */
@@ -0,0 +1,94 @@
+/**
+ * @file execution.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Helpers for running independent solves concurrently.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_UTILS_EXECUTION_HH
+#define SKL_UTILS_EXECUTION_HH
+
+#include <SKL_config.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Split an execution space instance into n instances.
+ * \ingroup utils
+ *
+ * Thin wrapper around Kokkos::Experimental::partition_space with
+ * equal weights. On OpenMP each instance receives a disjoint subset
+ * of the threads, on device backends each instance gets its own
+ * stream. The returned instances can be passed to the utils::linalg
+ * wrappers and to the solve() overloads taking an execution space.
+ *
+ * @tparam exec_t Execution space type.
+ * @param n     Number of partitions.
+ * @param space Instance to split.
+ * @return std::vector<exec_t> The n partitions.
+ */
+template< typename exec_t = Kokkos::DefaultExecutionSpace >
+std::vector<exec_t> partition_space(size_t n, exec_t const& space = exec_t())
+{
+    return Kokkos::Experimental::partition_space(space, std::vector<int>(n, 1)) ;
+}
+
+/**
+ * @brief Run f(i, spaces[i]) for all partitions concurrently.
+ * \ingroup utils
+ *
+ * Every call but the first runs on its own host thread, so that
+ * host side work of the solvers (small least-squares problems,
+ * reductions into host scalars) overlaps as well. All instances are
+ * fenced before returning.
+ *
+ * @param spaces Execution space instances, e.g. from partition_space.
+ * @param f      Callable taking ( size_t, exec_t const& ).
+ */
+template< typename exec_t, typename F >
+void for_each_partition(std::vector<exec_t> const& spaces, F&& f)
+{
+    std::vector<std::thread> threads ;
+    threads.reserve(spaces.size()) ;
+    for( size_t i=1; i<spaces.size(); ++i) {
+        threads.emplace_back([&f, &spaces, i] () { f(i, spaces[i]) ; }) ;
+    }
+    if( not spaces.empty() ) {
+        f(size_t{0}, spaces[0]) ;
+    }
+    for( auto& t: threads ) {
+        t.join() ;
+    }
+    for( auto const& space: spaces ) {
+        space.fence("skl::for_each_partition") ;
+    }
+}
+
+}
+
+#endif /* SKL_UTILS_EXECUTION_HH */
@@ -28,7 +28,9 @@
 #ifndef SKL_UTILS_TYPES_HH
 #define SKL_UTILS_TYPES_HH
 
-#include <SKL_id_config.h>
+#include <SKL_config.h>
+
+#include <SKL/utils/dual.hh>
 
 #include <Sacado.hpp>
 #include <Kokkos_Core.hpp>
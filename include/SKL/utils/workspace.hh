@@ -0,0 +1,171 @@
+/**
+ * @file workspace.hh
+ * @author Carlo Musolino (musolino@itp.uni-frankfurt.de)
+ * @brief Arena allocator handing out unmanaged Views.
+ * @date 2026-10-19
+ *
+ * @copyright This file is part of the General Relativistic Astrophysics
+ * Code for Exascale.
+ * SKL is an evolution framework that uses Finite Volume
+ * methods to simulate relativistic spacetimes and plasmas
+ * Copyright (C) 2023 Carlo Musolino
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SKL_UTILS_WORKSPACE_HH
+#define SKL_UTILS_WORKSPACE_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/inline.h>
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <Sacado.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace skl {
+
+/**
+ * @brief Arena for temporary Views.
+ * \ingroup utils
+ * 
+ * One large buffer is allocated (without initialization) in the 
+ * given memory space and carved into unmanaged Views by bumping an 
+ * offset, so that handing out a temporary costs neither an allocation 
+ * nor a fill kernel. Views of Fad types are supported, the hidden 
+ * derivative dimension is passed as the last extent exactly as for 
+ * the Kokkos::View constructor. reset() releases everything at once,
+ * mark()/release() allow stack-like reuse within a solve.
+ * 
+ * Requests which do not fit are served from separate overflow 
+ * allocations, which stay alive until the next reset(). reset() then 
+ * grows the main buffer to the high-water mark, so that after a 
+ * warm-up solve the arena never allocates again.
+ * 
+ * Views obtained from the arena must not outlive the next reset() 
+ * or release() below their offset. Contents are uninitialized.
+ * Since release() does not wait for pending kernels, a workspace 
+ * should only be shared by work enqueued on one execution space 
+ * instance.
+ * 
+ * @tparam memory_space Memory space of the buffer.
+ */
+template< typename memory_space = Kokkos::DefaultExecutionSpace::memory_space >
+class workspace 
+{
+ public:
+    using buffer_t = Kokkos::View<char*, memory_space> ; 
+
+    template< typename view_t >
+    using unmanaged_view_t = Kokkos::View< typename view_t::data_type
+                                         , typename view_t::array_layout
+                                         , memory_space
+                                         , Kokkos::MemoryUnmanaged > ; 
+
+    static constexpr size_t alignment = 128 ; //!< Alignment of every View in bytes
+
+    workspace( size_t bytes = 0 ) 
+     : _offset(0), _high_water(0), _overflow_bytes(0)
+    {
+        grow(bytes) ; 
+    }
+
+    /**
+     * @brief Hand out an unmanaged View from the arena.
+     * 
+     * @tparam view_t View type to mimic (data type and layout).
+     * @param extents Extents, plus the derivative dimension for Fad types.
+     * @return An unmanaged View of the requested shape.
+     */
+    template< typename view_t, typename ... extents_t >
+    unmanaged_view_t<view_t> view(extents_t ... extents) {
+        using out_t = unmanaged_view_t<view_t> ; 
+        size_t const bytes = out_t::required_allocation_size(static_cast<size_t>(extents)...) ; 
+        char* ptr = allocate(bytes) ; 
+        return out_t(reinterpret_cast<typename out_t::pointer_type>(ptr), static_cast<size_t>(extents)...) ; 
+    }
+
+    /**
+     * @brief Current offset, to be passed to release().
+     */
+    size_t mark() const { return _offset ; }
+
+    /**
+     * @brief Release all Views handed out after mark m.
+     */
+    void release(size_t m) { _offset = std::min(m, _offset) ; }
+
+    /**
+     * @brief Release all Views and drop overflow allocations. 
+     * 
+     * If requests overflowed the buffer since the last reset, the 
+     * buffer is reallocated to hold the high-water mark.
+     */
+    void reset() {
+        _offset = 0 ; 
+        if( not _overflow.empty() ) {
+            _overflow.clear() ; 
+            _overflow_bytes = 0 ; 
+            grow(_high_water) ; 
+        }
+    }
+
+    size_t capacity()   const { return _buffer.extent(0) ; }
+    size_t used()       const { return _offset + _overflow_bytes ; }
+    size_t high_water() const { return _high_water ; }
+
+ private:
+
+    static constexpr size_t align(size_t bytes) {
+        return (bytes + alignment - 1) / alignment * alignment ; 
+    }
+
+    char* allocate(size_t bytes) {
+        bytes = align(bytes) ; 
+        _high_water = std::max(_high_water, used() + bytes) ; 
+        if( _offset + bytes <= capacity() ) {
+            char* ptr = _buffer.data() + _offset ; 
+            _offset += bytes ; 
+            return ptr ; 
+        }
+        _overflow.push_back(buffer_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "skl_workspace_overflow"), bytes)) ; 
+        _overflow_bytes += bytes ; 
+        return _overflow.back().data() ; 
+    }
+
+    void grow(size_t bytes) {
+        bytes = align(bytes) ; 
+        if( bytes > capacity() ) {
+            _buffer = buffer_t() ; 
+            _buffer = buffer_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "skl_workspace"), bytes) ; 
+        }
+    }
+
+    buffer_t _buffer                ; //!< Main buffer
+    std::vector<buffer_t> _overflow ; //!< Allocations which did not fit
+    size_t _offset         ; //!< First free byte in the main buffer
+    size_t _high_water     ; //!< Largest number of bytes in use at once
+    size_t _overflow_bytes ; //!< Bytes held in overflow allocations
+} ; 
+
+}
+
+#endif /* SKL_UTILS_WORKSPACE_HH */
@@ -0,0 +1,60 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/chebyshev_fixed.hh>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+
+template< typename kernel_t >
+double time_kernel(kernel_t const& kernel, int n_rep)
+{
+    kernel() ; // warm up
+    Kokkos::fence() ;
+    Kokkos::Timer timer ;
+    for( int r=0; r<n_rep; ++r) kernel() ;
+    Kokkos::fence() ;
+    return timer.seconds() / n_rep ;
+}
+
+/* Logical derivative of one line and of a batch of lines, matrix based against fixed order */
+template< size_t N >
+void bench_order(int n_rep)
+{
+    using namespace skl ;
+    using view_t  = Kokkos::View<SKL_REAL*,  Kokkos::DefaultExecutionSpace> ;
+    using lines_t = Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> ;
+    chebyshev_collocation cheb(N) ;
+    auto x = cheb.points() ;
+
+    view_t u("u", N), du("du", N) ;
+    Kokkos::deep_copy(u, x) ;
+    double const t_dyn   = time_kernel([&] () { cheb.derivative(u, du) ; }, n_rep) ;
+    double const t_fixed = time_kernel([&] () { chebyshev_fixed<N>::derivative(u, du) ; }, n_rep) ;
+    std::printf("%6zu %10s %14.2f %14.2f %10.2f\n", N, "1", 1e6*t_dyn, 1e6*t_fixed, t_dyn/t_fixed) ;
+
+    for( size_t n_lines : {1<<8, 1<<12, 1<<16} ) {
+        lines_t v("v", n_lines, N), dv("dv", n_lines, N) ;
+        Kokkos::parallel_for("fill", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{n_lines,N})
+            , KOKKOS_LAMBDA(int l, int i) { v(l,i) = Kokkos::sin((1. + 1e-3 * l) * x(i)) ; }) ;
+        double const t_dyn_b   = time_kernel([&] () { cheb.batched_derivative(v, dv, 1, 1) ; }, n_rep) ;
+        double const t_fixed_b = time_kernel([&] () { chebyshev_fixed<N>::derivative(v, dv) ; }, n_rep) ;
+        std::printf("%6zu %10zu %14.2f %14.2f %10.2f\n", N, n_lines, 1e6*t_dyn_b, 1e6*t_fixed_b, t_dyn_b/t_fixed_b) ;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Kokkos::initialize(argc, argv) ;
+    {
+        constexpr int n_rep = 100 ;
+        std::printf("Chebyshev derivative, matrix based against fixed order kernels\n") ;
+        std::printf("%6s %10s %14s %14s %10s\n", "N", "lines", "dynamic [us]", "fixed [us]", "speedup") ;
+        bench_order<8>(n_rep)  ;
+        bench_order<16>(n_rep) ;
+        bench_order<32>(n_rep) ;
+    }
+    Kokkos::finalize() ;
+    return 0 ;
+}
@@ -0,0 +1,96 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/dual.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/solvers/linearized_operator.hh>
+
+#include <Sacado.hpp>
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+
+#include <cstdio>
+
+/* Point-wise nonlinearity, typical of source terms */
+struct source {
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (T const& u) const {
+        using Kokkos::exp ; using Kokkos::sqrt ; using Kokkos::sin ;
+        return exp(-u * u) * sin(3. * u) + sqrt(1. + u * u) - u / (2. + u * u) ;
+    }
+} ;
+
+template< typename kernel_t >
+double time_kernel(kernel_t const& kernel, int n_rep)
+{
+    kernel() ; // warm up
+    Kokkos::fence() ;
+    Kokkos::Timer timer ;
+    for( int r=0; r<n_rep; ++r) kernel() ;
+    Kokkos::fence() ;
+    return timer.seconds() / n_rep ;
+}
+
+int main(int argc, char* argv[]) {
+    using namespace skl ;
+    using view_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ;
+    using dual_view_t = Kokkos::View<dual<SKL_REAL>*, Kokkos::DefaultExecutionSpace> ;
+    Kokkos::initialize(argc, argv) ;
+    {
+        constexpr int n_rep = 100 ;
+        source const f ;
+
+        std::printf("Point-wise JVP, simd width %zu\n", simd_dual_t::value_type::size()) ;
+        std::printf("%10s %14s %14s %14s %10s %10s\n", "N", "sfad<1> [us]", "dual [us]", "simd [us]", "dual", "simd") ;
+        for( size_t N : {1<<12, 1<<16, 1<<20} ) {
+            view_t u("u", N), v("v", N), fu("fu", N), jv("jv", N) ;
+            Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+                u(i) = Kokkos::sin(0.001 * i) ;
+                v(i) = Kokkos::cos(0.001 * i) ;
+            }) ;
+            double const t_sfad = time_kernel([&] () {
+                Kokkos::parallel_for("jvp_sfad", N, KOKKOS_LAMBDA(int i) {
+                    sfad_t<1> x(1, 0, u(i)) ; x.fastAccessDx(0) = v(i) ;
+                    sfad_t<1> const y = f(x) ;
+                    fu(i) = y.val() ; jv(i) = y.dx(0) ;
+                }) ;
+            }, n_rep) ;
+            double const t_dual = time_kernel([&] () {
+                Kokkos::parallel_for("jvp_dual", N, KOKKOS_LAMBDA(int i) {
+                    dual<SKL_REAL> const y = f(dual<SKL_REAL>(u(i), v(i))) ;
+                    fu(i) = y.val() ; jv(i) = y.dx() ;
+                }) ;
+            }, n_rep) ;
+            double const t_simd = time_kernel([&] () { pointwise_jvp(f, u, v, fu, jv) ; }, n_rep) ;
+            std::printf( "%10zu %14.1f %14.1f %14.1f %10.2f %10.2f\n", N, 1e6*t_sfad, 1e6*t_dual, 1e6*t_simd
+                       , t_sfad/t_dual, t_sfad/t_simd ) ;
+        }
+
+        std::printf("\nBratu residual JVP through compute_residual\n") ;
+        std::printf("%10s %14s %14s %10s\n", "N", "sfad<1> [us]", "dual [us]", "speedup") ;
+        using grid_t = mapped_grid<linear_coordinate_mapping> ;
+        for( size_t N : {32, 64, 128, 256, 512} ) {
+            chebyshev_collocation cheb(N) ;
+            linear_coordinate_mapping map {1., 0.} ;
+            grid_t grid(map, cheb.points()) ;
+            linearized_residual<bratu, chebyshev_collocation, grid_t> res(bratu{int(N), 1.}, cheb, grid) ;
+            auto x = grid.physical() ;
+            sfad_view_t<1> us("us", N, 2), rs("rs", N, 2) ;
+            dual_view_t ud("ud", N), rd("rd", N) ;
+            Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+                SKL_REAL const u0 = 0.3 * (1. - x(i) * x(i)), v0 = Kokkos::sin(3. * x(i)) ;
+                us(i) = sfad_t<1>(1, 0, u0) ; us(i).fastAccessDx(0) = v0 ;
+                ud(i) = dual<SKL_REAL>(u0, v0) ;
+            }) ;
+            double const t_sfad = time_kernel([&] () { res.compute_residual(us, rs) ; }, n_rep) ;
+            double const t_dual = time_kernel([&] () { res.compute_residual(ud, rd) ; }, n_rep) ;
+            std::printf("%10zu %14.1f %14.1f %10.2f\n", N, 1e6*t_sfad, 1e6*t_dual, t_sfad/t_dual) ;
+        }
+    }
+    Kokkos::finalize() ;
+    return 0 ;
+}
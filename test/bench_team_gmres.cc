@@ -0,0 +1,72 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/team_gmres.hh>
+#include <SKL/solvers/linearized_operator.hh>
+
+#include <Sacado.hpp>
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+
+/* Linear problem u'' + lambda u = 1, u(-1) = u(1) = 0, one Newton step per solve */
+struct helmholtz {
+    int N ;
+    SKL_REAL lambda ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return u ;
+        return uxx + lambda * u - 1. ;
+    }
+} ;
+
+template< typename solver_t, typename res_t >
+double time_solves(solver_t& solver, res_t& res, size_t N, int n_solves, size_t& iters)
+{
+    using namespace skl ;
+    sfad_view_t<1> u("u", N, 2) ;
+    solver.solve(res, u) ; // warm up
+    Kokkos::fence() ;
+    Kokkos::Timer timer ;
+    iters = 0 ;
+    for( int s=0; s<n_solves; ++s) {
+        Kokkos::deep_copy(u, skl::sfad_t<1>(0.)) ;
+        iters += solver.solve(res, u) ;
+    }
+    Kokkos::fence() ;
+    return timer.seconds() / n_solves ;
+}
+
+int main(int argc, char* argv[]) {
+    using namespace skl ;
+    Kokkos::initialize(argc, argv) ;
+    {
+        using grid_t = mapped_grid<linear_coordinate_mapping> ;
+        constexpr int n_solves = 50 ;
+        constexpr size_t m = 30 ;
+        std::printf("%6s %14s %14s %10s %8s\n", "N", "gmres [us]", "team [us]", "speedup", "iters") ;
+        for( size_t N : {16, 32, 64, 128, 256, 512} ) {
+            chebyshev_collocation cheb(N) ;
+            linear_coordinate_mapping map {1., 0.} ;
+            grid_t grid(map, cheb.points()) ;
+            linearized_residual<helmholtz, chebyshev_collocation, grid_t> res(helmholtz{int(N), 1.}, cheb, grid) ;
+
+            gmres multi(N, m, 1e-10, 20) ;
+            team_gmres single(N, m, 1e-10, 20) ;
+            size_t it_multi, it_single ;
+            double const t_multi  = time_solves(multi,  res, N, n_solves, it_multi) ;
+            double const t_single = time_solves(single, res, N, n_solves, it_single) ;
+            std::printf( "%6zu %14.1f %14.1f %10.2f %4zu/%-4zu%s\n", N, 1e6*t_multi, 1e6*t_single
+                       , t_multi/t_single, it_multi/n_solves, it_single/n_solves
+                       , team_gmres::fits_level0(N, m) ? "" : " (level 1 scratch)" ) ;
+        }
+    }
+    Kokkos::finalize() ;
+    return 0 ;
+}
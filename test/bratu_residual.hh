@@ -0,0 +1,24 @@
+#ifndef SKL_TEST_BRATU_RESIDUAL_HH
+#define SKL_TEST_BRATU_RESIDUAL_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+
+#include <Kokkos_Core.hpp>
+
+/* Bratu problem u'' + lambda exp(u) = 0, u(-1) = u(1) = 0 */
+struct bratu {
+    int N ;
+    SKL_REAL lambda ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        using Kokkos::exp ;
+        if( i == 0 or i == N-1 ) return u ;
+        return uxx + lambda * exp(u) ;
+    }
+} ;
+
+#endif /* SKL_TEST_BRATU_RESIDUAL_HH */
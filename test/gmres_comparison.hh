@@ -0,0 +1,51 @@
+#ifndef SKL_TEST_GMRES_COMPARISON_HH
+#define SKL_TEST_GMRES_COMPARISON_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/gmres.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <utility>
+#include <vector>
+
+/*
+ * Runs n_newton Newton steps from zero with the solver under test and
+ * with the reference gmres side by side. Per step the iteration counts
+ * agree within one, at the end the residual is converged and the values
+ * agree within tol. Returns the solution and the per step iteration
+ * counts of the solver under test.
+ */
+template< typename solver_t, typename res_t >
+std::pair<skl::sfad_view_t<1>, std::vector<size_t>>
+newton_against_gmres( solver_t& solver, skl::gmres& solver_ref, res_t& res, size_t N
+                    , int n_newton = 8, SKL_REAL tol = 1e-10 )
+{
+    using namespace skl ;
+    sfad_view_t<1> u("u", N, 2), u_ref("u_ref", N, 2), r("r", N, 2) ;
+    std::vector<size_t> iterations ;
+    for( int it=0; it<n_newton; ++it) {
+        size_t const n     = solver.solve(res, u) ;
+        size_t const n_ref = solver_ref.solve(res, u_ref) ;
+        CHECK( n <= n_ref + 1 ) ;
+        CHECK( n_ref <= n + 1 ) ;
+        iterations.push_back(n) ;
+    }
+    res.compute_residual(u, r) ;
+    CHECK( utils::linalg::nrm2(r) < 1e-9 ) ;
+
+    auto h_u     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u) ;
+    auto h_u_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u_ref) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i).val(), Catch::Matchers::WithinAbs(h_u_ref(i).val(), tol) ) ;
+    }
+    return { u, iterations } ;
+}
+
+#endif /* SKL_TEST_GMRES_COMPARISON_HH */
@@ -0,0 +1,22 @@
+#ifndef SKL_TEST_LINEAR_PATCHES_HH
+#define SKL_TEST_LINEAR_PATCHES_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+
+#include <vector>
+
+//! Patches [x_p, x_{p+1}] mapped linearly onto [-1,1]
+inline std::vector<skl::linear_coordinate_mapping> linear_patches(std::vector<SKL_REAL> const& x)
+{
+    std::vector<skl::linear_coordinate_mapping> maps ;
+    for( size_t p=0; p+1<x.size(); ++p) {
+        SKL_REAL const L = x[p+1] - x[p] ;
+        maps.emplace_back(2. / L, -(x[p+1] + x[p]) / L) ;
+    }
+    return maps ;
+}
+
+#endif /* SKL_TEST_LINEAR_PATCHES_HH */
@@ -0,0 +1,17 @@
+#include <mpi.h>
+#include <Kokkos_Core.hpp>
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch_session.hpp>
+
+int main(int argc, char* argv[])
+{
+    MPI_Init(&argc, &argv) ; 
+    Kokkos::initialize(argc, argv);
+    int result = Catch::Session().run( argc, argv );
+    Kokkos::finalize() ; 
+    // Fail on every rank if any rank failed
+    int global_result { 0 } ; 
+    MPI_Allreduce(&result, &global_result, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD) ; 
+    MPI_Finalize() ; 
+    return global_result ;
+}
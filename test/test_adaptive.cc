@@ -0,0 +1,129 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/spectral/chop.hh>
+#include <SKL/solvers/adaptive.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+
+#include <cmath>
+#include <vector>
+
+/* u'' = 2, u(-1) = u(1) = 0, solved by u = x^2 - 1 */
+struct parabola {
+    int N ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return u ;
+        return uxx - 2. ;
+    }
+} ;
+
+/* Lower branch of the Bratu problem, in closed form */
+static SKL_REAL bratu_exact(SKL_REAL x, SKL_REAL lambda) 
+{
+    // On s = (x+1)/2 in [0,1] the problem reads u_ss + 4 lambda exp(u) = 0
+    SKL_REAL theta { 1. } ; 
+    for( int it=0; it<100; ++it) theta = std::sqrt(8. * lambda) * std::cosh(theta / 4.) ; 
+    SKL_REAL const s = 0.5 * (x + 1.) ; 
+    return -2. * std::log( std::cosh((s - 0.5) * theta / 2.) / std::cosh(theta / 4.) ) ; 
+}
+
+TEST_CASE("chop detects plateaus", "[spectral]")
+{
+    using namespace skl ; 
+    std::vector<SKL_REAL> resolved(100), unresolved(60), short_series(12) ; 
+    for( size_t k=0; k<resolved.size(); ++k) resolved[k] = std::pow(0.5, k) + 1e-17 * std::sin(7. * k) ; 
+    for( size_t k=0; k<unresolved.size(); ++k) unresolved[k] = std::pow(0.9, k) ; 
+    for( size_t k=0; k<short_series.size(); ++k) short_series[k] = std::pow(0.1, k) ; 
+
+    size_t const cutoff = chop(resolved, 1e-12) ; 
+    CHECK( cutoff > 40 ) ; 
+    CHECK( cutoff < 50 ) ; 
+    CHECK( chop(resolved, 1e-6) < cutoff ) ; 
+    CHECK( chop(unresolved, 1e-12) == unresolved.size() ) ; 
+    CHECK( chop(short_series, 1e-12) == short_series.size() ) ; 
+}
+
+TEST_CASE("adaptive solver grows to the required order", "[solvers][spectral]")
+{
+    using namespace skl ; 
+    SKL_REAL const lambda = 0.5 ; 
+    linear_coordinate_mapping map {1., 0.} ; 
+    auto make_pde = [=] (size_t n) { return bratu{static_cast<int>(n), lambda} ; } ; 
+
+    adaptive_solver<bratu, linear_coordinate_mapping> solver(map, make_pde, 9, 1e-12) ; 
+    size_t const N = solver.solve() ; 
+    CHECK( solver.resolved() ) ; 
+    CHECK( solver.history().front() == 9 ) ; 
+    CHECK( solver.history().size() > 1 ) ; 
+    CHECK( N <= 65 ) ; 
+    CHECK( solver.cutoff() < N ) ; 
+
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.solution()) ; 
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.points()) ; 
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i), Catch::Matchers::WithinAbs(bratu_exact(h_x(i), lambda), 1e-10) ) ; 
+    }
+
+    // A second solve starts resolved and does not change the size
+    size_t const steps = solver.newton_steps() ; 
+    CHECK( solver.solve() == N ) ; 
+    CHECK( solver.history().size() == 1 ) ; 
+    CHECK( solver.newton_steps() <= steps + 1 ) ; 
+}
+
+TEST_CASE("adaptive solver shrinks an oversized discretization", "[solvers][spectral]")
+{
+    using namespace skl ; 
+    SKL_REAL const lambda = 0.5 ; 
+    linear_coordinate_mapping map {1., 0.} ; 
+    auto make_pde = [=] (size_t n) { return bratu{static_cast<int>(n), lambda} ; } ; 
+
+    adaptive_solver<bratu, linear_coordinate_mapping> solver(map, make_pde, 17, 1e-12) ; 
+    Kokkos::View<SKL_REAL*> u0("u0", 129) ; 
+    solver.set_state(u0) ; 
+    size_t const N = solver.solve() ; 
+    CHECK( solver.resolved() ) ; 
+    CHECK( solver.history().front() == 129 ) ; 
+    CHECK( N < 129 ) ; 
+
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.solution()) ; 
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.points()) ; 
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i), Catch::Matchers::WithinAbs(bratu_exact(h_x(i), lambda), 1e-10) ) ; 
+    }
+}
+
+TEST_CASE("adaptive solver does not shrink below the size chop can resolve", "[solvers][spectral]")
+{
+    using namespace skl ; 
+    linear_coordinate_mapping map {1., 0.} ; 
+    auto make_pde = [] (size_t n) { return parabola{static_cast<int>(n)} ; } ; 
+
+    adaptive_solver<parabola, linear_coordinate_mapping> solver(map, make_pde, 33, 1e-12) ; 
+    size_t const N = solver.solve() ; 
+    CHECK( solver.resolved() ) ; 
+    CHECK( solver.cutoff() < 8 ) ; 
+    // A single re-solve at the smallest size chop can still declare resolved
+    REQUIRE( solver.history().size() == 2 ) ; 
+    CHECK( solver.history()[0] == 33 ) ; 
+    CHECK( solver.history()[1] == chop_min_size ) ; 
+    CHECK( N == chop_min_size ) ; 
+
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.solution()) ; 
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.points()) ; 
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i), Catch::Matchers::WithinAbs(h_x(i) * h_x(i) - 1., 1e-12) ) ; 
+    }
+}
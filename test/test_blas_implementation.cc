@@ -23,7 +23,7 @@ int main() {
     {
         Kokkos::View<sfad_t<n_der>*, Kokkos::DefaultExecutionSpace>
             a_fad("A_fad", m, n_der+1), b_fad("B_fad", m, n_der+1) ;
-        Kokkos::View<GRACE_REAL*, Kokkos::DefaultExecutionSpace> 
+        Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> 
             a("A", m), b("B", m) ; 
 
         Kokkos::parallel_for("fill", m, 
@@ -69,7 +69,7 @@ int main() {
         sfad_t<n_der> alpha_fad{2.} ; 
         Kokkos::View<sfad_t<n_der>*, Kokkos::DefaultExecutionSpace>
             y_fad("Y_fad", m, n_der+1) ; 
-        Kokkos::View<GRACE_REAL*, Kokkos::DefaultExecutionSpace> 
+        Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> 
             y("Y", m) ; 
         
         // First: try all fad 
@@ -217,9 +217,9 @@ int main() {
             A_fad("fad_trsm_A", m_mat, m_mat, n_der+1), B_fad("fad_trsm_B", m_mat,1, n_der+1) ; 
         Kokkos::View<sfad_t<n_der>*, Kokkos::DefaultExecutionSpace>
             B_oned_fad("fad_trsm_B_oned", m_mat, n_der+1) ; 
-        Kokkos::View<GRACE_REAL**, Kokkos::DefaultExecutionSpace> 
+        Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> 
             A("trsm_A", m_mat,m_mat), B("trsm_B", m_mat,m_mat) ; 
-        Kokkos::View<GRACE_REAL*, Kokkos::DefaultExecutionSpace> 
+        Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> 
             B_oned("trsm_B_oned", m_mat) ; 
 
         auto h_B_fad = Kokkos::create_mirror_view(B_fad) ;
@@ -315,6 +315,116 @@ int main() {
                 Catch::Matchers::WithinAbs(0, 1e-10 ) ) ;
         }
 
+        // Device resident reduction results
+        {
+            auto space = Kokkos::DefaultExecutionSpace() ; 
+            Kokkos::View<SKL_REAL, Kokkos::DefaultExecutionSpace> nrm("nrm"), prod("prod"), nrm_plain("nrm_plain") ; 
+            utils::linalg::nrm2(space, a_fad, nrm) ; 
+            utils::linalg::nrm2(space, a, nrm_plain) ; 
+            utils::linalg::dot(space, a_fad, b, prod) ; 
+            // y = a / ||a|| - (a.b) a / 20 
+            Kokkos::View<sfad_t<n_der>*, Kokkos::DefaultExecutionSpace> z_fad("Z_fad", m, n_der+1) ; 
+            utils::linalg::rscal(space, z_fad, nrm, a_fad) ; 
+            utils::linalg::axpy(space, -1./20., prod, a_fad, z_fad) ; 
+            auto h_nrm  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nrm) ; 
+            auto h_nrm_plain = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nrm_plain) ; 
+            auto h_prod = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), prod) ; 
+            auto h_z    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), z_fad) ; 
+            CHECK_THAT( h_nrm(), Catch::Matchers::WithinAbs(Kokkos::sqrt(10.), 1e-10 ) ) ; 
+            CHECK_THAT( h_nrm_plain(), Catch::Matchers::WithinAbs(Kokkos::sqrt(10.), 1e-10 ) ) ; 
+            CHECK_THAT( h_prod(), Catch::Matchers::WithinAbs(20., 1e-10 ) ) ; 
+            for( int i=0; i<m; ++i) {
+                CHECK_THAT( h_z(i).val(), Catch::Matchers::WithinAbs(1./Kokkos::sqrt(10.) - 1., 1e-10 ) ) ; 
+            }
+            // alpha read from a rank 0 View in scal
+            utils::linalg::scal(space, y, prod, a) ; 
+            auto h_y0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y) ; 
+            for( int i=0; i<m; ++i) {
+                CHECK_THAT( h_y0(i), Catch::Matchers::WithinAbs(20., 1e-10 ) ) ; 
+            }
+        }
+
+        // Fused reductions
+        {
+            auto [ab_f, aa_f, bb_f] = utils::linalg::dots({a, b, a, a, b, b}) ;
+            CHECK_THAT( ab_f, Catch::Matchers::WithinAbs(20., 1e-10 ) ) ;
+            CHECK_THAT( aa_f, Catch::Matchers::WithinAbs(10., 1e-10 ) ) ;
+            CHECK_THAT( bb_f, Catch::Matchers::WithinAbs(40., 1e-10 ) ) ;
+            auto [ab_fad_f] = utils::linalg::dots(Kokkos::DefaultExecutionSpace(), {a_fad, b_fad}) ;
+            CHECK_THAT( ab_fad_f, Catch::Matchers::WithinAbs(20., 1e-10 ) ) ;
+        }
+
+        // Longer vectors, remainders of the SIMD blocks and strided values
+        {
+            constexpr size_t n = 4099 ; 
+            Kokkos::View<sfad_t<n_der>*, Kokkos::DefaultExecutionSpace> x_fad("X_fad", n, n_der+1) ; 
+            Kokkos::View<dual<SKL_REAL>*, Kokkos::DefaultExecutionSpace> x_dual("X_dual", n) ; 
+            Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> x("X", n), y("Y", n) ; 
+            Kokkos::View<SKL_REAL**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace> xy("XY", n, 3) ; 
+            Kokkos::parallel_for("fill", n, 
+                KOKKOS_LAMBDA( int i) 
+            {
+                x(i)      = Kokkos::sin(0.01 * i) ; 
+                y(i)      = Kokkos::cos(0.03 * i) ; 
+                x_fad(i)  = sfad_t<n_der>(n_der, 0, x(i)) ; 
+                x_dual(i) = dual<SKL_REAL>(x(i), 1.) ; 
+                xy(i,0)   = x(i) ; 
+                xy(i,2)   = y(i) ; 
+            })  ; 
+            auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ; 
+            auto h_y = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y) ; 
+            SKL_REAL xx { 0. }, xy_ref { 0. } ; 
+            for( size_t i=0; i<n; ++i) {
+                xx     += h_x(i) * h_x(i) ; 
+                xy_ref += h_x(i) * h_y(i) ; 
+            }
+            auto x_col = Kokkos::subview(xy, Kokkos::ALL(), 0) ; 
+            auto y_col = Kokkos::subview(xy, Kokkos::ALL(), 2) ; 
+            CHECK_THAT( utils::linalg::nrm2(x),      Catch::Matchers::WithinAbs(Kokkos::sqrt(xx), 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::nrm2(x_fad),  Catch::Matchers::WithinAbs(Kokkos::sqrt(xx), 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::nrm2(x_dual), Catch::Matchers::WithinAbs(Kokkos::sqrt(xx), 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::nrm2(x_col),  Catch::Matchers::WithinAbs(Kokkos::sqrt(xx), 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::dot(x, y),          Catch::Matchers::WithinAbs(xy_ref, 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::dot(x_fad, y),      Catch::Matchers::WithinAbs(xy_ref, 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::dot(x_dual, x_fad), Catch::Matchers::WithinAbs(xx, 1e-10 ) ) ; 
+            CHECK_THAT( utils::linalg::dot(x_col, y_col),  Catch::Matchers::WithinAbs(xy_ref, 1e-10 ) ) ; 
+            auto space = Kokkos::DefaultExecutionSpace() ; 
+            Kokkos::View<SKL_REAL, Kokkos::DefaultExecutionSpace> nrm("nrm"), prod("prod") ; 
+            utils::linalg::nrm2(space, x_fad, nrm) ; 
+            utils::linalg::dot(space, x_fad, y_col, prod) ; 
+            auto h_nrm  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nrm) ; 
+            auto h_prod = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), prod) ; 
+            CHECK_THAT( h_nrm(),  Catch::Matchers::WithinAbs(Kokkos::sqrt(xx), 1e-10 ) ) ; 
+            CHECK_THAT( h_prod(), Catch::Matchers::WithinAbs(xy_ref, 1e-10 ) ) ; 
+        }
+
+        // Vector updates on dual Views keep the derivatives
+        {
+            constexpr size_t n = 100 ; 
+            auto space = Kokkos::DefaultExecutionSpace() ; 
+            Kokkos::View<dual<SKL_REAL>*, Kokkos::DefaultExecutionSpace> u("U", n), w("W", n) ; 
+            Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> p("P", n) ; 
+            Kokkos::View<SKL_REAL, Kokkos::DefaultExecutionSpace> two("two") ; 
+            Kokkos::deep_copy(two, 2.) ; 
+            Kokkos::parallel_for("fill", n, 
+                KOKKOS_LAMBDA( int i) 
+            {
+                u(i) = dual<SKL_REAL>(1. + i, 0.5 * i) ; 
+                w(i) = dual<SKL_REAL>(SKL_REAL(i), 1.) ; 
+                p(i) = i ; 
+            })  ; 
+            utils::linalg::scal(w, SKL_REAL{3.}, u) ;      // w = 3 u
+            utils::linalg::axpy(SKL_REAL{-1.}, u, w) ;     // w = 2 u
+            utils::linalg::axpy(space, two, u, w) ;         // w = 4 u
+            utils::linalg::rscal(space, w, two, w) ;        // w = 2 u
+            utils::linalg::axpy(SKL_REAL{1.}, p, w) ;      // w = 2 u + p
+            auto h_w = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w) ; 
+            for( size_t i=0; i<n; ++i) {
+                CHECK_THAT( h_w(i).val(), Catch::Matchers::WithinAbs(2. * (1. + i) + i, 1e-12 ) ) ; 
+                CHECK_THAT( h_w(i).dx(0), Catch::Matchers::WithinAbs(SKL_REAL(i), 1e-12 ) ) ; 
+            }
+        }
+
     }
     Kokkos::finalize() ; 
 
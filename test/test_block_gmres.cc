@@ -0,0 +1,167 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/block_gmres.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+/* J = tridiag(-1, 2 + sigma, -1), applied to a whole block at once */
+struct block_laplacian {
+    size_t N ;
+    SKL_REAL sigma ;
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) {
+        size_t const n = N ; SKL_REAL const s = sigma ;
+        Kokkos::parallel_for("jvp", n, KOKKOS_LAMBDA(int i)
+        {
+            SKL_REAL val = (2. + s) * v(i).val() ;
+            if( i > 0   ) val -= v(i-1).val() ;
+            if( i < n-1 ) val -= v(i+1).val() ;
+            Jv(i) = val ;
+        }) ;
+    }
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void block_jvp(x_t const& x, v_t const& V, jv_t const& JV) {
+        size_t const n = N ; SKL_REAL const s = sigma ;
+        Kokkos::parallel_for("block_jvp", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0UL,0UL},{n,V.extent(1)})
+                            , KOKKOS_LAMBDA(int i, int l)
+        {
+            SKL_REAL val = (2. + s) * V(i,l).val() ;
+            if( i > 0   ) val -= V(i-1,l).val() ;
+            if( i < n-1 ) val -= V(i+1,l).val() ;
+            JV(i,l) = val ;
+        }) ;
+    }
+} ;
+
+TEST_CASE("block gmres solves several right hand sides", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 100 ;
+    constexpr size_t s = 3   ;
+
+    block_laplacian res{N, 1e-2} ;
+    block_gmres solver(N, s, 40, 1e-10, 20) ;
+
+    sfad_view_t<1> x("x", N, 2) ;
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> B("B", N, s) ;
+    Kokkos::View<sfad_t<1>**, Kokkos::DefaultExecutionSpace> X("X", N, s, 2), JX("JX", N, s, 2) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i)
+    {
+        B(i,0) = 1. ;
+        B(i,1) = Kokkos::sin(0.1 * i) ;
+        B(i,2) = (i % 7) - 3. ;
+    }) ;
+
+    solver.solve(res, x, B, X) ;
+
+    res.block_jvp(x, X, JX) ;
+    auto h_B  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B) ;
+    auto h_JX = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), JX) ;
+    for( size_t i=0; i<N; ++i) for( size_t l=0; l<s; ++l) {
+        CHECK_THAT( h_JX(i,l).val(), Catch::Matchers::WithinAbs(h_B(i,l), 1e-7) ) ;
+    }
+}
+
+TEST_CASE("block gmres with a rank deficient block of right hand sides", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 100 ;
+    constexpr size_t s = 3   ;
+
+    block_laplacian res{N, 1e-2} ;
+    block_gmres solver(N, s, 40, 1e-10, 20) ;
+
+    // A zero right hand side and a repeated one
+    sfad_view_t<1> x("x", N, 2) ;
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> B("B", N, s) ;
+    Kokkos::View<sfad_t<1>**, Kokkos::DefaultExecutionSpace> X("X", N, s, 2), JX("JX", N, s, 2) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i)
+    {
+        B(i,0) = Kokkos::sin(0.1 * i) ;
+        B(i,1) = 0. ;
+        B(i,2) = Kokkos::sin(0.1 * i) ;
+    }) ;
+
+    size_t const iterations = solver.solve(res, x, B, X) ;
+    CHECK( iterations > 0 ) ;
+
+    res.block_jvp(x, X, JX) ;
+    auto h_B  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B) ;
+    auto h_X  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), X) ;
+    auto h_JX = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), JX) ;
+    for( size_t i=0; i<N; ++i) {
+        for( size_t l=0; l<s; ++l) {
+            CHECK_THAT( h_JX(i,l).val(), Catch::Matchers::WithinAbs(h_B(i,l), 1e-7) ) ;
+        }
+        CHECK( h_X(i,1).val() == 0. ) ;
+        CHECK_THAT( h_X(i,2).val(), Catch::Matchers::WithinAbs(h_X(i,0).val(), 1e-7) ) ;
+    }
+}
+
+TEST_CASE("block gmres with nearly dependent right hand sides", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 100 ;
+    constexpr size_t s = 2   ;
+    SKL_REAL const sigma = 1e-2 ;
+    block_laplacian res{N, sigma} ;
+
+    auto check = [&] (auto const& B) {
+        block_gmres solver(N, s, 40, 1e-10, 20) ;
+        sfad_view_t<1> x("x", N, 2) ;
+        Kokkos::View<sfad_t<1>**, Kokkos::DefaultExecutionSpace> X("X", N, s, 2), JX("JX", N, s, 2) ;
+        CHECK( solver.solve(res, x, B, X) > 0 ) ;
+        res.block_jvp(x, X, JX) ;
+        auto h_B  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B) ;
+        auto h_X  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), X) ;
+        auto h_JX = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), JX) ;
+        for( size_t i=0; i<N; ++i) {
+            for( size_t l=0; l<s; ++l) {
+                REQUIRE( Kokkos::isfinite(h_X(i,l).val()) ) ;
+                CHECK_THAT( h_JX(i,l).val(), Catch::Matchers::WithinAbs(h_B(i,l), 1e-7) ) ;
+            }
+        }
+    } ;
+
+    // Identical columns, the second Cholesky pivot is round-off
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> B("B", N, s) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i)
+    {
+        B(i,0) = Kokkos::sin(0.1 * i) ;
+        B(i,1) = Kokkos::sin(0.1 * i) ;
+    }) ;
+    check(B) ;
+
+    // B = [b, J^2 b]: the block Krylov space closes after two blocks, 
+    // the cycle breaks down in the middle
+    auto h_B = Kokkos::create_mirror_view(B) ;
+    std::vector<SKL_REAL> b(N), Jb(N) ;
+    for( size_t i=0; i<N; ++i) b[i] = Kokkos::sin(0.1 * i) ;
+    auto apply = [&] (std::vector<SKL_REAL> const& v, std::vector<SKL_REAL>& Jv) {
+        for( size_t i=0; i<N; ++i) {
+            Jv[i] = (2. + sigma) * v[i] ;
+            if( i > 0   ) Jv[i] -= v[i-1] ;
+            if( i < N-1 ) Jv[i] -= v[i+1] ;
+        }
+    } ;
+    apply(b, Jb) ;
+    std::vector<SKL_REAL> J2b(N) ;
+    apply(Jb, J2b) ;
+    for( size_t i=0; i<N; ++i) {
+        h_B(i,0) = b[i] ;
+        h_B(i,1) = J2b[i] ;
+    }
+    Kokkos::deep_copy(B, h_B) ;
+    check(B) ;
+}
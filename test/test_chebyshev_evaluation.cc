@@ -0,0 +1,124 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/sinh_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/chebyshev_evaluation.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+TEST_CASE("chebyshev evaluation at arbitrary points in 1D", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 48, P = 1000 ;
+    // Points clustered at x = 0 on [0,2]
+    sinh_coordinate_mapping map(0., 2., 0., 4.) ;
+    chebyshev_collocation cheb(N) ;
+    mapped_grid<sinh_coordinate_mapping> grid(map, cheb.points()) ;
+    auto xg = grid.physical() ;
+
+    Kokkos::View<SKL_REAL*> u("u", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) { u(i) = Kokkos::exp(Kokkos::sin(xg(i))) ; }) ;
+    chebyshev_evaluator<1, sinh_coordinate_mapping> eval({N}, map) ;
+    eval.set_values(u) ;
+
+    Kokkos::View<SKL_REAL*> x("x", P), f("f", P), df("df", P), d2f("d2f", P) ;
+    Kokkos::parallel_for("points", P, KOKKOS_LAMBDA(int p) { x(p) = 2. * (p + 0.5) / P ; }) ;
+    eval.evaluate(x, f) ;
+    eval.evaluate(x, df, {1}) ;
+    eval.evaluate(x, d2f, {2}) ;
+
+    auto h_x   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_f   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f) ;
+    auto h_df  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), df) ;
+    auto h_d2f = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d2f) ;
+    for( size_t p=0; p<P; ++p) {
+        SKL_REAL const xp = h_x(p), e = Kokkos::exp(Kokkos::sin(xp)), c = Kokkos::cos(xp), s = Kokkos::sin(xp) ;
+        CHECK_THAT( h_f(p),   Catch::Matchers::WithinAbs(e, 1e-12) ) ;
+        CHECK_THAT( h_df(p),  Catch::Matchers::WithinAbs(c * e, 1e-9) ) ;
+        CHECK_THAT( h_d2f(p), Catch::Matchers::WithinAbs((c * c - s) * e, 1e-6) ) ;
+    }
+}
+
+TEST_CASE("chebyshev evaluation of tensor products", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t P = 200 ;
+    // Physical domain [-2,2] in every direction
+    linear_coordinate_mapping map(0.5, 0.) ;
+
+    SECTION("2D") {
+        constexpr size_t N0 = 28, N1 = 32 ;
+        Kokkos::View<SKL_REAL**> u("u", N0, N1) ;
+        Kokkos::parallel_for("fill", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0}, {N0, N1})
+                            , KOKKOS_LAMBDA(int i, int j) {
+            SKL_REAL const x = map.log_to_phys<SKL_REAL>(-Kokkos::cos(M_PI * i / (N0 - 1))) ;
+            SKL_REAL const y = map.log_to_phys<SKL_REAL>(-Kokkos::cos(M_PI * j / (N1 - 1))) ;
+            u(i,j) = Kokkos::sin(x) * Kokkos::cos(2. * y) ;
+        }) ;
+        chebyshev_evaluator<2, linear_coordinate_mapping> eval({N0, N1}, map, map) ;
+        eval.set_values(u) ;
+
+        Kokkos::View<SKL_REAL**> x("x", P, 2) ;
+        Kokkos::View<SKL_REAL*> f("f", P), fxy("fxy", P) ;
+        Kokkos::parallel_for("points", P, KOKKOS_LAMBDA(int p) {
+            x(p,0) = -2. + 4. * Kokkos::abs(Kokkos::sin(1.3 * p)) ;
+            x(p,1) = -2. + 4. * Kokkos::abs(Kokkos::cos(0.7 * p)) ;
+        }) ;
+        eval.evaluate(x, f) ;
+        eval.evaluate(x, fxy, {1, 1}) ;
+
+        auto h_x   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+        auto h_f   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f) ;
+        auto h_fxy = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fxy) ;
+        for( size_t p=0; p<P; ++p) {
+            SKL_REAL const xp = h_x(p,0), yp = h_x(p,1) ;
+            CHECK_THAT( h_f(p),   Catch::Matchers::WithinAbs(Kokkos::sin(xp) * Kokkos::cos(2. * yp), 1e-11) ) ;
+            CHECK_THAT( h_fxy(p), Catch::Matchers::WithinAbs(-2. * Kokkos::cos(xp) * Kokkos::sin(2. * yp), 1e-8) ) ;
+        }
+    }
+
+    SECTION("3D") {
+        // x^2 y z^3 is represented exactly
+        constexpr size_t N = 6 ;
+        Kokkos::View<SKL_REAL***> c("c", N, N, N) ;
+        chebyshev_evaluator<3, linear_coordinate_mapping> eval({N, N, N}, map, map, map) ;
+        Kokkos::View<SKL_REAL***> u("u", N, N, N) ;
+        Kokkos::parallel_for("fill", Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0,0,0}, {N, N, N})
+                            , KOKKOS_LAMBDA(int i, int j, int k) {
+            SKL_REAL const x = map.log_to_phys<SKL_REAL>(-Kokkos::cos(M_PI * i / (N - 1))) ;
+            SKL_REAL const y = map.log_to_phys<SKL_REAL>(-Kokkos::cos(M_PI * j / (N - 1))) ;
+            SKL_REAL const z = map.log_to_phys<SKL_REAL>(-Kokkos::cos(M_PI * k / (N - 1))) ;
+            u(i,j,k) = x * x * y * z * z * z ;
+        }) ;
+        eval.set_values(u) ;
+        // The same series given through its coefficients
+        chebyshev_evaluator<3, linear_coordinate_mapping> eval_c({N, N, N}, map, map, map) ;
+        Kokkos::deep_copy(c, eval.coefficients()) ;
+        eval_c.set_coefficients(c) ;
+
+        Kokkos::View<SKL_REAL**> x("x", P, 3) ;
+        Kokkos::View<SKL_REAL*> f("f", P), fxzz("fxzz", P) ;
+        Kokkos::parallel_for("points", P, KOKKOS_LAMBDA(int p) {
+            x(p,0) = -2. + 4. * Kokkos::abs(Kokkos::sin(1.3 * p)) ;
+            x(p,1) = -2. + 4. * Kokkos::abs(Kokkos::cos(0.7 * p)) ;
+            x(p,2) = -2. + 4. * Kokkos::abs(Kokkos::sin(0.3 * p + 1.)) ;
+        }) ;
+        eval.evaluate(x, f) ;
+        eval_c.evaluate(x, fxzz, {1, 0, 2}) ;
+
+        auto h_x    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+        auto h_f    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f) ;
+        auto h_fxzz = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fxzz) ;
+        for( size_t p=0; p<P; ++p) {
+            SKL_REAL const xp = h_x(p,0), yp = h_x(p,1), zp = h_x(p,2) ;
+            CHECK_THAT( h_f(p),    Catch::Matchers::WithinAbs(xp * xp * yp * zp * zp * zp, 1e-11) ) ;
+            CHECK_THAT( h_fxzz(p), Catch::Matchers::WithinAbs(12. * xp * yp * zp, 1e-9) ) ;
+        }
+    }
+}
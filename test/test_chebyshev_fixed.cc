@@ -0,0 +1,161 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/chebyshev_fixed.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+
+TEST_CASE("fixed order chebyshev kernels", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 16 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {0.5, 0.} ;
+    mapped_grid<linear_coordinate_mapping> grid(map, cheb.points()) ;
+
+    auto x = cheb.points() ;
+    Kokkos::View<sfad_t<2>*, Kokkos::DefaultExecutionSpace> u("u", N, 3), du("du", N, 3), du_f("du_f", N, 3) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        u(i) = sfad_t<2>(2, 0, Kokkos::exp(x(i))) ;
+        u(i).fastAccessDx(1) = Kokkos::sin(x(i)) ;
+    }) ;
+
+    cheb.second_derivative(grid, u, du) ;
+    chebyshev_fixed<N>::second_derivative(grid, u, du_f) ;
+
+    auto h_du   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+    auto h_du_f = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du_f) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_du_f(i).val(),   Catch::Matchers::WithinAbs(h_du(i).val(),   1e-10) ) ;
+        CHECK_THAT( h_du_f(i).dx(0),   Catch::Matchers::WithinAbs(h_du(i).dx(0),   1e-10) ) ;
+        CHECK_THAT( h_du_f(i).dx(1),   Catch::Matchers::WithinAbs(h_du(i).dx(1),   1e-10) ) ;
+    }
+
+    // Batches of lines and transforms round trip
+    constexpr size_t n_lines = 5 ;
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> v("v", n_lines, N), c("c", n_lines, N), w("w", n_lines, N) ;
+    Kokkos::parallel_for("fill_lines", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{n_lines,N})
+        , KOKKOS_LAMBDA(int l, int i) { v(l,i) = Kokkos::cos((l+1) * x(i)) ; }) ;
+    chebyshev_fixed<N>::to_coefficients(v, c) ;
+    chebyshev_fixed<N>::from_coefficients(c, w) ;
+    auto h_v = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v) ;
+    auto h_w = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w) ;
+    for( size_t l=0; l<n_lines; ++l) for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_w(l,i), Catch::Matchers::WithinAbs(h_v(l,i), 1e-13) ) ;
+    }
+    // x = T_1(x) has a single non-vanishing coefficient
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> t1("t1", N), c1("c1", N) ;
+    Kokkos::deep_copy(t1, x) ;
+    chebyshev_fixed<N>::to_coefficients(t1, c1) ;
+    auto h_c1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c1) ;
+    for( size_t k=0; k<N; ++k) {
+        CHECK_THAT( h_c1(k), Catch::Matchers::WithinAbs(k==1 ? 1. : 0., 1e-14) ) ;
+    }
+}
+
+TEST_CASE("chebyshev operator dispatch", "[spectral]")
+{
+    using namespace skl ;
+    for( size_t N : {10, 12} ) {
+        chebyshev_operator op(N) ;
+        auto x = op.points() ;
+        Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> u("u", N), du("du", N), du_d("du_d", N) ;
+        Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) { u(i) = x(i) * x(i) ; }) ;
+        op.derivative(u, du) ;
+        op.dynamic().derivative(u, du_d) ;
+        auto h_x  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+        auto h_du = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+        auto h_dd = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du_d) ;
+        for( size_t i=0; i<N; ++i) {
+            CHECK_THAT( h_du(i), Catch::Matchers::WithinAbs(2.*h_x(i), 1e-12) ) ;
+            CHECK_THAT( h_du(i), Catch::Matchers::WithinAbs(h_dd(i),   1e-12) ) ;
+        }
+    }
+}
+
+/* Every fixed order kernel against chebyshev_collocation, on a single line and on a batch */
+template< size_t N >
+void check_fixed_against_dynamic()
+{
+    using namespace skl ;
+    using view_t  = Kokkos::View<SKL_REAL*,  Kokkos::DefaultExecutionSpace> ;
+    using lines_t = Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> ;
+    constexpr size_t n_lines = 3 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {0.5, 0.} ;
+    mapped_grid<linear_coordinate_mapping> grid(map, cheb.points()) ;
+    auto x = cheb.points() ;
+
+    lines_t u("u", n_lines, N), out("out", n_lines, N), out_f("out_f", n_lines, N) ;
+    Kokkos::parallel_for("fill_lines", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{n_lines,N})
+        , KOKKOS_LAMBDA(int l, int i) { u(l,i) = Kokkos::exp((l+1) * x(i)) * Kokkos::sin(x(i)) ; }) ;
+    auto u0 = Kokkos::subview(u, 0, Kokkos::ALL()) ;
+    view_t out0("out0", N), out0_f("out0_f", N) ;
+
+    auto compare = [&] (std::string const& op) {
+        INFO( "N = " << N << ", " << op ) ;
+        auto h_out    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out) ;
+        auto h_out_f  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out_f) ;
+        auto h_out0   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out0) ;
+        auto h_out0_f = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out0_f) ;
+        for( size_t i=0; i<N; ++i) {
+            CHECK_THAT( h_out0_f(i), Catch::Matchers::WithinAbs(h_out0(i), 1e-8 * (1. + Kokkos::abs(h_out0(i)))) ) ;
+            for( size_t l=0; l<n_lines; ++l) {
+                CHECK_THAT( h_out_f(l,i), Catch::Matchers::WithinAbs(h_out(l,i), 1e-8 * (1. + Kokkos::abs(h_out(l,i)))) ) ;
+            }
+        }
+    } ;
+    // The dynamic operators act on one line at a time
+    auto dynamic = [&] (auto const& op) {
+        op(u0, out0) ;
+        for( size_t l=0; l<n_lines; ++l) {
+            op(Kokkos::subview(u, l, Kokkos::ALL()), Kokkos::subview(out, l, Kokkos::ALL())) ;
+        }
+    } ;
+
+    dynamic([&] (auto const& v, auto const& w) { cheb.derivative(v, w) ; }) ;
+    chebyshev_fixed<N>::derivative(u0, out0_f) ;
+    chebyshev_fixed<N>::derivative(u, out_f) ;
+    compare("derivative") ;
+
+    dynamic([&] (auto const& v, auto const& w) { cheb.derivative(grid, v, w) ; }) ;
+    chebyshev_fixed<N>::derivative(grid, u0, out0_f) ;
+    chebyshev_fixed<N>::derivative(grid, u, out_f) ;
+    compare("mapped derivative") ;
+
+    dynamic([&] (auto const& v, auto const& w) { cheb.second_derivative(grid, v, w) ; }) ;
+    chebyshev_fixed<N>::second_derivative(grid, u0, out0_f) ;
+    chebyshev_fixed<N>::second_derivative(grid, u, out_f) ;
+    compare("mapped second derivative") ;
+
+    dynamic([&] (auto const& v, auto const& w) { cheb.to_coefficients(v, w) ; }) ;
+    chebyshev_fixed<N>::to_coefficients(u0, out0_f) ;
+    chebyshev_fixed<N>::to_coefficients(u, out_f) ;
+    compare("to_coefficients") ;
+
+    dynamic([&] (auto const& v, auto const& w) { cheb.from_coefficients(v, w) ; }) ;
+    chebyshev_fixed<N>::from_coefficients(u0, out0_f) ;
+    chebyshev_fixed<N>::from_coefficients(u, out_f) ;
+    compare("from_coefficients") ;
+}
+
+TEST_CASE("fixed order kernels match the dynamic operators", "[spectral]")
+{
+    check_fixed_against_dynamic<8>()  ;
+    check_fixed_against_dynamic<12>() ;
+    check_fixed_against_dynamic<16>() ;
+    check_fixed_against_dynamic<24>() ;
+    check_fixed_against_dynamic<32>() ;
+}
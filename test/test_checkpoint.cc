@@ -0,0 +1,53 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/io/checkpoint.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+TEST_CASE("checkpoint round trip", "[io]")
+{
+    using namespace skl ;
+    constexpr size_t m = 37 ;
+
+    Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace> u("u", m, 3), u_in("u_in", m, 3) ;
+    sfad_view_t<1> x("x", m, 2), x_in("x_in", m, 2) ;
+
+    Kokkos::parallel_for("fill", m,
+        KOKKOS_LAMBDA( int i)
+    {
+        for( int j=0; j<3; ++j) u(i,j) = i + 0.5 * j ;
+        x(i) = sfad_t<1>(1.5 * i) ;
+        x(i).fastAccessDx(0) = -1. * i ;
+    }) ;
+
+    {
+        io::checkpoint ckpt("test_checkpoint.h5", true) ;
+        ckpt.write_view("solution/u", u) ;
+        ckpt.write_view("solution/x", x) ;
+        ckpt.write_scalar("solution/iteration", size_t{42}) ;
+    }
+    {
+        io::checkpoint ckpt("test_checkpoint.h5", false) ;
+        REQUIRE( ckpt.exists("solution/u") ) ;
+        REQUIRE( not ckpt.exists("solution/v") ) ;
+        ckpt.read_view("solution/u", u_in) ;
+        ckpt.read_view("solution/x", x_in) ;
+        CHECK( ckpt.read_scalar<size_t>("solution/iteration") == 42 ) ;
+    }
+
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u_in) ;
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x_in) ;
+    for( int i=0; i<m; ++i) {
+        for( int j=0; j<3; ++j) {
+            CHECK_THAT( h_u(i,j), Catch::Matchers::WithinAbs(i + 0.5 * j, 1e-12) ) ;
+        }
+        CHECK_THAT( h_x(i).val(), Catch::Matchers::WithinAbs(1.5 * i, 1e-12) ) ;
+        CHECK_THAT( h_x(i).dx(0), Catch::Matchers::WithinAbs(-1. * i, 1e-12) ) ;
+    }
+}
@@ -0,0 +1,80 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/utils/execution.hh>
+#include <SKL/solvers/gmres.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "tridiagonal_residual.hh"
+
+#include <vector>
+
+/* Same operator, only the default instance overloads */
+struct default_space_residual {
+    tridiagonal_residual<> op ;
+
+    template< typename x_t, typename r_t >
+    void compute_residual(x_t const& x, r_t const& r) {
+        op.compute_residual(Kokkos::DefaultExecutionSpace(), x, r) ;
+    }
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) {
+        op.jvp(Kokkos::DefaultExecutionSpace(), x, v, Jv) ;
+    }
+} ;
+
+TEST_CASE("linalg wrappers on an execution space instance", "[utils]")
+{
+    using namespace skl ;
+    constexpr size_t N = 100 ;
+    auto spaces = partition_space(2) ;
+    REQUIRE( spaces.size() == 2 ) ;
+
+    sfad_view_t<1> x("x", N, 2), y("y", N, 2) ;
+    Kokkos::deep_copy(spaces[0], x, sfad_t<1>(1.)) ;
+    Kokkos::deep_copy(spaces[1], y, sfad_t<1>(2.)) ;
+    utils::linalg::axpy(spaces[0], SKL_REAL{2.}, x, x) ;
+    utils::linalg::scal(spaces[1], y, SKL_REAL{0.5}, y) ;
+    CHECK_THAT( utils::linalg::dot(spaces[0], x, x), Catch::Matchers::WithinRel(9. * N, 1e-14) ) ;
+    CHECK_THAT( utils::linalg::nrm2(spaces[1], y), Catch::Matchers::WithinRel(Kokkos::sqrt(SKL_REAL(N)), 1e-14) ) ;
+}
+
+TEST_CASE("independent gmres solves on partitioned instances", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 200 ;
+    constexpr size_t n_solves = 4 ;
+    SKL_REAL const tol = 1e-10 ;
+
+    std::vector<gmres> solvers ;
+    std::vector<sfad_view_t<1>> xs ;
+    for( size_t l=0; l<n_solves; ++l) {
+        solvers.emplace_back(N, 40, tol, 100) ;
+        xs.emplace_back("x", N, 2) ;
+    }
+
+    auto spaces = partition_space(n_solves) ;
+    for_each_partition(spaces, [&] (size_t l, auto const& space) {
+        tridiagonal_residual<> res{N, 0.1 * (l+1)} ;
+        solvers[l].solve(space, res, xs[l]) ;
+    }) ;
+
+    for( size_t l=0; l<n_solves; ++l) {
+        // Reference on the default instance, through the fenced path
+        default_space_residual res{{N, 0.1 * (l+1)}} ;
+        sfad_view_t<1> x_ref("x_ref", N, 2) ;
+        gmres ref(N, 40, tol, 100) ;
+        ref.solve(spaces[l], res, x_ref) ;
+
+        utils::linalg::axpy(SKL_REAL{-1.}, x_ref, xs[l]) ;
+        CHECK( utils::linalg::nrm2(xs[l]) < 1e-8 * utils::linalg::nrm2(x_ref) ) ;
+    }
+}
@@ -0,0 +1,154 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/dual.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/solvers/linearized_operator.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+
+#include <type_traits>
+
+/* Touches every math function of skl::dual */
+struct all_functions {
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (T const& u) const {
+        using Kokkos::exp ; using Kokkos::expm1 ; using Kokkos::log ; using Kokkos::log1p ; 
+        using Kokkos::log10 ; using Kokkos::sqrt ; using Kokkos::cbrt ; using Kokkos::sin ; 
+        using Kokkos::cos ; using Kokkos::tan ; using Kokkos::asin ; using Kokkos::acos ; 
+        using Kokkos::atan ; using Kokkos::sinh ; using Kokkos::cosh ; using Kokkos::tanh ; 
+        using Kokkos::asinh ; using Kokkos::acosh ; using Kokkos::atanh ; using Kokkos::abs ; 
+        using Kokkos::erf ; using Kokkos::pow ; using Kokkos::atan2 ; using Kokkos::hypot ; 
+        T const s = 0.5 * u ; 
+        return exp(u) + expm1(u) + log(u) + log1p(u) + log10(u) + sqrt(u) + cbrt(u) 
+             + sin(u) + cos(u) + tan(u) + asin(s) + acos(s) + atan(u) 
+             + sinh(u) + cosh(u) + tanh(u) + asinh(u) + acosh(1. + u) + atanh(s) 
+             + abs(-u) + erf(u) + pow(u, 2.5) + pow(2., u) + pow(u, s) 
+             + atan2(u, 1. + u) + hypot(u, 2. * u) - 1. / u + u / (1. + u * u) ; 
+    }
+} ; 
+
+/* Functions with SIMD overloads in Kokkos, used for the packed variant */
+struct simd_functions {
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (T const& u) const {
+        using Kokkos::exp ; using Kokkos::log ; using Kokkos::sqrt ; using Kokkos::sin ; 
+        using Kokkos::cos ; using Kokkos::tanh ; using Kokkos::pow ; using Kokkos::atan2 ; 
+        return exp(u) * sin(u) + log(u) + sqrt(u) + cos(2. * u) + tanh(u) 
+             + pow(u, 1.5) + atan2(u, 1. + u) - 1. / u ; 
+    }
+} ; 
+
+TEST_CASE("dual number layout", "[utils][dual]")
+{
+    using namespace skl ;
+    STATIC_REQUIRE( std::is_trivially_copyable_v<dual<SKL_REAL>> ) ;
+    STATIC_REQUIRE( sizeof(dual<SKL_REAL>) == 2 * sizeof(SKL_REAL) ) ;
+    STATIC_REQUIRE( is_dual_v<dual<SKL_REAL> const> ) ;
+    STATIC_REQUIRE( not is_dual_v<sfad_t<1>> ) ;
+}
+
+TEST_CASE("dual numbers agree with SFad", "[utils][dual]")
+{
+    using namespace skl ;
+    constexpr size_t N = 64 ;
+    Kokkos::View<dual<SKL_REAL>*, Kokkos::DefaultExecutionSpace> fd("fd", N) ;
+    sfad_view_t<1> fs("fs", N, 2) ;
+    all_functions const f ;
+    Kokkos::parallel_for("evaluate", N, KOKKOS_LAMBDA(int i) {
+        SKL_REAL const x = 0.05 + 0.015 * i ;
+        fd(i) = f(dual<SKL_REAL>(1, 0, x)) ;
+        fs(i) = f(sfad_t<1>(1, 0, x)) ;
+    }) ;
+    auto h_fd = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fd) ;
+    auto h_fs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fs) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_fd(i).val(), Catch::Matchers::WithinRel(h_fs(i).val(), 1e-13) ) ;
+        CHECK_THAT( h_fd(i).dx(0), Catch::Matchers::WithinRel(h_fs(i).dx(0), 1e-12) ) ;
+    }
+}
+
+TEST_CASE("dual powers at the origin", "[utils][dual]")
+{
+    using namespace skl ;
+    using Kokkos::pow ;
+    dual<SKL_REAL> const zero(0., 1.), constant(0., 0.) ;
+    // Values are finite for any exponent
+    CHECK( pow(zero, 0.5).val() == 0. ) ;
+    CHECK( pow(zero, 0).val() == 1. ) ;
+    CHECK( pow(zero, 0).dx(0) == 0. ) ;
+    CHECK( pow(zero, 2).val() == 0. ) ;
+    CHECK( pow(zero, 2).dx(0) == 0. ) ;
+    CHECK( pow(zero, 1).dx(0) == 1. ) ;
+    // A constant keeps a zero derivative
+    CHECK( pow(constant, 0.5).val() == 0. ) ;
+    CHECK( pow(constant, 0.5).dx(0) == 0. ) ;
+    CHECK_THAT( pow(dual<SKL_REAL>(4., 1.), 0.5).dx(0), Catch::Matchers::WithinRel(0.25, 1e-15) ) ;
+}
+
+TEST_CASE("residual JVP with dual numbers", "[utils][dual][solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    grid_t grid(map, cheb.points()) ;
+    linearized_residual<bratu, chebyshev_collocation, grid_t> res(bratu{N, 1.}, cheb, grid) ;
+
+    auto x = grid.physical() ;
+    sfad_view_t<1> us("us", N, 2), rs("rs", N, 2) ;
+    Kokkos::View<dual<SKL_REAL>*, Kokkos::DefaultExecutionSpace> ud("ud", N), rd("rd", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        SKL_REAL const u = 0.3 * (1. - x(i) * x(i)), v = Kokkos::sin(3. * x(i)) ;
+        us(i) = sfad_t<1>(1, 0, u) ;
+        us(i).fastAccessDx(0) = v ;
+        ud(i) = dual<SKL_REAL>(u, v) ;
+    }) ;
+    res.compute_residual(us, rs) ;
+    res.compute_residual(ud, rd) ;
+
+    auto h_rs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rs) ;
+    auto h_rd = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rd) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_rd(i).val(), Catch::Matchers::WithinAbs(h_rs(i).val(), 1e-11) ) ;
+        CHECK_THAT( h_rd(i).dx(0), Catch::Matchers::WithinAbs(h_rs(i).dx(0), 1e-11) ) ;
+    }
+}
+
+TEST_CASE("SIMD packed point-wise JVP", "[utils][dual]")
+{
+    using namespace skl ;
+    using view_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ;
+    // not a multiple of the SIMD width, so that the scalar tail runs
+    constexpr size_t N = 103 ;
+    view_t u("u", N), v("v", N), fu("fu", N), jv("jv", N) ;
+    Kokkos::View<dual<SKL_REAL>*, Kokkos::DefaultExecutionSpace> ref("ref", N) ;
+    simd_functions const f ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        u(i) = 0.05 + 0.01 * i ;
+        v(i) = Kokkos::cos(0.1 * i) ;
+        ref(i) = f(dual<SKL_REAL>(u(i), v(i))) ;
+    }) ;
+    pointwise_jvp(f, u, v, fu, jv) ;
+
+    auto h_fu  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fu) ;
+    auto h_jv  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), jv) ;
+    auto h_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ref) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_fu(i), Catch::Matchers::WithinRel(h_ref(i).val(), 1e-13) ) ;
+        CHECK_THAT( h_jv(i), Catch::Matchers::WithinRel(h_ref(i).dx(0), 1e-12) ) ;
+    }
+}
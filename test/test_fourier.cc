@@ -0,0 +1,129 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/spectral/fourier.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/tensor_product.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+TEST_CASE("fourier derivatives of trigonometric polynomials", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 64 ;
+    SKL_REAL const L = 3. ;
+    fourier_collocation fourier(N, L, -1.) ;
+    auto x = fourier.points() ;
+    SKL_REAL const k1 = 2. * M_PI / L ;
+
+    Kokkos::View<SKL_REAL*> u("u", N), du("du", N), d2u("d2u", N), v("v", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        u(i) = 2. + Kokkos::sin(3. * k1 * x(i)) + 0.5 * Kokkos::cos(7. * k1 * x(i)) ;
+    }) ;
+    fourier.derivative(u, du) ;
+    fourier.second_derivative(u, d2u) ;
+
+    // Round trip through the coefficients
+    Kokkos::View<Kokkos::complex<SKL_REAL>*> c("c", N/2+1) ;
+    fourier.to_coefficients(u, c) ;
+    fourier.from_coefficients(c, v) ;
+
+    auto h_x   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_u   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u) ;
+    auto h_du  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+    auto h_d2u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d2u) ;
+    auto h_v   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v) ;
+    auto h_c   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c) ;
+    for( size_t i=0; i<N; ++i) {
+        SKL_REAL const xi = h_x(i) ;
+        SKL_REAL const ref1 = 3. * k1 * Kokkos::cos(3. * k1 * xi) - 3.5 * k1 * Kokkos::sin(7. * k1 * xi) ;
+        SKL_REAL const ref2 = - 9. * k1 * k1 * Kokkos::sin(3. * k1 * xi) - 24.5 * k1 * k1 * Kokkos::cos(7. * k1 * xi) ;
+        CHECK_THAT( h_du(i),  Catch::Matchers::WithinAbs(ref1, 1e-11) ) ;
+        CHECK_THAT( h_d2u(i), Catch::Matchers::WithinAbs(ref2, 1e-9) ) ;
+        CHECK_THAT( h_v(i),   Catch::Matchers::WithinAbs(h_u(i), 1e-13) ) ;
+    }
+    CHECK_THAT( h_c(0).real(), Catch::Matchers::WithinAbs(2., 1e-13) ) ;
+}
+
+TEST_CASE("fourier derivatives of Fad views", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+    fourier_collocation fourier(N) ;
+    auto x = fourier.points() ;
+
+    // u = a sin(x) + b cos(2x) seeded in a and b
+    sfad_view_t<2> u("u", N, 3), du("du", N, 3) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        sfad_t<2> const a(2, 0, 1.5), b(2, 1, -0.5) ;
+        u(i) = a * Kokkos::sin(x(i)) + b * Kokkos::cos(2. * x(i)) ;
+    }) ;
+    fourier.derivative(u, du) ;
+
+    auto h_x  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_du = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+    for( size_t i=0; i<N; ++i) {
+        SKL_REAL const xi = h_x(i) ;
+        CHECK_THAT( h_du(i).val(), Catch::Matchers::WithinAbs(1.5 * Kokkos::cos(xi) + Kokkos::sin(2. * xi), 1e-12) ) ;
+        CHECK_THAT( h_du(i).dx(0), Catch::Matchers::WithinAbs(Kokkos::cos(xi), 1e-12) ) ;
+        CHECK_THAT( h_du(i).dx(1), Catch::Matchers::WithinAbs(-2. * Kokkos::sin(2. * xi), 1e-12) ) ;
+    }
+}
+
+TEST_CASE("fourier helmholtz solve", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 64 ;
+    fourier_collocation fourier(N) ;
+    auto x = fourier.points() ;
+    SKL_REAL const sigma = 2. ;
+
+    // u = cos(4x) - sin(x), f = u'' - sigma u
+    Kokkos::View<SKL_REAL*> f("f", N), u("u", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        f(i) = -(16. + sigma) * Kokkos::cos(4. * x(i)) + (1. + sigma) * Kokkos::sin(x(i)) ;
+    }) ;
+    fourier.solve_helmholtz(f, u, sigma) ;
+
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i), Catch::Matchers::WithinAbs(Kokkos::cos(4. * h_x(i)) - Kokkos::sin(h_x(i)), 1e-13) ) ;
+    }
+}
+
+TEST_CASE("mixed fourier-chebyshev tensor product", "[spectral]")
+{
+    using namespace skl ;
+    constexpr size_t Nx = 16, Ny = 12 ;
+    fourier_collocation fourier(Nx) ;
+    chebyshev_collocation cheb(Ny) ;
+    tensor_product_2d<fourier_collocation, chebyshev_collocation> tp(fourier, cheb) ;
+    auto x = fourier.points() ;
+    auto y = cheb.points() ;
+
+    // u = sin(2x) y^3
+    Kokkos::View<SKL_REAL**> u("u", Nx, Ny), ux("ux", Nx, Ny), uy("uy", Nx, Ny), lu("lu", Nx, Ny), tmp("tmp", Nx, Ny) ;
+    Kokkos::parallel_for("fill", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0}, {Nx, Ny})
+                        , KOKKOS_LAMBDA(int i, int j) { u(i,j) = Kokkos::sin(2. * x(i)) * y(j) * y(j) * y(j) ; }) ;
+    tp.derivative(u, ux, 0) ;
+    tp.derivative(u, uy, 1) ;
+    tp.laplacian(u, lu, tmp) ;
+
+    auto h_x  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_y  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y) ;
+    auto h_ux = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ux) ;
+    auto h_uy = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), uy) ;
+    auto h_lu = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lu) ;
+    for( size_t i=0; i<Nx; ++i) for( size_t j=0; j<Ny; ++j) {
+        SKL_REAL const s = Kokkos::sin(2. * h_x(i)), c = Kokkos::cos(2. * h_x(i)), yj = h_y(j) ;
+        CHECK_THAT( h_ux(i,j), Catch::Matchers::WithinAbs(2. * c * yj * yj * yj, 1e-11) ) ;
+        CHECK_THAT( h_uy(i,j), Catch::Matchers::WithinAbs(3. * s * yj * yj, 1e-11) ) ;
+        CHECK_THAT( h_lu(i,j), Catch::Matchers::WithinAbs(-4. * s * yj * yj * yj + 6. * s * yj, 1e-9) ) ;
+    }
+}
@@ -0,0 +1,62 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/gcrodr.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "tridiagonal_residual.hh"
+
+TEST_CASE("gcrodr recycles across related solves", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 200 ;
+    SKL_REAL const tol = 1e-8 ;
+
+    gmres  solver_ref(N, 30, tol, 200) ;
+    gcrodr solver(N, 30, 10, tol, 200) ;
+
+    size_t it_ref{0}, it_rec{0} ;
+    for( int step=0; step<4; ++step) {
+        tridiagonal_residual<> res{N, 1e-3 * (1. + 0.01 * step)} ;
+        sfad_view_t<1> x_ref("x_ref", N, 2), x("x", N, 2) ;
+        it_ref = solver_ref.solve(res, x_ref) ;
+        it_rec = solver.solve(res, x) ;
+
+        sfad_view_t<1> r("r", N, 2) ;
+        res.compute_residual(x, r) ;
+        CHECK( utils::linalg::nrm2(r) / Kokkos::sqrt(SKL_REAL(N)) < 1e-6 ) ;
+    }
+    CHECK( solver.recycled() > 0 ) ;
+    CHECK( solver.recycle_failures() == 0 ) ;
+    CHECK( it_rec < it_ref ) ;
+}
+
+TEST_CASE("gcrodr passes plain directions to residuals that accept them", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 200 ;
+    SKL_REAL const tol = 1e-8 ;
+
+    gcrodr solver(N, 30, 10, tol, 200), solver_plain(N, 30, 10, tol, 200) ;
+    for( int step=0; step<3; ++step) {
+        SKL_REAL const sigma = 1e-3 * (1. + 0.01 * step) ;
+        tridiagonal_residual<false> res{N, sigma} ;
+        tridiagonal_residual<true>  res_plain{N, sigma} ;
+        sfad_view_t<1> x("x", N, 2), x_plain("x_plain", N, 2) ;
+        size_t const it       = solver.solve(res, x) ;
+        size_t const it_plain = solver_plain.solve(res_plain, x_plain) ;
+        // Same arithmetic on the same basis
+        CHECK( it == it_plain ) ;
+        CHECK( solver.recycled() == solver_plain.recycled() ) ;
+        utils::linalg::axpy(SKL_REAL{-1.}, x, x_plain) ;
+        CHECK( utils::linalg::nrm2(x_plain) < 1e-12 * utils::linalg::nrm2(x) ) ;
+    }
+}
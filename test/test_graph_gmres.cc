@@ -0,0 +1,85 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/graph_gmres.hh>
+#include <SKL/solvers/linearized_operator.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+#include "gmres_comparison.hh"
+
+#include <optional>
+
+TEST_CASE("graph captured gmres matches the multi-kernel solver", "[solvers][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    grid_t grid(map, cheb.points()) ;
+    linearized_residual<bratu, chebyshev_collocation, grid_t> res(bratu{N, 1.}, cheb, grid) ;
+
+    graph_gmres solver(N, 20, 1e-12, 10) ;
+    graph_gmres solver_direct(N, 20, 1e-12, 10, false) ;
+    gmres solver_ref(N, 20, 1e-12, 10) ;
+    solver.set_check_interval(4) ;
+    CHECK( solver.uses_graph() ) ;
+    CHECK( not solver_direct.uses_graph() ) ;
+
+    auto const [u, n]               = newton_against_gmres(solver, solver_ref, res, N) ;
+    auto const [u_direct, n_direct] = newton_against_gmres(solver_direct, solver_ref, res, N) ;
+    // Submissions after convergence are no-ops and not counted
+    CHECK( n == n_direct ) ;
+
+    auto h_u        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u) ;
+    auto h_u_direct = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u_direct) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i).val(), Catch::Matchers::WithinAbs(h_u_direct(i).val(), 1e-13) ) ;
+    }
+}
+
+TEST_CASE("graph gmres rebuilds its graph for a new residual at the same address", "[solvers][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    using res_t  = linearized_residual<bratu, chebyshev_collocation, grid_t> ;
+    grid_t grid(map, cheb.points()) ;
+
+    graph_gmres solver(N, 20, 1e-12, 10) ;
+    gmres solver_ref(N, 20, 1e-12, 10) ;
+    std::optional<res_t> res ;
+    for( SKL_REAL lambda : {1., 0.5} ) {
+        // Same storage, new Views
+        res.emplace(bratu{N, lambda}, cheb, grid) ;
+        sfad_view_t<1> u("u", N, 2), u_ref("u_ref", N, 2), r("r", N, 2) ;
+        for( int it=0; it<8; ++it) {
+            solver.solve(*res, u) ;
+            solver_ref.solve(*res, u_ref) ;
+        }
+        res->compute_residual(u, r) ;
+        CHECK( utils::linalg::nrm2(r) < 1e-9 ) ;
+
+        auto h_u     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u) ;
+        auto h_u_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u_ref) ;
+        for( size_t i=0; i<N; ++i) {
+            CHECK_THAT( h_u(i).val(), Catch::Matchers::WithinAbs(h_u_ref(i).val(), 1e-10) ) ;
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/solvers/jacobian.hh>
+#include <SKL/solvers/direct.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/preconditioners/frozen_jacobian.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+/* F(x)_i = 2 x_i - x_{i-1} - x_{i+1} + x_i^3 - 1 */
+struct nonlinear_laplacian {
+    size_t N ;
+    skl::sfad_view_t<1> xs, rs ;
+
+    nonlinear_laplacian(size_t n) : N(n), xs("xs", n, 2), rs("rs", n, 2) {}
+
+    template< typename x_t, typename r_t >
+    void compute_residual(x_t const& x, r_t const& r) {
+        using value_t = typename r_t::non_const_value_type ;
+        size_t const n = N ;
+        Kokkos::parallel_for("residual", n, KOKKOS_LAMBDA(int i)
+        {
+            value_t val = 2. * x(i) + x(i) * x(i) * x(i) - 1. ;
+            if( i > 0   ) val -= x(i-1) ;
+            if( i < n-1 ) val -= x(i+1) ;
+            r(i) = val ;
+        }) ;
+    }
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) {
+        auto _xs = xs ; auto _rs = rs ;
+        Kokkos::parallel_for("seed", N, KOKKOS_LAMBDA(int i)
+        {
+            _xs(i) = skl::sfad_t<1>(1, 0, x(i).val()) ;
+            _xs(i).fastAccessDx(0) = v(i).val() ;
+        }) ;
+        compute_residual(xs, rs) ;
+        Kokkos::parallel_for("extract", N, KOKKOS_LAMBDA(int i) { Jv(i) = _rs(i).dx(0) ; }) ;
+    }
+} ;
+
+skl::jacobian_pattern tridiagonal_pattern(size_t N)
+{
+    std::vector<size_t> row_map(N+1, 0) ;
+    std::vector<int> entries ;
+    for( size_t i=0; i<N; ++i) {
+        for( int j=static_cast<int>(i)-1; j<=static_cast<int>(i)+1; ++j) {
+            if( j >= 0 and j < static_cast<int>(N) ) entries.push_back(j) ;
+        }
+        row_map[i+1] = entries.size() ;
+    }
+    return skl::jacobian_pattern(N, row_map, entries) ;
+}
+
+TEST_CASE("jacobian coloring and assembly", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 50 ;
+
+    auto pattern = tridiagonal_pattern(N) ;
+    CHECK( pattern.n_colors() == 3 ) ;
+
+    auto tp = jacobian_pattern::tensor_product({6, 5}, 2) ;
+    CHECK( tp.size() == 60 ) ;
+    CHECK( tp.n_colors() < tp.size() ) ;
+
+    nonlinear_laplacian res(N) ;
+    sfad_view_t<1> x("x", N, 2) ;
+    Kokkos::parallel_for("init", N, KOKKOS_LAMBDA(int i) { x(i) = 0.01 * i ; }) ;
+
+    jacobian_assembler<2> sparse(pattern) ;
+    jacobian_assembler<8> dense(jacobian_pattern::dense(N)) ;
+    CHECK( sparse.passes() == 2 ) ;
+    CHECK( dense.passes()  == 7 ) ;
+
+    typename jacobian_assembler<2>::dense_matrix_t J1("J1", N, N), J2("J2", N, N) ;
+    sparse.assemble(res, x, J1) ;
+    dense.assemble(res, x, J2) ;
+    auto h_x  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_J1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), J1) ;
+    auto h_J2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), J2) ;
+    for( size_t i=0; i<N; ++i) for( size_t j=0; j<N; ++j) {
+        SKL_REAL ex { 0. } ;
+        if( i == j ) ex = 2. + 3. * h_x(i).val() * h_x(i).val() ;
+        else if( i == j+1 or j == i+1 ) ex = -1. ;
+        CHECK_THAT( h_J1(i,j), Catch::Matchers::WithinAbs(ex, 1e-14) ) ;
+        CHECK_THAT( h_J2(i,j), Catch::Matchers::WithinAbs(ex, 1e-14) ) ;
+    }
+}
+
+TEST_CASE("direct newton and frozen jacobian preconditioner", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 100 ;
+    SKL_REAL const tol = 1e-10 ;
+
+    nonlinear_laplacian res(N) ;
+    auto pattern = tridiagonal_pattern(N) ;
+    sfad_view_t<1> r("r", N, 2) ;
+
+    // Newton with direct solves converges quadratically
+    direct_solver<4> direct(pattern) ;
+    sfad_view_t<1> x("x", N, 2) ;
+    for( int it=0; it<8; ++it) direct.solve(res, x) ;
+    res.compute_residual(x, r) ;
+    CHECK( utils::linalg::nrm2(r) < 1e-10 ) ;
+
+    // Krylov with the Jacobian frozen at the initial state
+    sfad_view_t<1> x0("x0", N, 2), x1("x1", N, 2) ;
+    frozen_jacobian_preconditioner<4> prec(pattern) ;
+    prec.update(res, x0) ;
+    gmres plain(N, 50, tol, 20), precond(N, 50, tol, 20) ;
+    size_t it_plain{0}, it_prec{0} ;
+    for( int it=0; it<8; ++it) {
+        it_plain = plain.solve(res, x0) ;
+        it_prec  = precond.solve(res, x1, prec) ;
+    }
+    res.compute_residual(x1, r) ;
+    CHECK( utils::linalg::nrm2(r) < 1e-8 ) ;
+    CHECK( prec.updates() == 1 ) ;
+    CHECK( it_prec < it_plain ) ;
+}
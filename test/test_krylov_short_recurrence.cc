@@ -0,0 +1,97 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/utils/execution.hh>
+#include <SKL/solvers/cg.hh>
+#include <SKL/solvers/minres.hh>
+#include <SKL/solvers/bicgstab.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "tridiagonal_residual.hh"
+
+/* z = r / diag(A) */
+struct jacobi {
+    SKL_REAL d ;
+
+    template< typename r_t, typename z_t >
+    void apply(r_t const& r, z_t const& z) const {
+        SKL_REAL const inv = 1. / d ;
+        Kokkos::parallel_for("jacobi", r.extent(0), KOKKOS_LAMBDA(int i) { z(i) = inv * r(i) ; }) ;
+    }
+} ;
+
+template< typename res_t >
+SKL_REAL residual_norm(res_t& res, skl::sfad_view_t<1> const& x) {
+    skl::sfad_view_t<1> r("r", x.extent(0), 2) ;
+    res.compute_residual(x, r) ;
+    return utils::linalg::nrm2(r) ;
+}
+
+TEST_CASE("conjugate gradient variants", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 200 ;
+    SKL_REAL const tol = 1e-10 ;
+    tridiagonal_residual<false> res{N, 0.1} ;
+
+    sfad_view_t<1> x_classic("x_classic", N, 2), x_cg("x_cg", N, 2), x_prec("x_prec", N, 2) ;
+    cg classic(N, 500, tol, cg::variant::classic) ;
+    cg fused(N, 500, tol, cg::variant::chronopoulos_gear) ;
+    size_t const n_classic = classic.solve(res, x_classic) ;
+    size_t const n_fused   = fused.solve(res, x_cg) ;
+    fused.solve(res, x_prec, jacobi{2.1}) ;
+
+    // Same Krylov space, the iteration counts agree up to rounding
+    CHECK( n_fused <= n_classic + 2 ) ;
+    CHECK( n_classic <= n_fused + 2 ) ;
+    CHECK( classic.residual() < tol ) ;
+    CHECK( fused.residual() < tol ) ;
+    CHECK( residual_norm(res, x_classic) < 1e-8 ) ;
+    CHECK( residual_norm(res, x_cg) < 1e-8 ) ;
+    CHECK( residual_norm(res, x_prec) < 1e-8 ) ;
+}
+
+TEST_CASE("minres on an indefinite operator", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 100 ;
+    // Eigenvalues in (-1, 3)
+    tridiagonal_residual<true> res{N, -1.0} ;
+
+    sfad_view_t<1> x("x", N, 2) ;
+    minres solver(N, 1000, 1e-10) ;
+    solver.solve(res, x) ;
+    CHECK( solver.residual() < 1e-10 ) ;
+    CHECK( residual_norm(res, x) < 1e-7 ) ;
+
+    // Preconditioned, on a definite operator and a separate instance
+    tridiagonal_residual<false> res_spd{N, 0.5} ;
+    sfad_view_t<1> x_spd("x_spd", N, 2) ;
+    auto const space = partition_space(2)[1] ;
+    solver.solve(space, res_spd, x_spd, jacobi{2.5}) ;
+    space.fence() ;
+    CHECK( residual_norm(res_spd, x_spd) < 1e-7 ) ;
+}
+
+TEST_CASE("bicgstab on a non symmetric operator", "[solvers]")
+{
+    using namespace skl ;
+    constexpr size_t N = 200 ;
+    tridiagonal_residual<true> res{N, 0.1, 0.5} ;
+
+    sfad_view_t<1> x("x", N, 2), x_prec("x_prec", N, 2) ;
+    bicgstab solver(N, 1000, 1e-10) ;
+    solver.solve(res, x) ;
+    CHECK( solver.residual() < 1e-10 ) ;
+    CHECK( residual_norm(res, x) < 1e-7 ) ;
+
+    solver.solve(res, x_prec, jacobi{2.1}) ;
+    CHECK( residual_norm(res, x_prec) < 1e-7 ) ;
+}
@@ -0,0 +1,109 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/helpers.hh>
+#include <SKL/solvers/linearized_operator.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+
+/* Forwards to a residual but hides plain_directions, Krylov vectors get seeded */
+template< typename res_t >
+struct seeded_residual {
+    res_t& res ;
+
+    template< typename x_t, typename r_t >
+    void compute_residual(x_t const& x, r_t const& r) { res.compute_residual(x, r) ; }
+
+    template< typename x_t >
+    void linearize(x_t const& x) { res.linearize(x) ; }
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) {
+        static_assert( Sacado::IsFad<typename v_t::non_const_value_type>::value ) ;
+        res.jvp(x, v, Jv) ;
+    }
+} ;
+
+TEST_CASE("cached linearization of a pointwise residual", "[solvers][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 24 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    grid_t grid(map, cheb.points()) ;
+    linearized_residual<bratu, chebyshev_collocation, grid_t> res(bratu{N, 1.}, cheb, grid) ;
+
+    auto x = grid.physical() ;
+    sfad_view_t<1> u("u", N, 2), v("v", N, 2), Jv("Jv", N, 2), us("us", N, 2), rs("rs", N, 2) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        u(i) = 0.3 * (1. - x(i) * x(i)) ;
+        v(i) = Kokkos::sin(3. * x(i)) ;
+        us(i) = sfad_t<1>(1, 0, u(i).val()) ;
+        us(i).fastAccessDx(0) = v(i).val() ;
+    }) ;
+
+    res.linearize(u) ;
+    res.jvp(u, v, Jv) ;
+    res.compute_residual(us, rs) ;
+
+    auto h_Jv = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Jv) ;
+    auto h_rs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rs) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_Jv(i).val(), Catch::Matchers::WithinAbs(h_rs(i).dx(0), 1e-10) ) ;
+    }
+
+    // Newton iterations, the linearization is refreshed by the solver
+    gmres solver(N, N, 1e-12, 10) ;
+    sfad_view_t<1> r("r", N, 2) ;
+    Kokkos::deep_copy(u, sfad_t<1>(0.)) ;
+    for( int it=0; it<10; ++it) solver.solve(res, u) ;
+    res.compute_residual(u, r) ;
+    CHECK( utils::linalg::nrm2(r) < 1e-9 ) ;
+}
+
+TEST_CASE("plain and seeded Krylov directions agree", "[solvers][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 24 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    grid_t grid(map, cheb.points()) ;
+    using res_t = linearized_residual<bratu, chebyshev_collocation, grid_t> ;
+    res_t res(bratu{N, 1.}, cheb, grid) ;
+    seeded_residual<res_t> seeded{res} ;
+    STATIC_REQUIRE( detail::plain_directions<res_t> ) ;
+    STATIC_REQUIRE( not detail::plain_directions<seeded_residual<res_t>> ) ;
+
+    auto x = grid.physical() ;
+    sfad_view_t<1> u("u", N, 2), us("us", N, 2) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) {
+        u(i) = 0.1 * (1. - x(i) * x(i)) ;
+        us(i) = u(i) ;
+    }) ;
+
+    gmres solver(N, N, 1e-12, 10), solver_seeded(N, N, 1e-12, 10) ;
+    size_t const it  = solver.solve(res, u) ;
+    size_t const its = solver_seeded.solve(seeded, us) ;
+    CHECK( it == its ) ;
+    auto h_u  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), u) ;
+    auto h_us = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), us) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_u(i).val(), Catch::Matchers::WithinAbs(h_us(i).val(), 1e-13) ) ;
+    }
+}
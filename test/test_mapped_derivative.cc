@@ -0,0 +1,185 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/sinh_mapping.hh>
+#include <SKL/mappings/compactified_mapping.hh>
+#include <SKL/mappings/exponential_mapping.hh>
+#include <SKL/mappings/kosloff_tal_ezer_mapping.hh>
+#include <SKL/mappings/tan_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+TEST_CASE("mapped chebyshev derivatives", "[mappings][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 24 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {0.5, 0.} ;
+    mapped_grid<linear_coordinate_mapping> grid(map, cheb.points()) ;
+
+    auto x = grid.physical() ;
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> u("u", N), du("du", N), d2u("d2u", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) { u(i) = Kokkos::sin(x(i)) ; }) ;
+
+    cheb.derivative(grid, u, du) ;
+    cheb.second_derivative(grid, u, d2u) ;
+
+    auto h_x   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_du  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+    auto h_d2u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d2u) ;
+    auto h_d1  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), grid.dxi_dx()) ;
+    auto h_d2  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), grid.d2xi_dx2()) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_d1(i), Catch::Matchers::WithinAbs(0.5, 1e-14) ) ;
+        CHECK_THAT( h_d2(i), Catch::Matchers::WithinAbs(0.,  1e-14) ) ;
+        CHECK_THAT( h_du(i),  Catch::Matchers::WithinAbs( Kokkos::cos(h_x(i)), 1e-9) ) ;
+        CHECK_THAT( h_d2u(i), Catch::Matchers::WithinAbs(-Kokkos::sin(h_x(i)), 1e-7) ) ;
+    }
+}
+
+TEST_CASE("sinh mapped chebyshev derivatives", "[mappings][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+
+    chebyshev_collocation cheb(N) ;
+    sinh_coordinate_mapping map {0., 1., 0.5, 10.} ;
+    mapped_grid<sinh_coordinate_mapping> grid(map, cheb.points()) ;
+
+    auto x = grid.physical() ;
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> u("u", N), du("du", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) { u(i) = Kokkos::tanh(20.*(x(i)-0.5)) ; }) ;
+
+    cheb.derivative(grid, u, du) ;
+
+    auto h_x  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_du = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+    CHECK_THAT( h_x(0),   Catch::Matchers::WithinAbs(0., 1e-12) ) ;
+    CHECK_THAT( h_x(N-1), Catch::Matchers::WithinAbs(1., 1e-12) ) ;
+    for( size_t i=0; i<N; ++i) {
+        SKL_REAL const c = Kokkos::cosh(20.*(h_x(i)-0.5)) ;
+        CHECK_THAT( h_du(i), Catch::Matchers::WithinAbs( 20./(c*c), 1e-4) ) ;
+    }
+}
+
+TEST_CASE("compactified chebyshev derivatives", "[mappings][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+
+    chebyshev_collocation cheb(N) ;
+    compactified_coordinate_mapping map {0., 1.} ;
+    mapped_grid<compactified_coordinate_mapping> grid(map, cheb.points()) ;
+
+    auto x = grid.physical() ;
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> u("u", N), du("du", N) ;
+    Kokkos::parallel_for("fill", N, KOKKOS_LAMBDA(int i) { u(i) = 1./(1.+x(i)) ; }) ;
+
+    cheb.derivative(grid, u, du) ;
+
+    auto h_x  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x) ;
+    auto h_du = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), du) ;
+    auto h_d1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), grid.dxi_dx()) ;
+    // The last point sits at infinity where the metric vanishes
+    CHECK( Kokkos::isinf(h_x(N-1)) ) ;
+    CHECK( h_d1(N-1) == 0. ) ;
+    for( size_t i=0; i<N; ++i) {
+        SKL_REAL const ex = Kokkos::isinf(h_x(i)) ? 0. : -1./((1.+h_x(i))*(1.+h_x(i))) ;
+        CHECK_THAT( h_du(i), Catch::Matchers::WithinAbs( ex, 1e-10) ) ;
+    }
+}
+
+/* Checks phys_to_log(log_to_phys(xi)) = xi and the AD metric against x'(xi), x''(xi) */
+template< typename map_t, typename d1_t, typename d2_t >
+void check_mapping(map_t const& map, std::vector<SKL_REAL> const& xi, d1_t const& dx, d2_t const& d2x)
+{
+    for( SKL_REAL const l : xi ) {
+        SKL_REAL const x = map.log_to_phys(l) ;
+        CHECK_THAT( map.phys_to_log(x), Catch::Matchers::WithinAbs(l, 1e-13) ) ;
+
+        SKL_REAL d1, d2 ;
+        map.metric_logical(l, d1, d2) ;
+        SKL_REAL const x1 = dx(l), x2 = d2x(l) ;
+        CHECK_THAT( d1, Catch::Matchers::WithinRel(1. / x1, 1e-12) ) ;
+        CHECK_THAT( d2, Catch::Matchers::WithinAbs(-x2 / (x1*x1*x1), 1e-10 * Kokkos::abs(x2 / (x1*x1*x1)) + 1e-14) ) ;
+    }
+}
+
+TEST_CASE("exponential mapping", "[mappings]")
+{
+    using namespace skl ;
+    std::vector<SKL_REAL> const xi { -1., -0.9, -0.3, 0., 0.4, 0.95, 1. } ;
+    for( SKL_REAL const alpha : { 4., -2.5 } ) {
+        SKL_REAL const a = 0.5, b = 3. ;
+        exponential_coordinate_mapping map {a, b, alpha} ;
+        CHECK_THAT( map.log_to_phys(-1.), Catch::Matchers::WithinAbs(a, 1e-14) ) ;
+        CHECK_THAT( map.log_to_phys( 1.), Catch::Matchers::WithinAbs(b, 1e-13) ) ;
+        CHECK_THAT( map.phys_to_log(a), Catch::Matchers::WithinAbs(-1., 1e-14) ) ;
+        CHECK_THAT( map.phys_to_log(b), Catch::Matchers::WithinAbs( 1., 1e-13) ) ;
+
+        SKL_REAL const c = (b - a) / Kokkos::expm1(alpha) ;
+        check_mapping(map, xi
+            , [=] (SKL_REAL l) { return 0.5  * alpha * c * Kokkos::exp(0.5 * alpha * (l + 1.)) ; }
+            , [=] (SKL_REAL l) { return 0.25 * alpha * alpha * c * Kokkos::exp(0.5 * alpha * (l + 1.)) ; }) ;
+    }
+    // Points cluster towards a for alpha > 0
+    exponential_coordinate_mapping map {0., 1., 4.} ;
+    CHECK( map.log_to_phys(0.) < 0.5 ) ;
+}
+
+TEST_CASE("Kosloff-Tal-Ezer mapping", "[mappings]")
+{
+    using namespace skl ;
+    std::vector<SKL_REAL> const xi { -1., -0.9, -0.3, 0., 0.4, 0.95, 1. } ;
+    for( SKL_REAL const alpha : { 0.5, 0.99 } ) {
+        SKL_REAL const a = -2., b = 1. ;
+        kosloff_tal_ezer_coordinate_mapping map {a, b, alpha} ;
+        CHECK_THAT( map.log_to_phys(-1.), Catch::Matchers::WithinAbs(a, 1e-14) ) ;
+        CHECK_THAT( map.log_to_phys( 1.), Catch::Matchers::WithinAbs(b, 1e-14) ) ;
+        CHECK_THAT( map.phys_to_log(a), Catch::Matchers::WithinAbs(-1., 1e-14) ) ;
+        CHECK_THAT( map.phys_to_log(b), Catch::Matchers::WithinAbs( 1., 1e-14) ) ;
+
+        SKL_REAL const h = 0.5 * (b - a), s = Kokkos::asin(alpha) ;
+        check_mapping(map, xi
+            , [=] (SKL_REAL l) { return h * alpha / (s * Kokkos::sqrt(1. - alpha*alpha*l*l)) ; }
+            , [=] (SKL_REAL l) { return h * alpha*alpha*alpha * l / (s * Kokkos::pow(1. - alpha*alpha*l*l, 1.5)) ; }) ;
+    }
+}
+
+TEST_CASE("tan mapping", "[mappings]")
+{
+    using namespace skl ;
+    SKL_REAL const x0 = 1., L = 2. ;
+    tan_coordinate_mapping map {x0, L} ;
+    CHECK_THAT( map.log_to_phys(0.), Catch::Matchers::WithinAbs(x0, 1e-14) ) ;
+    CHECK_THAT( map.log_to_phys(0.5), Catch::Matchers::WithinAbs(x0 + L, 1e-13) ) ;
+
+    // The endpoints sit at infinity where the metric vanishes
+    for( SKL_REAL const l : { -1., 1. } ) {
+        SKL_REAL const x = map.log_to_phys(l) ;
+        CHECK( Kokkos::isinf(x) ) ;
+        CHECK( (x > 0) == (l > 0) ) ;
+        CHECK_THAT( map.phys_to_log(x), Catch::Matchers::WithinAbs(l, 1e-15) ) ;
+        SKL_REAL d1, d2 ;
+        map.metric_logical(l, d1, d2) ;
+        CHECK( d1 == 0. ) ;
+        CHECK( d2 == 0. ) ;
+    }
+
+    std::vector<SKL_REAL> const xi { -0.99, -0.6, -0.1, 0., 0.25, 0.8, 0.999 } ;
+    check_mapping(map, xi
+        , [=] (SKL_REAL l) { SKL_REAL const c = Kokkos::cos(0.5 * M_PI * l) ; return 0.5 * M_PI * L / (c*c) ; }
+        , [=] (SKL_REAL l) { SKL_REAL const c = Kokkos::cos(0.5 * M_PI * l) ; 
+                             return 0.5 * M_PI * M_PI * L * Kokkos::tan(0.5 * M_PI * l) / (c*c) ; }) ;
+}
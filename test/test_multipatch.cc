@@ -0,0 +1,101 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/solvers/multipatch.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+#include "linear_patches.hh"
+
+#include <vector>
+
+/* Boundary layers eps u'' - u + 1 = 0, u(-1) = u(1) = 0 */
+struct layer {
+    int N ;
+    SKL_REAL eps ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return u ;
+        return eps * uxx - u + 1. ;
+    }
+} ;
+
+template< typename solver_t, typename exact_t >
+SKL_REAL max_error(solver_t const& solver, exact_t const& exact)
+{
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.solution()) ;
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.points()) ;
+    SKL_REAL err { 0. } ;
+    for( size_t lp=0; lp<solver.local_patches(); ++lp) {
+        for( size_t i=0; i<solver.size(solver.first_patch()+lp); ++i) {
+            err = Kokkos::fmax(err, Kokkos::abs(h_u(lp,i) - exact(h_x(lp,i)))) ;
+        }
+    }
+    return err ;
+}
+
+TEST_CASE("multipatch Newton on the Bratu problem", "[solvers][spectral]")
+{
+    using namespace skl ;
+    SKL_REAL const lambda = 0.5 ;
+    // u = -2 log( cosh(theta x / 2) / cosh(theta / 2) ), theta = sqrt(2 lambda) cosh(theta / 2)
+    SKL_REAL theta = 1. ;
+    for( int it=0; it<200; ++it) theta = Kokkos::sqrt(2. * lambda) * Kokkos::cosh(0.5 * theta) ;
+    auto exact = [=] (SKL_REAL x) { return -2. * Kokkos::log(Kokkos::cosh(0.5 * theta * x) / Kokkos::cosh(0.5 * theta)) ; } ;
+
+    std::vector<SKL_REAL> const breaks { -1., -0.2, 0.1, 0.6, 1. } ;
+    std::vector<size_t> const sizes { 18, 12, 14, 16 } ;
+    size_t total { 0 } ;
+    for( auto n : sizes ) total += n ;
+    multipatch_solver<bratu, linear_coordinate_mapping> solver(bratu{int(total), lambda}, linear_patches(breaks), sizes) ;
+    REQUIRE( solver.total_size() == total ) ;
+
+    size_t const steps = solver.solve() ;
+    CHECK( solver.converged() ) ;
+    CHECK( steps <= 6 ) ;
+    CHECK( max_error(solver, exact) < 1e-10 ) ;
+    auto const& gamma = solver.interface_values() ;
+    REQUIRE( gamma.size() == 3 ) ;
+    for( size_t k=0; k<gamma.size(); ++k) {
+        CHECK_THAT( gamma[k], Catch::Matchers::WithinAbs(exact(breaks[k+1]), 1e-10) ) ;
+    }
+
+    // A converged state is a fixed point
+    CHECK( solver.step() < 1e-10 ) ;
+}
+
+TEST_CASE("multipatch resolution of boundary layers", "[solvers][spectral]")
+{
+    using namespace skl ;
+    SKL_REAL const eps = 1e-5 ;
+    SKL_REAL const s = Kokkos::sqrt(eps) ;
+    auto exact = [=] (SKL_REAL x) { 
+        return 1. - (Kokkos::exp((x - 1.) / s) + Kokkos::exp(-(x + 1.) / s)) / (1. + Kokkos::exp(-2. / s)) ; 
+    } ;
+
+    // Thin patches at the layers, a single wide patch in the bulk
+    std::vector<SKL_REAL> const breaks { -1., -0.97, -0.85, 0.85, 0.97, 1. } ;
+    std::vector<size_t> const sizes(5, 24) ;
+    multipatch_solver<layer, linear_coordinate_mapping> solver(layer{5*24, eps}, linear_patches(breaks), sizes) ;
+    solver.set_newton(5, 1e-12) ;
+    solver.set_state([] (SKL_REAL x) { return 1. - x * x ; }) ;
+    size_t const steps = solver.solve() ;
+    // Linear problem, the second step only confirms convergence
+    CHECK( steps == 2 ) ;
+    CHECK( max_error(solver, exact) < 1e-9 ) ;
+
+    // Neighbouring patches agree at the interfaces
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), solver.solution()) ;
+    for( size_t p=0; p+1<sizes.size(); ++p) {
+        CHECK_THAT( h_u(p, sizes[p]-1), Catch::Matchers::WithinAbs(h_u(p+1, 0), 1e-12) ) ;
+    }
+}
@@ -0,0 +1,61 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/solvers/multipatch.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+#include "linear_patches.hh"
+
+#include <mpi.h>
+
+#include <vector>
+
+/* Run with mpirun -n 2 or more, every rank checks its patches against a single rank solve */
+TEST_CASE("distributed multipatch Newton matches the single rank solve", "[solvers][spectral][mpi]")
+{
+    using namespace skl ;
+    using solver_t = multipatch_solver<bratu, linear_coordinate_mapping> ;
+    SKL_REAL const lambda = 0.5 ;
+    std::vector<SKL_REAL> const breaks { -1., -0.7, -0.2, 0.1, 0.4, 0.6, 1. } ;
+    std::vector<size_t> const sizes { 14, 18, 12, 14, 12, 16 } ;
+    size_t total { 0 } ;
+    for( auto n : sizes ) total += n ;
+
+    int n_ranks ;
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks) ;
+    solver_t global(bratu{int(total), lambda}, linear_patches(breaks), sizes, MPI_COMM_WORLD) ;
+    solver_t single(bratu{int(total), lambda}, linear_patches(breaks), sizes, MPI_COMM_SELF) ;
+    REQUIRE( single.local_patches() == sizes.size() ) ;
+    if( n_ranks > 1 ) {
+        CHECK( global.local_patches() < sizes.size() ) ;
+    }
+
+    size_t const steps = global.solve() ;
+    CHECK( global.converged() ) ;
+    CHECK( steps == single.solve() ) ;
+
+    // Every rank solves the interface system redundantly
+    auto const& gamma     = global.interface_values() ;
+    auto const& gamma_ref = single.interface_values() ;
+    REQUIRE( gamma.size() == gamma_ref.size() ) ;
+    for( size_t k=0; k<gamma.size(); ++k) {
+        CHECK_THAT( gamma[k], Catch::Matchers::WithinAbs(gamma_ref[k], 1e-13) ) ;
+    }
+
+    auto h_u     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), global.solution()) ;
+    auto h_u_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), single.solution()) ;
+    for( size_t lp=0; lp<global.local_patches(); ++lp) {
+        size_t const p = global.first_patch() + lp ;
+        for( size_t i=0; i<sizes[p]; ++i) {
+            CHECK_THAT( h_u(lp,i), Catch::Matchers::WithinAbs(h_u_ref(p,i), 1e-13) ) ;
+        }
+    }
+}
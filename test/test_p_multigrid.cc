@@ -0,0 +1,84 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/spectral/chebyshev_transfer.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/linearized_operator.hh>
+#include <SKL/preconditioners/p_multigrid.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+
+#include <vector>
+
+TEST_CASE("chebyshev transfer between orders", "[spectral]")
+{
+    using namespace skl ;
+    chebyshev_collocation fine(33), coarse(17) ;
+    chebyshev_transfer transfer(fine, coarse) ;
+
+    // A degree 10 polynomial is represented exactly on both grids
+    Kokkos::View<SKL_REAL*> uc("uc", 17), uf("uf", 33), uc2("uc2", 17) ;
+    auto xc = coarse.points() ;
+    Kokkos::parallel_for("fill", 17, KOKKOS_LAMBDA(int i) {
+        uc(i) = Kokkos::cos(10. * Kokkos::acos(xc(i))) + xc(i) * xc(i) ;
+    }) ;
+    transfer.to_fine(uc, uf) ;
+    transfer.to_coarse(uf, uc2) ;
+
+    auto h_uc  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), uc) ;
+    auto h_uc2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), uc2) ;
+    auto h_uf  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), uf) ;
+    auto h_xf  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fine.points()) ;
+    for( size_t i=0; i<17; ++i) {
+        CHECK_THAT( h_uc2(i), Catch::Matchers::WithinAbs(h_uc(i), 1e-12) ) ;
+    }
+    for( size_t i=0; i<33; ++i) {
+        SKL_REAL const x = h_xf(i) ;
+        CHECK_THAT( h_uf(i), Catch::Matchers::WithinAbs(Kokkos::cos(10. * Kokkos::acos(x)) + x * x, 1e-12) ) ;
+    }
+}
+
+TEST_CASE("p-multigrid keeps gmres iterations bounded in N", "[preconditioners][spectral]")
+{
+    using namespace skl ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    auto make_pde = [] (size_t n) { return bratu{static_cast<int>(n), 1.} ; } ;
+
+    std::vector<size_t> iterations ;
+    for( size_t N: {17, 33, 65} ) {
+        chebyshev_collocation cheb(N) ;
+        grid_t grid(map, cheb.points()) ;
+        linearized_residual<bratu, chebyshev_collocation, grid_t> res(make_pde(N), cheb, grid) ;
+        p_multigrid_preconditioner<bratu, linear_coordinate_mapping> mg(N, map, make_pde) ;
+        CHECK( mg.levels() >= 2 ) ;
+        CHECK( mg.size(mg.levels()-1) >= 9 ) ;
+
+        sfad_view_t<1> u("u", N, 2), r("r", N, 2) ;
+        gmres solver(N, 40, 1e-10, 20) ;
+        size_t first { 0 } ;
+        for( int it=0; it<6; ++it) {
+            mg.update(u) ;
+            size_t const n = solver.solve(res, u, mg) ;
+            if( it == 0 ) first = n ;
+        }
+        res.compute_residual(u, r) ;
+        CHECK( utils::linalg::nrm2(r) < 1e-8 ) ;
+        iterations.push_back(first) ;
+    }
+    for( auto const n: iterations ) {
+        CHECK( n < 20 ) ;
+    }
+    CHECK( iterations.back() <= iterations.front() + 3 ) ;
+}
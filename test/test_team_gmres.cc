@@ -0,0 +1,37 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/linalg.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/mappings/mapped_grid.hh>
+#include <SKL/spectral/chebyshev.hh>
+#include <SKL/solvers/gmres.hh>
+#include <SKL/solvers/team_gmres.hh>
+#include <SKL/solvers/linearized_operator.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "bratu_residual.hh"
+#include "gmres_comparison.hh"
+
+TEST_CASE("single kernel gmres matches the multi-kernel solver", "[solvers][spectral]")
+{
+    using namespace skl ;
+    constexpr size_t N = 32 ;
+
+    chebyshev_collocation cheb(N) ;
+    linear_coordinate_mapping map {1., 0.} ;
+    using grid_t = mapped_grid<linear_coordinate_mapping> ;
+    grid_t grid(map, cheb.points()) ;
+    linearized_residual<bratu, chebyshev_collocation, grid_t> res(bratu{N, 1.}, cheb, grid) ;
+
+    team_gmres solver(N, 20, 1e-12, 10) ;
+    gmres solver_ref(N, 20, 1e-12, 10) ;
+    CHECK( team_gmres::scratch_size(N, 20) > 0 ) ;
+    newton_against_gmres(solver, solver_ref, res, N) ;
+}
@@ -0,0 +1,188 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/mappings/linear_mapping.hh>
+#include <SKL/solvers/time_integrator.hh>
+#include <SKL/preconditioners/chebyshev.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+/* Heat equation u_t = u_xx, u(-1) = u(1) = 0 */
+struct heat {
+    int N ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return u ;
+        return uxx ;
+    }
+} ;
+
+/* Nonlinear diffusion u_t = u_xx - u^3, u(-1) = u(1) = 0 */
+struct cubic_diffusion {
+    int N ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return u ;
+        return uxx - u * u * u ;
+    }
+} ;
+
+/* Allen-Cahn u_t = eps u_xx + u - u^3, diffusion implicit and reaction explicit */
+struct allen_cahn_diffusion {
+    int N ;
+    SKL_REAL eps ;
+
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        if( i == 0 or i == N-1 ) return u ;
+        return eps * uxx ;
+    }
+} ;
+
+struct allen_cahn_reaction {
+    template< typename T >
+    KOKKOS_INLINE_FUNCTION
+    T operator() (int i, SKL_REAL x, T const& u, T const& ux, T const& uxx) const {
+        return u - u * u * u ;
+    }
+} ;
+
+template< typename integrator_t, typename f_t >
+void set_initial_state(integrator_t& integrator, f_t const& f)
+{
+    auto x = integrator.points() ;
+    Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> u0("u0", integrator.size()) ;
+    Kokkos::parallel_for("initial_state", integrator.size(), KOKKOS_LAMBDA(int i) {
+        u0(i) = f(x(i)) ;
+    }) ;
+    integrator.set_state(u0) ;
+}
+
+template< typename integrator_t >
+std::vector<SKL_REAL> host_solution(integrator_t const& integrator)
+{
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), integrator.solution()) ;
+    return std::vector<SKL_REAL>(h_u.data(), h_u.data() + h_u.extent(0)) ;
+}
+
+SKL_REAL max_difference(std::vector<SKL_REAL> const& a, std::vector<SKL_REAL> const& b)
+{
+    SKL_REAL err { 0. } ;
+    for( size_t i=0; i<a.size(); ++i) {
+        err = Kokkos::fmax(err, Kokkos::abs(a[i] - b[i])) ;
+    }
+    return err ;
+}
+
+TEST_CASE("BDF convergence on the heat equation", "[solvers][time]")
+{
+    using namespace skl ;
+    int const N = 20 ;
+    linear_coordinate_mapping map {1., 0.} ;
+    SKL_REAL const T = 1. ;
+    SKL_REAL const pi = M_PI ;
+    auto const initial = KOKKOS_LAMBDA (SKL_REAL x) { return Kokkos::cos(0.5 * pi * x) ; } ;
+
+    for( size_t k=1; k<=4; ++k) {
+        auto const scheme = static_cast<time_scheme>(k-1) ;
+        SKL_REAL err[2] ;
+        for( int r=0; r<2; ++r) {
+            implicit_integrator<heat, linear_coordinate_mapping> integrator(heat{N}, map, N, scheme, 0.02 / (1 << r)) ;
+            REQUIRE( integrator.order() == k ) ;
+            integrator.set_newton(10, 1e-12) ;
+            set_initial_state(integrator, initial) ;
+            size_t const steps = integrator.advance(T) ;
+            REQUIRE( steps == size_t(50 << r) ) ;
+            CHECK_THAT( integrator.time(), Catch::Matchers::WithinAbs(T, 1e-12) ) ;
+
+            auto const u = host_solution(integrator) ;
+            auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), integrator.points()) ;
+            err[r] = 0. ;
+            for( int i=0; i<N; ++i) {
+                SKL_REAL const exact = Kokkos::exp(-0.25 * pi * pi * T) * Kokkos::cos(0.5 * pi * h_x(i)) ;
+                err[r] = Kokkos::fmax(err[r], Kokkos::abs(u[i] - exact)) ;
+            }
+            // Linear problem: one Newton step per stage plus the one confirming convergence,
+            // the Jacobian is only rebuilt at start-up and when it is out of date
+            CHECK( integrator.newton_iterations() <= 2 * steps + 24 ) ;
+            CHECK( integrator.jacobian_updates() <= steps / 20 + 3 ) ;
+        }
+        CHECK( Kokkos::log2(err[0] / err[1]) > k - 0.2 ) ;
+    }
+}
+
+TEST_CASE("IMEX convergence on the Allen-Cahn equation", "[solvers][time]")
+{
+    using namespace skl ;
+    using integrator_t = implicit_integrator<allen_cahn_diffusion, linear_coordinate_mapping, allen_cahn_reaction> ;
+    static_assert( integrator_t::has_explicit ) ;
+    int const N = 20 ;
+    linear_coordinate_mapping map {1., 0.} ;
+    SKL_REAL const pi = M_PI ;
+    auto const initial = KOKKOS_LAMBDA (SKL_REAL x) {
+        return 0.8 * Kokkos::cos(0.5 * pi * x) + 0.1 * Kokkos::sin(pi * x) ;
+    } ;
+    auto run = [&] (time_scheme scheme, SKL_REAL dt) {
+        integrator_t integrator(allen_cahn_diffusion{N, 0.1}, map, N, scheme, dt, allen_cahn_reaction{}) ;
+        integrator.set_newton(10, 1e-13) ;
+        set_initial_state(integrator, initial) ;
+        integrator.advance(1.) ;
+        return host_solution(integrator) ;
+    } ;
+    auto const reference = run(time_scheme::ars443, 1e-3) ;
+
+    struct { time_scheme scheme ; SKL_REAL order ; } const cases[] = {
+        {time_scheme::imex_euler, 1.}, {time_scheme::ars222, 2.}, {time_scheme::ars443, 3.},
+        {time_scheme::bdf2, 2.}, {time_scheme::bdf3, 3.}, {time_scheme::bdf4, 4.}
+    } ;
+    for( auto const& c : cases ) {
+        SKL_REAL const e1 = max_difference(run(c.scheme, 0.04), reference) ;
+        SKL_REAL const e2 = max_difference(run(c.scheme, 0.02), reference) ;
+        CHECK( Kokkos::log2(e1 / e2) > c.order - 0.2 ) ;
+    }
+}
+
+TEST_CASE("Jacobian and preconditioner reuse across time steps", "[solvers][time]")
+{
+    using namespace skl ;
+    using integrator_t = implicit_integrator<cubic_diffusion, linear_coordinate_mapping> ;
+    int const N = 24 ;
+    linear_coordinate_mapping map {1., 0.} ;
+    SKL_REAL const pi = M_PI ;
+    auto const initial = KOKKOS_LAMBDA (SKL_REAL x) { return 2. * Kokkos::cos(0.5 * pi * x) ; } ;
+
+    integrator_t plain(cubic_diffusion{N}, map, N, time_scheme::bdf2, 1e-3) ;
+    set_initial_state(plain, initial) ;
+    plain.set_lagging(0, 0) ;
+    plain.advance(0.5) ;
+
+    integrator_t lagged(cubic_diffusion{N}, map, N, time_scheme::bdf2, 1e-3) ;
+    set_initial_state(lagged, initial) ;
+    lagged.set_lagging(25, 100) ;
+    chebyshev_preconditioner<integrator_t::residual_t> prec(N, 8) ;
+    size_t const steps = lagged.advance(0.5, prec) ;
+    REQUIRE( steps == 500 ) ;
+
+    // The setup is amortized over the steps, Newton still converges quickly
+    CHECK( plain.jacobian_updates() >= steps ) ;
+    CHECK( lagged.jacobian_updates() <= steps / 25 + 4 ) ;
+    CHECK( lagged.preconditioner_updates() <= steps / 100 + 4 ) ;
+    CHECK( lagged.preconditioner_updates() >= 2 ) ;
+    CHECK( lagged.newton_iterations() <= 3 * steps ) ;
+    CHECK( lagged.krylov_iterations() > 0 ) ;
+
+    // Both solve the same nonlinear stages
+    CHECK( max_difference(host_solution(lagged), host_solution(plain)) < 1e-8 ) ;
+}
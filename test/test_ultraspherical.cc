@@ -0,0 +1,96 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/spectral/ultraspherical.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <vector>
+
+/* Chebyshev series on [-1,1] at xi, on host */
+static SKL_REAL clenshaw(std::vector<SKL_REAL> const& c, SKL_REAL xi) 
+{
+    SKL_REAL b1 { 0. }, b2 { 0. } ; 
+    for( int k=c.size()-1; k>=1; --k) {
+        SKL_REAL const t = 2. * xi * b1 - b2 + c[k] ; 
+        b2 = b1 ; b1 = t ; 
+    }
+    return xi * b1 - b2 + c[0] ; 
+}
+
+TEST_CASE("ultraspherical operators", "[spectral]")
+{
+    using namespace skl ; 
+    constexpr size_t n = 12 ; 
+    // d/dx T_3 = 3 U_2, conversion of U_2 to C^(2) and x T_2 = (T_1 + T_3)/2
+    auto const D1 = ultraspherical::differentiation(n, 1) ; 
+    auto const D2 = ultraspherical::differentiation(n, 2) ; 
+    auto const S1 = ultraspherical::conversion(n, 1) ; 
+    CHECK( D1(2,3) == 3. ) ; 
+    CHECK( D2(1,3) == 6. ) ; 
+    CHECK_THAT( S1(2,2), Catch::Matchers::WithinAbs(1./3., 1e-15) ) ; 
+    auto const X = ultraspherical::multiplication(n, 0, {0., 1.}) ; 
+    CHECK( X(1,2) == 0.5 ) ; 
+    CHECK( X(3,2) == 0.5 ) ; 
+    CHECK( X(1,0) == 1. ) ; 
+    // M[T_2] T_3 = (T_1 + T_5)/2
+    auto const M = ultraspherical::multiplication(n, 0, {0., 0., 1.}) ; 
+    CHECK_THAT( M(1,3), Catch::Matchers::WithinAbs(0.5, 1e-15) ) ; 
+    CHECK_THAT( M(5,3), Catch::Matchers::WithinAbs(0.5, 1e-15) ) ; 
+    CHECK_THAT( M(3,3), Catch::Matchers::WithinAbs(0.,  1e-15) ) ; 
+}
+
+TEST_CASE("ultraspherical variable coefficient problem", "[spectral]")
+{
+    using namespace skl ; 
+    using bc_t = ultraspherical::boundary_condition ; 
+    // u'' + x u' + cos(x) u = f on [0,2], u = sin(3x) + x^2, Dirichlet and Robin conditions
+    SKL_REAL const x0 = 0., x1 = 2. ; 
+    auto const exact = [] (SKL_REAL x) { return std::sin(3. * x) + x * x ; } ; 
+    auto const f = [] (SKL_REAL x) {
+        return -9. * std::sin(3. * x) + 2. + x * (3. * std::cos(3. * x) + 2. * x) + std::cos(x) * (std::sin(3. * x) + x * x) ; 
+    } ; 
+    ultraspherical us(64, x0, x1) ; 
+    us.setup( [] (SKL_REAL) { return 1. ; }, [] (SKL_REAL x) { return x ; }, [] (SKL_REAL x) { return std::cos(x) ; }
+            , { bc_t{x0, 1., 0., exact(x0)}, bc_t{x1, 1., 1., exact(x1) + 3. * std::cos(3. * x1) + 2. * x1} } ) ; 
+    CHECK( us.lower_bandwidth() < 20 ) ; 
+
+    // Same solve through device Views
+    auto const fc = us.coefficients(f, 64) ; 
+    Kokkos::View<SKL_REAL*> d_f("f", fc.size()), d_u("u", us.size()) ; 
+    auto h_f = Kokkos::create_mirror_view(d_f) ; 
+    for( size_t k=0; k<fc.size(); ++k) h_f(k) = fc[k] ; 
+    Kokkos::deep_copy(d_f, h_f) ; 
+    us.solve(d_f, d_u) ; 
+    auto h_u = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d_u) ; 
+    std::vector<SKL_REAL> u(us.size()) ; 
+    for( size_t k=0; k<u.size(); ++k) u[k] = h_u(k) ; 
+
+    for( int i=0; i<=50; ++i) {
+        SKL_REAL const x = x0 + (x1 - x0) * i / 50. ; 
+        CHECK_THAT( clenshaw(u, 2. * (x - x0) / (x1 - x0) - 1.), Catch::Matchers::WithinAbs(exact(x), 1e-12) ) ; 
+    }
+}
+
+TEST_CASE("ultraspherical boundary layer at large N", "[spectral]")
+{
+    using namespace skl ; 
+    using bc_t = ultraspherical::boundary_condition ; 
+    // eps u'' - u = -1, u(-1) = u(1) = 0, layers of width sqrt(eps)
+    SKL_REAL const eps = 1e-6, d = std::sqrt(eps) ; 
+    auto const exact = [&] (SKL_REAL x) {
+        return 1. - ( std::exp((x - 1.) / d) + std::exp(-(x + 1.) / d) ) / ( 1. + std::exp(-2. / d) ) ; 
+    } ; 
+    ultraspherical us(20000) ; 
+    us.setup( [&] (SKL_REAL) { return eps ; }, [] (SKL_REAL) { return 0. ; }, [] (SKL_REAL) { return -1. ; }
+            , { bc_t{-1., 1., 0., 0.}, bc_t{1., 1., 0., 0.} } ) ; 
+    auto const u = us.solve(std::vector<SKL_REAL>{-1.}) ; 
+    for( int i=0; i<=1000; ++i) {
+        SKL_REAL const x = -1. + 2. * i / 1000. ; 
+        CHECK_THAT( clenshaw(u, x), Catch::Matchers::WithinAbs(exact(x), 1e-12) ) ; 
+    }
+}
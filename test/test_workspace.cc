@@ -0,0 +1,67 @@
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+#include <SKL/utils/workspace.hh>
+#include <SKL/utils/linalg.hh>
+
+#include <Sacado.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <Kokkos_Core.hpp>
+
+TEST_CASE("workspace arena", "[utils]")
+{
+    using namespace skl ;
+    using vec_t = Kokkos::View<SKL_REAL*, Kokkos::DefaultExecutionSpace> ;
+    using mat_t = Kokkos::View<SKL_REAL**, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace> ;
+
+    workspace<> ws(1 << 12) ;
+    size_t const cap = ws.capacity() ;
+
+    auto a = ws.view<vec_t>(100) ;
+    auto f = ws.view<sfad_view_t<2>>(50, 3) ;
+    CHECK( a.extent(0) == 100 ) ;
+    CHECK( f.extent(0) == 50 ) ;
+    CHECK( Kokkos::dimension_scalar(f) == 3 ) ;
+    CHECK( reinterpret_cast<size_t>(f.data()) % workspace<>::alignment == 0 ) ;
+
+    Kokkos::parallel_for("fill", 50, KOKKOS_LAMBDA(int i) {
+        a(i) = i ;
+        f(i) = sfad_t<2>(2, 1, SKL_REAL(i)) ;
+    }) ;
+    auto h_f = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f) ;
+    CHECK( h_f(7).val() == 7. ) ;
+    CHECK( h_f(7).dx(1) == 1. ) ;
+
+    // Stack-like reuse
+    size_t const m = ws.mark() ;
+    ws.view<vec_t>(10) ;
+    ws.release(m) ;
+    CHECK( ws.mark() == m ) ;
+
+    // Overflow is served, the buffer grows on reset
+    auto big = ws.view<mat_t>(64, 64) ;
+    CHECK( big.extent(1) == 64 ) ;
+    CHECK( ws.high_water() > cap ) ;
+    ws.reset() ;
+    CHECK( ws.used() == 0 ) ;
+    CHECK( ws.capacity() >= ws.high_water() ) ;
+
+    // Temporaries of the BLAS wrappers
+    size_t const N = 16 ;
+    auto A = ws.view<Kokkos::View<SKL_REAL**, Kokkos::DefaultExecutionSpace>>(N, N) ;
+    auto B = ws.view<sfad_view_t<1>>(N, 2) ;
+    Kokkos::parallel_for("fill_trsm", N, KOKKOS_LAMBDA(int i) {
+        for( size_t j=0; j<N; ++j) A(i,j) = (i == j) ? 2. : 0. ;
+        B(i) = 1. ;
+    }) ;
+    size_t const before = ws.mark() ;
+    utils::linalg::trsm("L", "U", "N", "N", sfad_t<1>(1.), A, B, &ws) ;
+    CHECK( ws.mark() == before ) ;
+    auto h_B = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B) ;
+    for( size_t i=0; i<N; ++i) {
+        CHECK_THAT( h_B(i).val(), Catch::Matchers::WithinAbs(0.5, 1e-15) ) ;
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef SKL_TEST_TRIDIAGONAL_RESIDUAL_HH
+#define SKL_TEST_TRIDIAGONAL_RESIDUAL_HH
+
+#include <SKL_config.h>
+
+#include <SKL/utils/types.hh>
+
+#include <Sacado.hpp>
+
+#include <Kokkos_Core.hpp>
+
+/*
+ * F(x) = A x - 1 with A = tridiag(-(1+c), 2 + sigma, -(1-c)).
+ * Symmetric for c = 0 with eigenvalues in (sigma, 4 + sigma).
+ * With plain = true the Krylov vectors are passed to jvp() directly.
+ * The kernels run on the given execution space instance, or on the 
+ * default one.
+ */
+template< bool plain = false >
+struct tridiagonal_residual {
+    static constexpr bool plain_directions = plain ;
+    size_t N ;
+    SKL_REAL sigma ;
+    SKL_REAL c { 0. } ;
+
+    template< typename exec_t, typename x_t, typename r_t >
+    void compute_residual(exec_t const& space, x_t const& x, r_t const& r) {
+        jvp(space, x, x, r) ;
+        Kokkos::parallel_for("source", Kokkos::RangePolicy<exec_t>(space, 0, N)
+                            , KOKKOS_LAMBDA(int i) { r(i) -= 1. ; }) ;
+    }
+
+    template< typename exec_t, typename x_t, typename v_t, typename jv_t >
+    void jvp(exec_t const& space, x_t const& x, v_t const& v, jv_t const& Jv) {
+        using value_t = typename v_t::non_const_value_type ;
+        size_t const n = N ; SKL_REAL const s = sigma, cc = c ;
+        Kokkos::parallel_for("jvp", Kokkos::RangePolicy<exec_t>(space, 0, n)
+                            , KOKKOS_LAMBDA(int i)
+        {
+            auto val = [&] (int j) { return Sacado::ScalarValue<value_t>::eval(v(j)) ; } ;
+            SKL_REAL Av = (2. + s) * val(i) ;
+            if( i > 0   ) Av -= (1. + cc) * val(i-1) ;
+            if( i < n-1 ) Av -= (1. - cc) * val(i+1) ;
+            Jv(i) = Av ;
+        }) ;
+    }
+
+    template< typename x_t, typename r_t >
+    void compute_residual(x_t const& x, r_t const& r) {
+        compute_residual(Kokkos::DefaultExecutionSpace(), x, r) ;
+    }
+
+    template< typename x_t, typename v_t, typename jv_t >
+    void jvp(x_t const& x, v_t const& v, jv_t const& Jv) {
+        jvp(Kokkos::DefaultExecutionSpace(), x, v, Jv) ;
+    }
+} ;
+
+#endif /* SKL_TEST_TRIDIAGONAL_RESIDUAL_HH */